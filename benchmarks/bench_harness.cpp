@@ -0,0 +1,178 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string_view>
+
+namespace {
+
+std::atomic<uint64_t> g_allocation_count{0};
+
+constexpr double kDefaultMinTimeMs = 200.0;  //!< Minimum duration of the measured run
+constexpr uint64_t kMaxIterations = 1ULL << 30;
+
+struct RegisteredBenchmark {
+    const char* name;
+    vne::log::bench::BenchFunction function;
+};
+
+std::vector<RegisteredBenchmark>& registry() {
+    static std::vector<RegisteredBenchmark> s_registry;
+    return s_registry;
+}
+
+struct Options {
+    std::string filter;
+    double min_time_ms = kDefaultMinTimeMs;
+    bool csv = false;
+    bool list = false;
+};
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        if (arg.rfind("--filter=", 0) == 0) {
+            options.filter = std::string(arg.substr(9));
+        } else if (arg.rfind("--min-time-ms=", 0) == 0) {
+            options.min_time_ms = std::atof(argv[i] + 14);
+        } else if (arg == "--csv") {
+            options.csv = true;
+        } else if (arg == "--list") {
+            options.list = true;
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--filter=<substring>] [--min-time-ms=<ms>] [--csv] [--list]\n",
+                         argv[0]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+/**
+ * @brief Runs a benchmark with growing iteration counts until it lasts min_time_ms.
+ */
+vne::log::bench::BenchState runCalibrated(const RegisteredBenchmark& benchmark, double min_time_ms) {
+    const double min_time_ns = min_time_ms * 1e6;
+    uint64_t iterations = 1;
+    while (true) {
+        vne::log::bench::BenchState state(iterations);
+        benchmark.function(state);
+        if (state.elapsedNs() >= min_time_ns || iterations >= kMaxIterations) {
+            return state;
+        }
+        // Predict the count needed to reach the target, growing by at most 10x per step.
+        double per_iteration = std::max(state.elapsedNs(), 1.0) / static_cast<double>(iterations);
+        double predicted = (min_time_ns * 1.2) / per_iteration;
+        iterations = static_cast<uint64_t>(
+            std::clamp(predicted, static_cast<double>(iterations + 1), static_cast<double>(iterations) * 10.0));
+    }
+}
+
+}  // namespace
+
+//==============================================================================
+// Allocation counting
+//==============================================================================
+
+void* operator new(std::size_t size) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace vne::log::bench {
+
+uint64_t allocationCount() {
+    return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+bool registerBenchmark(const char* name, BenchFunction function) {
+    registry().push_back({name, function});
+    return true;
+}
+
+}  // namespace vne::log::bench
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+
+    auto benchmarks = registry();
+    std::sort(benchmarks.begin(), benchmarks.end(), [](const auto& lhs, const auto& rhs) {
+        return std::strcmp(lhs.name, rhs.name) < 0;
+    });
+
+    if (options.csv) {
+        std::printf("name,iterations,ns_per_op,ops_per_sec,allocs_per_op,mb_per_sec\n");
+    } else if (!options.list) {
+        std::printf("%-44s %12s %14s %14s %12s %10s\n", "Benchmark", "Iterations", "ns/op", "ops/s", "allocs/op",
+                    "MB/s");
+        std::printf("%s\n", std::string(111, '-').c_str());
+    }
+
+    for (const auto& benchmark : benchmarks) {
+        if (!options.filter.empty() && std::strstr(benchmark.name, options.filter.c_str()) == nullptr) {
+            continue;
+        }
+        if (options.list) {
+            std::printf("%s\n", benchmark.name);
+            continue;
+        }
+
+        auto state = runCalibrated(benchmark, options.min_time_ms);
+        const uint64_t operations = state.iterations() * state.itemsPerIteration();
+        const double ns_per_op = state.elapsedNs() / static_cast<double>(operations);
+        const double ops_per_sec = ns_per_op > 0.0 ? 1e9 / ns_per_op : 0.0;
+        const double allocs_per_op = static_cast<double>(state.allocations()) / static_cast<double>(operations);
+        const double mb_per_sec = static_cast<double>(state.bytesPerIteration()) * ops_per_sec / (1024.0 * 1024.0);
+        const auto operation_count = static_cast<unsigned long long>(operations);
+
+        if (options.csv) {
+            std::printf("%s,%llu,%.2f,%.0f,%.3f,%.2f\n", benchmark.name, operation_count, ns_per_op, ops_per_sec,
+                        allocs_per_op, mb_per_sec);
+        } else {
+            std::printf("%-44s %12llu %14.1f %14.0f %12.2f %10.1f\n", benchmark.name, operation_count, ns_per_op,
+                        ops_per_sec, allocs_per_op, mb_per_sec);
+        }
+        std::fflush(stdout);
+    }
+    return 0;
+}
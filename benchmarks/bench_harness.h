@@ -0,0 +1,180 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file bench_harness.h
+ *
+ * @brief Minimal, dependency-free microbenchmark harness for vnelogging.
+ *
+ * Benchmarks are free functions taking a BenchState and registered with
+ * VNE_BENCHMARK. Only the body of the `while (state.keepRunning())` loop is timed,
+ * so per-benchmark setup and teardown stay outside the measurement. The
+ * harness calibrates the iteration count until a run lasts long enough to be
+ * stable, and reports time per operation, throughput and heap allocations
+ * per operation (counted by a replacement global operator new).
+ */
+
+namespace vne::log::bench {
+
+/**
+ * @brief Returns the number of heap allocations made by the process so far.
+ *
+ * @return Total count of calls to global operator new.
+ */
+[[nodiscard]] uint64_t allocationCount();
+
+/**
+ * @class BenchState
+ * @brief Controls the timed loop of a single benchmark run.
+ */
+class BenchState {
+   public:
+    /**
+     * @brief Constructs a state for a run of the given number of iterations.
+     *
+     * @param iterations The number of times the timed loop body runs.
+     */
+    explicit BenchState(uint64_t iterations)
+        : iterations_(iterations)
+        , remaining_(iterations) {}
+
+    /**
+     * @brief Advances the timed loop.
+     *
+     * The first call starts the clock; the call that returns false stops it.
+     * Use as `while (state.keepRunning()) { ... }`.
+     *
+     * @return True while iterations remain.
+     */
+    bool keepRunning() {
+        if (!started_) {
+            started_ = true;
+            startTiming();
+        }
+        if (remaining_ == 0) {
+            stopTiming();
+            return false;
+        }
+        --remaining_;
+        return true;
+    }
+
+    /**
+     * @brief Returns the number of iterations of this run.
+     */
+    [[nodiscard]] uint64_t iterations() const { return iterations_; }
+
+    /**
+     * @brief Returns the elapsed time of the timed loop in nanoseconds.
+     */
+    [[nodiscard]] double elapsedNs() const { return elapsed_ns_; }
+
+    /**
+     * @brief Returns the heap allocations made inside the timed loop.
+     */
+    [[nodiscard]] uint64_t allocations() const { return allocations_; }
+
+    /**
+     * @brief Records how many operations one loop iteration performs.
+     *
+     * Results are reported per operation, so a benchmark that logs a batch of
+     * messages per iteration still reports the cost of a single message.
+     *
+     * @param items Operations per iteration (default 1).
+     */
+    void setItemsPerIteration(uint64_t items) { items_per_iteration_ = items; }
+
+    /**
+     * @brief Returns the number of operations per iteration.
+     */
+    [[nodiscard]] uint64_t itemsPerIteration() const { return items_per_iteration_; }
+
+    /**
+     * @brief Records the number of payload bytes processed per operation.
+     *
+     * @param bytes Bytes per operation, reported as MB/s.
+     */
+    void setBytesPerIteration(uint64_t bytes) { bytes_per_iteration_ = bytes; }
+
+    /**
+     * @brief Returns the payload bytes per operation, or 0 if not set.
+     */
+    [[nodiscard]] uint64_t bytesPerIteration() const { return bytes_per_iteration_; }
+
+   private:
+    void startTiming() {
+        allocations_start_ = allocationCount();
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    void stopTiming() {
+        auto stop = std::chrono::steady_clock::now();
+        allocations_ = allocationCount() - allocations_start_;
+        elapsed_ns_ = std::chrono::duration<double, std::nano>(stop - start_).count();
+    }
+
+   private:
+    uint64_t iterations_;
+    uint64_t remaining_;
+    bool started_ = false;
+    uint64_t allocations_start_ = 0;
+    uint64_t allocations_ = 0;
+    uint64_t items_per_iteration_ = 1;
+    uint64_t bytes_per_iteration_ = 0;
+    double elapsed_ns_ = 0.0;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/// Signature of a benchmark body.
+using BenchFunction = void (*)(BenchState&);
+
+/**
+ * @brief Registers a benchmark with the harness.
+ *
+ * @param name The benchmark name, conventionally "<stage>/<case>".
+ * @param function The benchmark body.
+ * @return Always true; lets registration run during static initialization.
+ */
+bool registerBenchmark(const char* name, BenchFunction function);
+
+/**
+ * @brief Prevents the compiler from optimizing away a computed value.
+ *
+ * @param value The value that must be considered used.
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* s_sink;
+    s_sink = &value;
+#endif
+}
+
+}  // namespace vne::log::bench
+
+#define VNE_BENCH_CONCAT_IMPL(a, b) a##b
+#define VNE_BENCH_CONCAT(a, b) VNE_BENCH_CONCAT_IMPL(a, b)
+
+/**
+ * @def VNE_BENCHMARK(NAME, FUNCTION)
+ * @brief Registers FUNCTION under NAME with the benchmark harness.
+ */
+#define VNE_BENCHMARK(NAME, FUNCTION)                                              \
+    [[maybe_unused]] static const bool VNE_BENCH_CONCAT(s_registered_, __LINE__) = \
+        ::vne::log::bench::registerBenchmark(NAME, FUNCTION)
@@ -0,0 +1,110 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define VNE_BENCH_HAS_TSC 1
+#endif
+
+/**
+ * @file cycle_clock.h
+ *
+ * @brief Low-overhead timestamp source for per-call latency measurement.
+ *
+ * Reads the CPU time-stamp counter on x86 and the virtual counter on AArch64
+ * (a few ns per read, no syscall), and falls back to steady_clock elsewhere.
+ * Ticks are converted to nanoseconds with a ratio calibrated against
+ * steady_clock once at start-up, and the cost of a back-to-back pair of reads
+ * is measured so it can be subtracted from every sample.
+ */
+
+namespace vne::log::bench {
+
+class CycleClock {
+   public:
+    /**
+     * @brief Reads the raw tick counter.
+     */
+    static uint64_t now() {
+#if defined(VNE_BENCH_HAS_TSC)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /**
+     * @brief Calibrates the tick rate and the read overhead.
+     *
+     * @param calibration_time How long to compare ticks against steady_clock.
+     */
+    explicit CycleClock(std::chrono::milliseconds calibration_time = std::chrono::milliseconds(100)) {
+        auto wall_start = std::chrono::steady_clock::now();
+        uint64_t ticks_start = now();
+        std::this_thread::sleep_for(calibration_time);
+        uint64_t ticks_end = now();
+        auto wall_end = std::chrono::steady_clock::now();
+
+        double wall_ns = std::chrono::duration<double, std::nano>(wall_end - wall_start).count();
+        ns_per_tick_ = wall_ns / static_cast<double>(std::max<uint64_t>(ticks_end - ticks_start, 1));
+
+        uint64_t min_overhead = UINT64_MAX;
+        for (int i = 0; i < 10000; ++i) {
+            uint64_t a = now();
+            uint64_t b = now();
+            min_overhead = std::min(min_overhead, b - a);
+        }
+        overhead_ticks_ = min_overhead;
+    }
+
+    /**
+     * @brief Converts a tick interval to nanoseconds, net of the read overhead.
+     *
+     * @param start Ticks read before the measured call.
+     * @param end Ticks read after the measured call.
+     * @return Elapsed nanoseconds.
+     */
+    [[nodiscard]] uint64_t elapsedNs(uint64_t start, uint64_t end) const {
+        uint64_t ticks = end - start;
+        ticks = ticks > overhead_ticks_ ? ticks - overhead_ticks_ : 0;
+        return static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick_);
+    }
+
+    /**
+     * @brief Returns the calibrated nanoseconds per tick.
+     */
+    [[nodiscard]] double nsPerTick() const { return ns_per_tick_; }
+
+    /**
+     * @brief Returns the measured cost of one read, in nanoseconds.
+     */
+    [[nodiscard]] double overheadNs() const { return static_cast<double>(overhead_ticks_) * ns_per_tick_; }
+
+   private:
+    double ns_per_tick_ = 1.0;
+    uint64_t overhead_ticks_ = 0;
+};
+
+}  // namespace vne::log::bench
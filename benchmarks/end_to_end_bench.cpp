@@ -0,0 +1,171 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "vertexnova/logging/logging.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @file end_to_end_bench.cpp
+ *
+ * @brief Full path from the VNE_LOG_* macro to a file, for sync and async loggers.
+ *
+ * The sustained benchmarks keep several producers logging into one async
+ * logger and count a batch only once it has been written, with the worker
+ * writing directly and with the pipelined backend (formatting on the worker,
+ * writing on the pipeline's I/O thread), and with 2 and 4 formatter threads
+ * formatting in parallel. The pipelined backend targets a sustained rate above
+ * 2M messages per second on a file sink; with formatter threads, throughput
+ * should grow with their number until the disk is the limit.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+CREATE_VNE_LOGGER_CATEGORY("bench.e2e")
+
+constexpr const char* kSyncLoggerName = "bench_e2e_sync";
+constexpr const char* kAsyncLoggerName = "bench_e2e_async";
+constexpr uint64_t kDrainBatch = 256;
+constexpr unsigned kSustainedProducers = 4;
+constexpr uint64_t kSustainedBatchPerProducer = 16384;
+
+/**
+ * @brief Registers a file-backed logger for the lifetime of a benchmark.
+ */
+template<typename LoggerType>
+class ScopedFileLogger {
+   public:
+    ScopedFileLogger(const char* name, const std::string& path)
+        : name_(name)
+        , logger_(std::make_shared<LoggerType>(name)) {
+        auto sink = std::make_unique<FileLogSink>(path, false);
+        sink->setPattern("%x [%l] [%n] %v");
+        logger_->addLogSink(std::move(sink));
+        logger_->setFlushLevel(LogLevel::eFatal);
+        LoggerController::registerLogger(logger_);
+    }
+
+    ~ScopedFileLogger() {
+        logger_->flush();
+        LoggerController::unregisterLogger(name_);
+    }
+
+    ScopedFileLogger(const ScopedFileLogger&) = delete;
+    ScopedFileLogger& operator=(const ScopedFileLogger&) = delete;
+
+    ILogger& logger() { return *logger_; }
+
+    LoggerType& typedLogger() { return static_cast<LoggerType&>(*logger_); }
+
+   private:
+    const char* name_;
+    std::shared_ptr<ILogger> logger_;
+};
+
+void endToEndSyncFile(bench::BenchState& state) {
+    ScopedFileLogger<SyncLogger> scoped(kSyncLoggerName, "bench_logs/e2e_sync.log");
+    int value = 0;
+    while (state.keepRunning()) {
+        VNE_LOG_INFO_L(kSyncLoggerName) << "Benchmark message #" << value++ << " with some additional data";
+    }
+}
+
+void endToEndSyncFiltered(bench::BenchState& state) {
+    ScopedFileLogger<SyncLogger> scoped(kSyncLoggerName, "bench_logs/e2e_sync.log");
+    int value = 0;
+    while (state.keepRunning()) {
+        VNE_LOG_DEBUG_L(kSyncLoggerName) << "Filtered message #" << value++;
+    }
+}
+
+// Producer-side cost only: the worker drains in the background, outside the timed loop.
+void endToEndAsyncFileProducer(bench::BenchState& state) {
+    ScopedFileLogger<AsyncLogger> scoped(kAsyncLoggerName, "bench_logs/e2e_async.log");
+    int value = 0;
+    while (state.keepRunning()) {
+        VNE_LOG_INFO_L(kAsyncLoggerName) << "Benchmark message #" << value++ << " with some additional data";
+    }
+}
+
+// Sustained throughput: each iteration logs a batch and waits until it has been written.
+void endToEndAsyncFileDrained(bench::BenchState& state) {
+    ScopedFileLogger<AsyncLogger> scoped(kAsyncLoggerName, "bench_logs/e2e_async.log");
+    state.setItemsPerIteration(kDrainBatch);
+    int value = 0;
+    while (state.keepRunning()) {
+        for (uint64_t i = 0; i < kDrainBatch; ++i) {
+            VNE_LOG_INFO_L(kAsyncLoggerName) << "Benchmark message #" << value++ << " with some additional data";
+        }
+        scoped.logger().flush();
+    }
+}
+
+// Each iteration: kSustainedProducers threads log their share of a large batch, then the batch is flushed.
+void runSustained(bench::BenchState& state, bool pipelined, size_t formatter_threads = 0) {
+    ScopedFileLogger<AsyncLogger> scoped(kAsyncLoggerName, "bench_logs/e2e_async_sustained.log");
+    scoped.typedLogger().setPipelined(pipelined, formatter_threads);
+    state.setItemsPerIteration(kSustainedProducers * kSustainedBatchPerProducer);
+
+    std::vector<std::thread> producers;
+    producers.reserve(kSustainedProducers);
+    while (state.keepRunning()) {
+        for (unsigned p = 0; p < kSustainedProducers; ++p) {
+            producers.emplace_back([p] {
+                for (uint64_t i = 0; i < kSustainedBatchPerProducer; ++i) {
+                    VNE_LOG_INFO_L(kAsyncLoggerName) << "Producer " << p << " message #" << i << " with some data";
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        producers.clear();
+        scoped.logger().flush();
+    }
+}
+
+void endToEndAsyncFileSustained(bench::BenchState& state) {
+    runSustained(state, false);
+}
+
+void endToEndAsyncFilePipelinedSustained(bench::BenchState& state) {
+    runSustained(state, true);
+}
+
+void endToEndAsyncFileParallel2Sustained(bench::BenchState& state) {
+    runSustained(state, true, 2);
+}
+
+void endToEndAsyncFileParallel4Sustained(bench::BenchState& state) {
+    runSustained(state, true, 4);
+}
+
+}  // namespace
+
+VNE_BENCHMARK("e2e/sync_file", endToEndSyncFile);
+VNE_BENCHMARK("e2e/sync_filtered", endToEndSyncFiltered);
+VNE_BENCHMARK("e2e/async_file_producer", endToEndAsyncFileProducer);
+VNE_BENCHMARK("e2e/async_file_drained", endToEndAsyncFileDrained);
+VNE_BENCHMARK("e2e/async_file_sustained", endToEndAsyncFileSustained);
+VNE_BENCHMARK("e2e/async_file_pipelined_sustained", endToEndAsyncFilePipelinedSustained);
+VNE_BENCHMARK("e2e/async_file_parallel2_sustained", endToEndAsyncFileParallel2Sustained);
+VNE_BENCHMARK("e2e/async_file_parallel4_sustained", endToEndAsyncFileParallel4Sustained);
@@ -0,0 +1,322 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "cycle_clock.h"
+#include "latency_histogram.h"
+#include "null_log_sink.h"
+
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/console_log_sink.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "vertexnova/logging/logging.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @file latency_bench.cpp
+ *
+ * @brief Per-call latency percentiles of VNE_LOG_* under a sweep of producer
+ * threads, message sizes, sink types and sync/async mode.
+ *
+ * Every call is timed with the cycle counter (read overhead subtracted) and
+ * recorded into a per-thread HDR-style histogram; histograms are merged per
+ * scenario and reported as p50/p90/p99/p99.9/p99.99/max. Results go to stdout
+ * and, optionally, to CSV and JSON files for tracking across releases.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+CREATE_VNE_LOGGER_CATEGORY("bench.latency")
+
+constexpr const char* kLoggerName = "latency_bench";
+constexpr size_t kWarmupMessages = 1000;
+constexpr double kPercentiles[] = {50.0, 90.0, 99.0, 99.9, 99.99};
+
+struct Options {
+    std::vector<size_t> threads;
+    std::vector<size_t> sizes = {16, 128, 1024};
+    std::vector<std::string> sinks = {"null", "file"};
+    std::vector<std::string> modes = {"sync", "async"};
+    size_t messages_per_thread = 20000;
+    std::string csv_path;
+    std::string json_path;
+};
+
+struct Scenario {
+    std::string mode;
+    std::string sink;
+    size_t threads;
+    size_t message_size;
+};
+
+struct ScenarioResult {
+    Scenario scenario;
+    bench::LatencyHistogram histogram;
+    double elapsed_s = 0.0;
+};
+
+std::vector<std::string> split(std::string_view value) {
+    std::vector<std::string> parts;
+    std::stringstream stream{std::string(value)};
+    std::string part;
+    while (std::getline(stream, part, ',')) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+std::vector<size_t> splitNumbers(std::string_view value) {
+    std::vector<size_t> numbers;
+    for (const auto& part : split(value)) {
+        numbers.push_back(static_cast<size_t>(std::strtoull(part.c_str(), nullptr, 10)));
+    }
+    return numbers;
+}
+
+std::vector<size_t> defaultThreadSweep() {
+    size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<size_t> threads;
+    for (size_t n = 1; n < max_threads; n *= 2) {
+        threads.push_back(n);
+    }
+    threads.push_back(max_threads);
+    return threads;
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&arg](std::string_view prefix) { return arg.substr(prefix.size()); };
+        if (arg.rfind("--threads=", 0) == 0) {
+            options.threads = splitNumbers(value("--threads="));
+        } else if (arg.rfind("--sizes=", 0) == 0) {
+            options.sizes = splitNumbers(value("--sizes="));
+        } else if (arg.rfind("--sinks=", 0) == 0) {
+            options.sinks = split(value("--sinks="));
+        } else if (arg.rfind("--modes=", 0) == 0) {
+            options.modes = split(value("--modes="));
+        } else if (arg.rfind("--messages=", 0) == 0) {
+            options.messages_per_thread = static_cast<size_t>(std::strtoull(argv[i] + 11, nullptr, 10));
+        } else if (arg.rfind("--csv=", 0) == 0) {
+            options.csv_path = std::string(value("--csv="));
+        } else if (arg.rfind("--json=", 0) == 0) {
+            options.json_path = std::string(value("--json="));
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--threads=1,2,4] [--sizes=16,128,1024] [--sinks=null,file,console]\n"
+                         "          [--modes=sync,async] [--messages=<per thread>] [--csv=<file>] [--json=<file>]\n",
+                         argv[0]);
+            std::exit(2);
+        }
+    }
+    if (options.threads.empty()) {
+        options.threads = defaultThreadSweep();
+    }
+    return options;
+}
+
+std::unique_ptr<ILogSink> makeSink(const std::string& sink_type) {
+    if (sink_type == "file") {
+        auto sink = std::make_unique<FileLogSink>("bench_logs/latency_bench.log", false);
+        sink->setPattern("%x [%l] [%n] %v");
+        return sink;
+    }
+    if (sink_type == "console") {
+        auto sink = std::make_unique<ConsoleLogSink>();
+        sink->setPattern("%x [%l] [%n] %v");
+        return sink;
+    }
+    return std::make_unique<bench::NullLogSink>();
+}
+
+ScenarioResult runScenario(const Scenario& scenario, const Options& options, const bench::CycleClock& clock) {
+    std::shared_ptr<ILogger> logger;
+    if (scenario.mode == "async") {
+        logger = std::make_shared<AsyncLogger>(kLoggerName);
+    } else {
+        logger = std::make_shared<SyncLogger>(kLoggerName);
+    }
+    logger->addLogSink(makeSink(scenario.sink));
+    logger->setFlushLevel(LogLevel::eFatal);
+    LoggerController::registerLogger(logger);
+
+    const std::string payload(scenario.message_size, 'x');
+    std::vector<bench::LatencyHistogram> histograms(scenario.threads);
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+
+    auto producer = [&](size_t index) {
+        bench::LatencyHistogram& histogram = histograms[index];
+        for (size_t i = 0; i < kWarmupMessages; ++i) {
+            VNE_LOG_INFO_L(kLoggerName) << payload;
+        }
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < options.messages_per_thread; ++i) {
+            uint64_t start = bench::CycleClock::now();
+            VNE_LOG_INFO_L(kLoggerName) << payload;
+            uint64_t end = bench::CycleClock::now();
+            histogram.record(clock.elapsedNs(start, end));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < scenario.threads; ++i) {
+        threads.emplace_back(producer, i);
+    }
+    while (ready.load() != scenario.threads) {
+        std::this_thread::yield();
+    }
+    logger->flush();
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger->flush();
+    auto end = std::chrono::steady_clock::now();
+
+    LoggerController::unregisterLogger(kLoggerName);
+
+    ScenarioResult result;
+    result.scenario = scenario;
+    for (const auto& histogram : histograms) {
+        result.histogram.merge(histogram);
+    }
+    result.elapsed_s = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+double throughput(const ScenarioResult& result) {
+    return result.elapsed_s > 0.0 ? static_cast<double>(result.histogram.count()) / result.elapsed_s : 0.0;
+}
+
+void printHeader() {
+    std::printf("%-6s %-8s %7s %6s %12s %9s %9s %9s %9s %10s %10s\n", "mode", "sink", "threads", "bytes", "msgs/s",
+                "p50(ns)", "p90", "p99", "p99.9", "p99.99", "max");
+    std::printf("%s\n", std::string(108, '-').c_str());
+}
+
+void printResult(const ScenarioResult& result) {
+    const auto& h = result.histogram;
+    std::printf("%-6s %-8s %7zu %6zu %12.0f %9llu %9llu %9llu %9llu %10llu %10llu\n",
+                result.scenario.mode.c_str(),
+                result.scenario.sink.c_str(),
+                result.scenario.threads,
+                result.scenario.message_size,
+                throughput(result),
+                static_cast<unsigned long long>(h.valueAtPercentile(50.0)),
+                static_cast<unsigned long long>(h.valueAtPercentile(90.0)),
+                static_cast<unsigned long long>(h.valueAtPercentile(99.0)),
+                static_cast<unsigned long long>(h.valueAtPercentile(99.9)),
+                static_cast<unsigned long long>(h.valueAtPercentile(99.99)),
+                static_cast<unsigned long long>(h.max()));
+    std::fflush(stdout);
+}
+
+void writeCsv(const std::string& path, const std::vector<ScenarioResult>& results) {
+    std::ofstream out(path);
+    out << "mode,sink,threads,message_size,messages,msgs_per_sec,mean_ns,p50_ns,p90_ns,p99_ns,p99_9_ns,p99_99_ns,"
+           "max_ns\n";
+    for (const auto& result : results) {
+        const auto& h = result.histogram;
+        out << result.scenario.mode << ',' << result.scenario.sink << ',' << result.scenario.threads << ','
+            << result.scenario.message_size << ',' << h.count() << ',' << static_cast<uint64_t>(throughput(result))
+            << ',' << static_cast<uint64_t>(h.mean());
+        for (double percentile : kPercentiles) {
+            out << ',' << h.valueAtPercentile(percentile);
+        }
+        out << ',' << h.max() << '\n';
+    }
+}
+
+void writeJson(const std::string& path, const std::vector<ScenarioResult>& results, const bench::CycleClock& clock) {
+    std::ofstream out(path);
+    out << "{\n  \"benchmark\": \"vnelogging_latency_bench\",\n";
+    out << "  \"clock_overhead_ns\": " << clock.overheadNs() << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        const auto& h = result.histogram;
+        out << "    {\"mode\": \"" << result.scenario.mode << "\", \"sink\": \"" << result.scenario.sink
+            << "\", \"threads\": " << result.scenario.threads << ", \"message_size\": "
+            << result.scenario.message_size << ", \"messages\": " << h.count()
+            << ", \"msgs_per_sec\": " << static_cast<uint64_t>(throughput(result))
+            << ", \"mean_ns\": " << static_cast<uint64_t>(h.mean()) << ", \"p50_ns\": " << h.valueAtPercentile(50.0)
+            << ", \"p90_ns\": " << h.valueAtPercentile(90.0) << ", \"p99_ns\": " << h.valueAtPercentile(99.0)
+            << ", \"p99_9_ns\": " << h.valueAtPercentile(99.9) << ", \"p99_99_ns\": " << h.valueAtPercentile(99.99)
+            << ", \"max_ns\": " << h.max() << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+
+    bench::CycleClock clock;
+    std::printf("=== VNE Logging Latency Benchmark ===\n");
+    std::printf("Messages per thread: %zu, clock read overhead: %.1f ns (subtracted)\n\n",
+                options.messages_per_thread,
+                clock.overheadNs());
+
+    // Console output goes to a null buffer so the terminal does not dominate the numbers.
+    bench::NullBuffer null_buffer;
+    std::vector<ScenarioResult> results;
+
+    printHeader();
+    for (const auto& mode : options.modes) {
+        for (const auto& sink : options.sinks) {
+            for (size_t threads : options.threads) {
+                for (size_t size : options.sizes) {
+                    ScenarioResult result;
+                    {
+                        bench::ScopedCoutRedirect redirect(&null_buffer);
+                        result = runScenario({mode, sink, threads, size}, options, clock);
+                    }
+                    printResult(result);
+                    results.push_back(std::move(result));
+                }
+            }
+        }
+    }
+
+    if (!options.csv_path.empty()) {
+        writeCsv(options.csv_path, results);
+        std::printf("\nCSV written to %s\n", options.csv_path.c_str());
+    }
+    if (!options.json_path.empty()) {
+        writeJson(options.json_path, results, clock);
+        std::printf("JSON written to %s\n", options.json_path.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,162 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+/**
+ * @file latency_histogram.h
+ *
+ * @brief HDR-style log-linear latency histogram.
+ *
+ * Values are bucketed by their power of two, and each power of two is split
+ * into kSubBucketHalfCount linear sub-buckets, giving a constant relative
+ * precision (better than 1/kSubBucketHalfCount, i.e. ~1.6%) over the whole
+ * range from 1 ns to hours. Recording is a couple of shifts and an increment,
+ * so it does not perturb the latency being measured. Each producer thread
+ * records into its own histogram; results are merged afterwards.
+ */
+
+namespace vne::log::bench {
+
+class LatencyHistogram {
+   public:
+    static constexpr int kSubBucketBits = 7;                             //!< log2 of sub-buckets per bucket
+    static constexpr uint64_t kSubBucketCount = 1ULL << kSubBucketBits;  //!< 128
+    static constexpr uint64_t kSubBucketHalfCount = kSubBucketCount / 2;
+    static constexpr int kBucketCount = 64 - kSubBucketBits + 1;
+    static constexpr size_t kCountsSize = static_cast<size_t>(kBucketCount) * kSubBucketHalfCount
+                                          + kSubBucketHalfCount;
+
+    /**
+     * @brief Records a single value.
+     *
+     * @param value The value to record, typically nanoseconds.
+     */
+    void record(uint64_t value) {
+        ++counts_[indexOf(value)];
+        ++total_count_;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+        sum_ += value;
+    }
+
+    /**
+     * @brief Adds all values recorded in another histogram.
+     *
+     * @param other The histogram to merge into this one.
+     */
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < kCountsSize; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_count_ += other.total_count_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        sum_ += other.sum_;
+    }
+
+    /**
+     * @brief Returns the number of recorded values.
+     */
+    [[nodiscard]] uint64_t count() const { return total_count_; }
+
+    /**
+     * @brief Returns the smallest recorded value, or 0 if empty.
+     */
+    [[nodiscard]] uint64_t min() const { return total_count_ ? min_ : 0; }
+
+    /**
+     * @brief Returns the largest recorded value (exact).
+     */
+    [[nodiscard]] uint64_t max() const { return max_; }
+
+    /**
+     * @brief Returns the arithmetic mean of the recorded values.
+     */
+    [[nodiscard]] double mean() const {
+        return total_count_ ? static_cast<double>(sum_) / static_cast<double>(total_count_) : 0.0;
+    }
+
+    /**
+     * @brief Returns the value at the given percentile.
+     *
+     * The result is the highest value equivalent to the bucket holding the
+     * percentile, so it never under-reports. 100 returns the exact maximum.
+     *
+     * @param percentile Percentile in [0, 100].
+     * @return The value at that percentile, or 0 if empty.
+     */
+    [[nodiscard]] uint64_t valueAtPercentile(double percentile) const {
+        if (total_count_ == 0) {
+            return 0;
+        }
+        if (percentile >= 100.0) {
+            return max_;
+        }
+        auto target = static_cast<uint64_t>((std::max(percentile, 0.0) / 100.0) * static_cast<double>(total_count_)
+                                            + 0.5);
+        target = std::clamp<uint64_t>(target, 1, total_count_);
+        uint64_t running = 0;
+        for (size_t i = 0; i < kCountsSize; ++i) {
+            running += counts_[i];
+            if (running >= target) {
+                return std::min(highestEquivalentValue(i), max_);
+            }
+        }
+        return max_;
+    }
+
+    /**
+     * @brief Clears all recorded values.
+     */
+    void reset() {
+        counts_.fill(0);
+        total_count_ = 0;
+        min_ = UINT64_MAX;
+        max_ = 0;
+        sum_ = 0;
+    }
+
+   private:
+    static int bucketOf(uint64_t value) {
+        // Index of the highest set bit, with everything below kSubBucketCount in bucket 0.
+        int msb = static_cast<int>(std::bit_width(value | (kSubBucketCount - 1))) - 1;
+        return msb - (kSubBucketBits - 1);
+    }
+
+    static size_t indexOf(uint64_t value) {
+        int bucket = bucketOf(value);
+        uint64_t sub_bucket = value >> bucket;
+        return static_cast<size_t>(bucket) * kSubBucketHalfCount + sub_bucket;
+    }
+
+    static uint64_t highestEquivalentValue(size_t index) {
+        if (index < kSubBucketCount) {
+            return index;
+        }
+        size_t bucket = (index - kSubBucketHalfCount) / kSubBucketHalfCount;
+        uint64_t sub_bucket = index - bucket * kSubBucketHalfCount;
+        return ((sub_bucket + 1) << bucket) - 1;
+    }
+
+   private:
+    std::array<uint64_t, kCountsSize> counts_{};
+    uint64_t total_count_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+    uint64_t sum_ = 0;
+};
+
+}  // namespace vne::log::bench
@@ -0,0 +1,67 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+
+#include "vertexnova/logging/core/log_formatter.h"
+
+#include <string>
+
+/**
+ * @file log_formatter_bench.cpp
+ *
+ * @brief LogFormatter::format cost per pattern token.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+const std::string kCategory = "bench.category";
+const std::string kMessage = "Benchmark message #42 with some additional data for realistic size";
+const std::string kFile = "/home/user/project/src/engine/render/frame_graph.cpp";
+const std::string kFunction = "executePass";
+
+template<const char* kPattern>
+void formatPattern(bench::BenchState& state) {
+    const std::string pattern(kPattern);
+    while (state.keepRunning()) {
+        bench::doNotOptimize(
+            LogFormatter::format(kCategory, LogLevel::eInfo, TimeStampType::eLocal, kMessage, kFile, kFunction, 128,
+                                 pattern));
+    }
+}
+
+constexpr char kLiteral[] = "plain text without tokens";
+constexpr char kTimestamp[] = "%x";
+constexpr char kCategoryToken[] = "%n";
+constexpr char kLevel[] = "%l";
+constexpr char kThread[] = "%t";
+constexpr char kFileToken[] = "%$";
+constexpr char kFunctionToken[] = "%!";
+constexpr char kLine[] = "%#";
+constexpr char kMessageToken[] = "%v";
+constexpr char kDefaultPattern[] = "%x [%l] [%n] :: %v : [%!], [%#]";
+constexpr char kConsolePattern[] = "%x [%l] %v";
+
+}  // namespace
+
+VNE_BENCHMARK("formatter/literal", formatPattern<kLiteral>);
+VNE_BENCHMARK("formatter/token_x_timestamp", formatPattern<kTimestamp>);
+VNE_BENCHMARK("formatter/token_n_category", formatPattern<kCategoryToken>);
+VNE_BENCHMARK("formatter/token_l_level", formatPattern<kLevel>);
+VNE_BENCHMARK("formatter/token_t_thread", formatPattern<kThread>);
+VNE_BENCHMARK("formatter/token_$_file", formatPattern<kFileToken>);
+VNE_BENCHMARK("formatter/token_!_function", formatPattern<kFunctionToken>);
+VNE_BENCHMARK("formatter/token_#_line", formatPattern<kLine>);
+VNE_BENCHMARK("formatter/token_v_message", formatPattern<kMessageToken>);
+VNE_BENCHMARK("formatter/default_pattern", formatPattern<kDefaultPattern>);
+VNE_BENCHMARK("formatter/console_pattern", formatPattern<kConsolePattern>);
@@ -0,0 +1,68 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+
+#include "vertexnova/logging/core/log_queue.h"
+
+#include <functional>
+#include <string>
+
+/**
+ * @file log_queue_bench.cpp
+ *
+ * @brief LogQueue push/pop cost on a single thread, without contention.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+constexpr size_t kBatch = 64;
+
+void logQueuePushPopEmptyTask(bench::BenchState& state) {
+    LogQueue queue;
+    while (state.keepRunning()) {
+        queue.push([] {});
+        queue.pop()();
+    }
+}
+
+// A task capturing what LogDispatcher captures for one record.
+void logQueuePushPopRecordTask(bench::BenchState& state) {
+    LogQueue queue;
+    const std::string message = "Benchmark message with some additional data for realistic size";
+    const std::string file = "/home/user/project/src/engine/render/frame_graph.cpp";
+    while (state.keepRunning()) {
+        queue.push([message, file, line = 42u] { bench::doNotOptimize(line); });
+        queue.pop()();
+    }
+}
+
+void logQueuePushDrainBatch(bench::BenchState& state) {
+    LogQueue queue;
+    state.setItemsPerIteration(kBatch);
+    while (state.keepRunning()) {
+        for (size_t i = 0; i < kBatch; ++i) {
+            queue.push([] {});
+        }
+        auto batch = queue.drain(kBatch);
+        for (auto& task : batch) {
+            task();
+        }
+    }
+}
+
+}  // namespace
+
+VNE_BENCHMARK("log_queue/push_pop_empty_task", logQueuePushPopEmptyTask);
+VNE_BENCHMARK("log_queue/push_pop_record_task", logQueuePushPopRecordTask);
+VNE_BENCHMARK("log_queue/push_drain_batch", logQueuePushDrainBatch);
@@ -0,0 +1,67 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+#include "null_log_sink.h"
+
+#include "vertexnova/logging/core/console_log_sink.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+
+#include <string>
+
+/**
+ * @file log_sink_bench.cpp
+ *
+ * @brief ConsoleLogSink and FileLogSink write cost, including formatting.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+const std::string kCategory = "bench.category";
+const std::string kMessage = "Benchmark message #42 with some additional data for realistic size";
+const std::string kFile = "/home/user/project/src/engine/render/frame_graph.cpp";
+const std::string kFunction = "executePass";
+
+void consoleSinkWrite(bench::BenchState& state) {
+    bench::NullBuffer null_buffer;
+    bench::ScopedCoutRedirect redirect(&null_buffer);
+    ConsoleLogSink sink;
+    state.setBytesPerIteration(kMessage.size());
+    while (state.keepRunning()) {
+        sink.log(kCategory, LogLevel::eInfo, TimeStampType::eLocal, kMessage, kFile, kFunction, 128);
+    }
+}
+
+void fileSinkWrite(bench::BenchState& state) {
+    FileLogSink sink("bench_logs/file_sink_bench.log", false);
+    state.setBytesPerIteration(kMessage.size());
+    while (state.keepRunning()) {
+        sink.log(kCategory, LogLevel::eInfo, TimeStampType::eLocal, kMessage, kFile, kFunction, 128);
+    }
+    sink.flush();
+}
+
+void fileSinkWriteAndFlush(bench::BenchState& state) {
+    FileLogSink sink("bench_logs/file_sink_flush_bench.log", false);
+    state.setBytesPerIteration(kMessage.size());
+    while (state.keepRunning()) {
+        sink.log(kCategory, LogLevel::eInfo, TimeStampType::eLocal, kMessage, kFile, kFunction, 128);
+        sink.flush();
+    }
+}
+
+}  // namespace
+
+VNE_BENCHMARK("sink/console_write", consoleSinkWrite);
+VNE_BENCHMARK("sink/file_write", fileSinkWrite);
+VNE_BENCHMARK("sink/file_write_flush", fileSinkWriteAndFlush);
@@ -0,0 +1,130 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/log_stream.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+
+#include <memory>
+#include <string>
+
+/**
+ * @file log_stream_bench.cpp
+ *
+ * @brief LogStream construction, streaming and the level check in its destructor.
+ *
+ * The logger has no sinks, so these numbers isolate the front end: building the
+ * stream, formatting the arguments, looking the logger up and filtering.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+constexpr const char* kLoggerName = "bench_stream";
+constexpr const char* kMissingLoggerName = "bench_stream_missing";
+
+class ScopedLogger {
+   public:
+    explicit ScopedLogger(LogLevel level) {
+        auto logger = std::make_shared<SyncLogger>(kLoggerName);
+        logger->setCurrentLogLevel(level);
+        LoggerController::registerLogger(logger);
+    }
+
+    ~ScopedLogger() { LoggerController::unregisterLogger(kLoggerName); }
+
+    ScopedLogger(const ScopedLogger&) = delete;
+    ScopedLogger& operator=(const ScopedLogger&) = delete;
+};
+
+void logStreamConstructOnly(bench::BenchState& state) {
+    ScopedLogger logger(LogLevel::eInfo);
+    while (state.keepRunning()) {
+        LogStream stream(kLoggerName, "bench", LogLevel::eInfo, TimeStampType::eLocal, __FILE__, __func__, __LINE__);
+    }
+}
+
+void logStreamStreamString(bench::BenchState& state) {
+    ScopedLogger logger(LogLevel::eInfo);
+    while (state.keepRunning()) {
+        LogStream(kLoggerName, "bench", LogLevel::eInfo, TimeStampType::eLocal, __FILE__, __func__, __LINE__)
+            << "Benchmark message with some additional data for realistic size";
+    }
+}
+
+void logStreamStreamMixed(bench::BenchState& state) {
+    ScopedLogger logger(LogLevel::eInfo);
+    int value = 0;
+    while (state.keepRunning()) {
+        LogStream(kLoggerName, "bench", LogLevel::eInfo, TimeStampType::eLocal, __FILE__, __func__, __LINE__)
+            << "Benchmark message #" << value++ << " took " << 1.5 << " ms";
+    }
+}
+
+void logStreamFilteredByLevel(bench::BenchState& state) {
+    ScopedLogger logger(LogLevel::eWarn);
+    int value = 0;
+    while (state.keepRunning()) {
+        LogStream(kLoggerName, "bench", LogLevel::eDebug, TimeStampType::eLocal, __FILE__, __func__, __LINE__)
+            << "Filtered message #" << value++;
+    }
+}
+
+void logStreamMissingLogger(bench::BenchState& state) {
+    int value = 0;
+    while (state.keepRunning()) {
+        LogStream(kMissingLoggerName, "bench", LogLevel::eInfo, TimeStampType::eLocal, __FILE__, __func__, __LINE__)
+            << "Dropped message #" << value++;
+    }
+}
+
+void logMacroString(bench::BenchState& state) {
+    ScopedLogger logger(LogLevel::eInfo);
+    while (state.keepRunning()) {
+        VNE_LOG_INFO_LC(kLoggerName, "bench") << "Benchmark message with some additional data for realistic size";
+    }
+}
+
+void logMacroStringProfiled(bench::BenchState& state) {
+    ScopedLogger logger(LogLevel::eInfo);
+    Logging::setLogProfilingEnabled(true);
+    while (state.keepRunning()) {
+        VNE_LOG_INFO_LC(kLoggerName, "bench") << "Benchmark message with some additional data for realistic size";
+    }
+    Logging::setLogProfilingEnabled(false);
+    Logging::resetLogProfile();
+}
+
+void logMacroDisabledCallSite(bench::BenchState& state) {
+    ScopedLogger logger(LogLevel::eInfo);
+    const uint32_t line = __LINE__ + 4;
+    Logging::disableCallSites("log_stream_bench.cpp:" + std::to_string(line));
+    int value = 0;
+    while (state.keepRunning()) {
+        VNE_LOG_INFO_LC(kLoggerName, "bench") << "Disabled message #" << value++;
+    }
+    Logging::resetCallSites();
+}
+
+}  // namespace
+
+VNE_BENCHMARK("log_stream/construct_only", logStreamConstructOnly);
+VNE_BENCHMARK("log_stream/stream_string", logStreamStreamString);
+VNE_BENCHMARK("log_stream/stream_mixed", logStreamStreamMixed);
+VNE_BENCHMARK("log_stream/filtered_by_level", logStreamFilteredByLevel);
+VNE_BENCHMARK("log_stream/missing_logger", logStreamMissingLogger);
+VNE_BENCHMARK("log_stream/macro_string", logMacroString);
+VNE_BENCHMARK("log_stream/macro_string_profiled", logMacroStringProfiled);
+VNE_BENCHMARK("log_stream/macro_disabled_call_site", logMacroDisabledCallSite);
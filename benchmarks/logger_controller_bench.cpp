@@ -0,0 +1,90 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+
+#include <memory>
+#include <string>
+
+/**
+ * @file logger_controller_bench.cpp
+ *
+ * @brief LoggerController::getLogger lookup cost, as paid once per log statement.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+constexpr int kRegisteredLoggers = 16;
+
+class ScopedRegistry {
+   public:
+    ScopedRegistry() {
+        for (int i = 0; i < kRegisteredLoggers; ++i) {
+            LoggerController::registerLogger(std::make_shared<SyncLogger>(name(i)));
+        }
+    }
+
+    ~ScopedRegistry() {
+        for (int i = 0; i < kRegisteredLoggers; ++i) {
+            LoggerController::unregisterLogger(name(i));
+        }
+    }
+
+    ScopedRegistry(const ScopedRegistry&) = delete;
+    ScopedRegistry& operator=(const ScopedRegistry&) = delete;
+
+    static std::string name(int index) { return "bench_controller_logger_" + std::to_string(index); }
+};
+
+void getLoggerFirst(bench::BenchState& state) {
+    ScopedRegistry registry;
+    const std::string name = ScopedRegistry::name(0);
+    while (state.keepRunning()) {
+        bench::doNotOptimize(LoggerController::getLogger(name));
+    }
+}
+
+void getLoggerLast(bench::BenchState& state) {
+    ScopedRegistry registry;
+    const std::string name = ScopedRegistry::name(kRegisteredLoggers - 1);
+    while (state.keepRunning()) {
+        bench::doNotOptimize(LoggerController::getLogger(name));
+    }
+}
+
+void getLoggerFromCString(bench::BenchState& state) {
+    ScopedRegistry registry;
+    const std::string name = ScopedRegistry::name(kRegisteredLoggers / 2);
+    const char* c_name = name.c_str();
+    while (state.keepRunning()) {
+        bench::doNotOptimize(LoggerController::getLogger(c_name));
+    }
+}
+
+void getLoggerMissing(bench::BenchState& state) {
+    ScopedRegistry registry;
+    const std::string name = "bench_controller_missing";
+    while (state.keepRunning()) {
+        bench::doNotOptimize(LoggerController::getLogger(name));
+    }
+}
+
+}  // namespace
+
+VNE_BENCHMARK("logger_controller/get_logger_first", getLoggerFirst);
+VNE_BENCHMARK("logger_controller/get_logger_last", getLoggerLast);
+VNE_BENCHMARK("logger_controller/get_logger_c_string", getLoggerFromCString);
+VNE_BENCHMARK("logger_controller/get_logger_missing", getLoggerMissing);
@@ -0,0 +1,87 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/logging/core/log_sink.h"
+
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+/**
+ * @file null_log_sink.h
+ *
+ * @brief Benchmark helpers that take I/O out of the measurement.
+ */
+
+namespace vne::log::bench {
+
+/**
+ * @class NullLogSink
+ * @brief Sink that discards records without formatting them.
+ *
+ * Measures the logging pipeline alone (front end, queue, dispatch), the same
+ * way spdlog's null_sink does.
+ */
+class NullLogSink : public ILogSink {
+   public:
+    NullLogSink() = default;
+
+    void log(const std::string& /*name*/,
+             LogLevel /*level*/,
+             TimeStampType /*time_stamp_type*/,
+             const std::string& /*message*/,
+             const std::string& /*file*/,
+             const std::string& /*function*/,
+             uint32_t /*line*/) override {}
+
+    void flush() override {}
+
+    [[nodiscard]] std::string getPattern() const override { return pattern_; }
+
+    void setPattern(const std::string& pattern) override { pattern_ = pattern; }
+
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override { return std::make_unique<NullLogSink>(); }
+
+   private:
+    std::string pattern_;
+};
+
+/**
+ * @class NullBuffer
+ * @brief Stream buffer that discards everything, so console numbers exclude the terminal.
+ */
+class NullBuffer : public std::streambuf {
+   protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char* /*s*/, std::streamsize n) override { return n; }
+};
+
+/**
+ * @class ScopedCoutRedirect
+ * @brief Redirects std::cout to another buffer for the lifetime of the object.
+ */
+class ScopedCoutRedirect {
+   public:
+    explicit ScopedCoutRedirect(std::streambuf* buffer)
+        : old_(std::cout.rdbuf(buffer)) {}
+
+    ~ScopedCoutRedirect() { std::cout.rdbuf(old_); }
+
+    ScopedCoutRedirect(const ScopedCoutRedirect&) = delete;
+    ScopedCoutRedirect& operator=(const ScopedCoutRedirect&) = delete;
+
+   private:
+    std::streambuf* old_;
+};
+
+}  // namespace vne::log::bench
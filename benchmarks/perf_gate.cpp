@@ -0,0 +1,473 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "cycle_clock.h"
+#include "latency_histogram.h"
+#include "null_log_sink.h"
+
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "vertexnova/logging/logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @file perf_gate.cpp
+ *
+ * @brief Performance regression gate: measures a fixed set of logging
+ * scenarios and compares them against a stored per-machine-class baseline.
+ *
+ * For every scenario the gate records throughput, p99 call latency and heap
+ * allocations per message (all threads) over several repetitions. A scenario regresses when throughput drops or p99 rises by more
+ * than the tolerance, or when allocations per message grow by more than the
+ * allocation tolerance. Exit codes: 0 pass, 1 regression, 2 usage error,
+ * 77 no baseline for this machine class (reported as skipped by ctest).
+ *
+ * Baselines are plain text, one "<scenario> <metric> <value>" per line, stored
+ * as <baseline-dir>/<machine-class>.txt and written with --update-baseline.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+CREATE_VNE_LOGGER_CATEGORY("bench.gate")
+
+constexpr const char* kLoggerName = "perf_gate";
+constexpr size_t kWarmupMessages = 2000;
+constexpr int kExitRegression = 1;
+constexpr int kExitUsage = 2;
+constexpr int kExitNoBaseline = 77;
+
+constexpr const char* kThroughputMetric = "msgs_per_sec";
+constexpr const char* kLatencyMetric = "p99_ns";
+constexpr const char* kAllocationMetric = "allocs_per_msg";
+
+std::atomic<uint64_t> g_allocation_count{0};
+
+struct Options {
+    std::string baseline_dir = "baselines";
+    std::string machine_class;
+    double tolerance_pct = 10.0;          //!< Allowed throughput drop
+    double latency_tolerance_pct = 25.0;  //!< Allowed p99 rise; tail latency is noisier than throughput
+    double alloc_tolerance = 0.05;        //!< Allowed rise in allocations per message (absolute)
+    size_t messages_per_thread = 50000;
+    size_t repetitions = 5;
+    bool update_baseline = false;
+    bool require_baseline = false;
+};
+
+struct Scenario {
+    const char* name;
+    const char* mode;
+    const char* sink;
+    size_t threads;
+};
+
+constexpr Scenario kScenarios[] = {
+    {"sync/null/1", "sync", "null", 1},
+    {"sync/file/1", "sync", "file", 1},
+    {"async/null/1", "async", "null", 1},
+    {"async/file/1", "async", "file", 1},
+    {"async/null/4", "async", "null", 4},
+};
+
+struct Measurement {
+    double msgs_per_sec = 0.0;
+    double p99_ns = 0.0;
+    double allocs_per_msg = 0.0;
+};
+
+/// Scenario name -> metric name -> value.
+using Baseline = std::map<std::string, std::map<std::string, double>>;
+
+void printUsage(const char* program) {
+    std::fprintf(stderr,
+                 "usage: %s [--baseline-dir=<dir>] [--machine-class=<name>] [--update-baseline]\n"
+                 "          [--tolerance=<pct>] [--latency-tolerance=<pct>] [--alloc-tolerance=<allocs/msg>]\n"
+                 "          [--messages=<per thread>] [--repetitions=<n>] [--require-baseline]\n",
+                 program);
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&arg](std::string_view prefix) { return std::string(arg.substr(prefix.size())); };
+        if (arg.rfind("--baseline-dir=", 0) == 0) {
+            options.baseline_dir = value("--baseline-dir=");
+        } else if (arg.rfind("--machine-class=", 0) == 0) {
+            options.machine_class = value("--machine-class=");
+        } else if (arg.rfind("--tolerance=", 0) == 0) {
+            options.tolerance_pct = std::atof(value("--tolerance=").c_str());
+        } else if (arg.rfind("--latency-tolerance=", 0) == 0) {
+            options.latency_tolerance_pct = std::atof(value("--latency-tolerance=").c_str());
+        } else if (arg.rfind("--alloc-tolerance=", 0) == 0) {
+            options.alloc_tolerance = std::atof(value("--alloc-tolerance=").c_str());
+        } else if (arg.rfind("--messages=", 0) == 0) {
+            options.messages_per_thread = static_cast<size_t>(std::strtoull(value("--messages=").c_str(), nullptr, 10));
+        } else if (arg.rfind("--repetitions=", 0) == 0) {
+            options.repetitions = static_cast<size_t>(std::strtoull(value("--repetitions=").c_str(), nullptr, 10));
+        } else if (arg == "--update-baseline") {
+            options.update_baseline = true;
+        } else if (arg == "--require-baseline") {
+            options.require_baseline = true;
+        } else {
+            printUsage(argv[0]);
+            std::exit(kExitUsage);
+        }
+    }
+    if (options.messages_per_thread == 0 || options.repetitions == 0) {
+        printUsage(argv[0]);
+        std::exit(kExitUsage);
+    }
+    return options;
+}
+
+/**
+ * @brief Returns the machine class used to pick a baseline file.
+ *
+ * An explicit --machine-class wins, then VNE_PERF_MACHINE_CLASS, then
+ * "<os>-<arch>-<n>cpu". Builds without NDEBUG get a "-debug" suffix so they
+ * are never compared against Release numbers.
+ */
+std::string machineClass(const Options& options) {
+    std::string machine_class = options.machine_class;
+    if (machine_class.empty()) {
+        if (const char* env = std::getenv("VNE_PERF_MACHINE_CLASS")) {
+            machine_class = env;
+        }
+    }
+    if (machine_class.empty()) {
+#if defined(__APPLE__)
+        machine_class = "macos";
+#elif defined(_WIN32)
+        machine_class = "windows";
+#elif defined(__linux__)
+        machine_class = "linux";
+#else
+        machine_class = "unknown";
+#endif
+#if defined(__x86_64__) || defined(_M_X64)
+        machine_class += "-x86_64";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        machine_class += "-arm64";
+#else
+        machine_class += "-other";
+#endif
+        machine_class += '-';
+        machine_class += std::to_string(std::max(std::thread::hardware_concurrency(), 1u));
+        machine_class += "cpu";
+    }
+#if !defined(NDEBUG)
+    machine_class += "-debug";
+#endif
+    return machine_class;
+}
+
+std::unique_ptr<ILogSink> makeSink(std::string_view sink_type) {
+    if (sink_type == "file") {
+        auto sink = std::make_unique<FileLogSink>("bench_logs/perf_gate.log", false);
+        sink->setPattern("%x [%l] [%n] %v");
+        return sink;
+    }
+    return std::make_unique<bench::NullLogSink>();
+}
+
+Measurement runScenario(const Scenario& scenario,
+                        ILogger& logger,
+                        const Options& options,
+                        const bench::CycleClock& clock) {
+    std::vector<bench::LatencyHistogram> histograms(scenario.threads);
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+
+    auto producer = [&](size_t index) {
+        bench::LatencyHistogram& histogram = histograms[index];
+        for (size_t i = 0; i < kWarmupMessages; ++i) {
+            VNE_LOG_INFO_L(kLoggerName) << "perf gate message " << i;
+        }
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < options.messages_per_thread; ++i) {
+            uint64_t start = bench::CycleClock::now();
+            VNE_LOG_INFO_L(kLoggerName) << "perf gate message " << i;
+            uint64_t end = bench::CycleClock::now();
+            histogram.record(clock.elapsedNs(start, end));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < scenario.threads; ++i) {
+        threads.emplace_back(producer, i);
+    }
+    while (ready.load() != scenario.threads) {
+        std::this_thread::yield();
+    }
+    logger.flush();
+
+    const uint64_t allocations_start = g_allocation_count.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger.flush();
+    auto end = std::chrono::steady_clock::now();
+    const uint64_t allocations = g_allocation_count.load(std::memory_order_relaxed) - allocations_start;
+
+    bench::LatencyHistogram merged;
+    for (const auto& histogram : histograms) {
+        merged.merge(histogram);
+    }
+    const auto messages = static_cast<double>(merged.count());
+    const double elapsed_s = std::chrono::duration<double>(end - start).count();
+
+    Measurement measurement;
+    measurement.msgs_per_sec = elapsed_s > 0.0 ? messages / elapsed_s : 0.0;
+    measurement.p99_ns = static_cast<double>(merged.valueAtPercentile(99.0));
+    measurement.allocs_per_msg = static_cast<double>(allocations) / messages;
+    return measurement;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+/**
+ * @brief Runs a scenario several times on one logger and summarizes the runs.
+ *
+ * The first run is discarded so the logger's record pool and queue have
+ * already grown to the scenario's backlog. Throughput and p99 are medians;
+ * allocations take the minimum, since extra allocations only come from that
+ * growth and a structural regression shows up in every run.
+ */
+Measurement measureScenario(const Scenario& scenario, const Options& options, const bench::CycleClock& clock) {
+    std::shared_ptr<ILogger> logger;
+    if (std::string_view(scenario.mode) == "async") {
+        logger = std::make_shared<AsyncLogger>(kLoggerName);
+    } else {
+        logger = std::make_shared<SyncLogger>(kLoggerName);
+    }
+    logger->addLogSink(makeSink(scenario.sink));
+    logger->setFlushLevel(LogLevel::eFatal);
+    LoggerController::registerLogger(logger);
+
+    runScenario(scenario, *logger, options, clock);
+    std::vector<double> throughputs;
+    std::vector<double> latencies;
+    std::vector<double> allocations;
+    for (size_t i = 0; i < options.repetitions; ++i) {
+        Measurement run = runScenario(scenario, *logger, options, clock);
+        throughputs.push_back(run.msgs_per_sec);
+        latencies.push_back(run.p99_ns);
+        allocations.push_back(run.allocs_per_msg);
+    }
+
+    LoggerController::unregisterLogger(kLoggerName);
+    return {median(throughputs), median(latencies), *std::min_element(allocations.begin(), allocations.end())};
+}
+
+bool readBaseline(const std::string& path, Baseline& baseline) {
+    std::ifstream in(path);
+    if (!in) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        std::string scenario;
+        std::string metric;
+        double value = 0.0;
+        if (fields >> scenario >> metric >> value) {
+            baseline[scenario][metric] = value;
+        }
+    }
+    return true;
+}
+
+bool writeBaseline(const std::string& path,
+                   const std::string& machine_class,
+                   const std::map<std::string, Measurement>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << "# vnelogging performance baseline\n";
+    out << "# machine class: " << machine_class << "\n";
+    out << "# <scenario> <metric> <value>; regenerate with vnelogging_perf_gate --update-baseline\n";
+    char buffer[128];
+    for (const auto& [name, measurement] : results) {
+        const char* scenario = name.c_str();
+        std::snprintf(buffer, sizeof(buffer), "%s %s %.0f\n", scenario, kThroughputMetric, measurement.msgs_per_sec);
+        out << buffer;
+        std::snprintf(buffer, sizeof(buffer), "%s %s %.0f\n", scenario, kLatencyMetric, measurement.p99_ns);
+        out << buffer;
+        std::snprintf(buffer, sizeof(buffer), "%s %s %.3f\n", scenario, kAllocationMetric, measurement.allocs_per_msg);
+        out << buffer;
+    }
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Prints one comparison row and returns true if the metric regressed.
+ *
+ * @param higher_is_better True for throughput, false for latency and allocations.
+ * @param allowed How far the value may move in the bad direction, in the metric's units.
+ */
+bool compareMetric(const std::string& scenario,
+                   const char* metric,
+                   const std::map<std::string, double>& baseline,
+                   double current,
+                   bool higher_is_better,
+                   double allowed) {
+    auto it = baseline.find(metric);
+    if (it == baseline.end()) {
+        std::printf("%-16s %-16s %14s %14.2f %9s  %s\n", scenario.c_str(), metric, "-", current, "-", "NEW");
+        return false;
+    }
+    const double expected = it->second;
+    const double change_pct = expected != 0.0 ? (current - expected) / expected * 100.0 : 0.0;
+    const double worse_by = higher_is_better ? expected - current : current - expected;
+    const char* status = "ok";
+    bool regressed = false;
+    if (worse_by > allowed) {
+        status = "REGRESSION";
+        regressed = true;
+    } else if (-worse_by > allowed) {
+        status = "improved";
+    }
+    std::printf("%-16s %-16s %14.2f %14.2f %+8.1f%%  %s\n", scenario.c_str(), metric, expected, current, change_pct,
+                status);
+    return regressed;
+}
+
+}  // namespace
+
+//==============================================================================
+// Allocation counting
+//==============================================================================
+
+void* operator new(std::size_t size) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+    const std::string machine_class = machineClass(options);
+    const std::string baseline_path = options.baseline_dir + "/" + machine_class + ".txt";
+
+    Baseline baseline;
+    const bool has_baseline = readBaseline(baseline_path, baseline);
+    if (!has_baseline && !options.update_baseline) {
+        std::printf("No baseline for machine class '%s' (%s).\n", machine_class.c_str(), baseline_path.c_str());
+        std::printf("Record one with: %s --baseline-dir=%s --update-baseline\n", argv[0], options.baseline_dir.c_str());
+        return options.require_baseline ? kExitRegression : kExitNoBaseline;
+    }
+
+    bench::CycleClock clock;
+    std::printf("=== VNE Logging Performance Gate ===\n");
+    std::printf("Machine class: %s, %zu messages/thread, median of %zu runs\n", machine_class.c_str(),
+                options.messages_per_thread, options.repetitions);
+    std::printf("Tolerances: throughput -%.1f%%, p99 +%.1f%%, allocations +%.3f/msg\n\n", options.tolerance_pct,
+                options.latency_tolerance_pct, options.alloc_tolerance);
+
+    bench::NullBuffer null_buffer;
+    std::map<std::string, Measurement> results;
+    for (const auto& scenario : kScenarios) {
+        bench::ScopedCoutRedirect redirect(&null_buffer);
+        results[scenario.name] = measureScenario(scenario, options, clock);
+    }
+
+    if (options.update_baseline) {
+        if (!writeBaseline(baseline_path, machine_class, results)) {
+            std::fprintf(stderr, "Failed to write %s\n", baseline_path.c_str());
+            return kExitUsage;
+        }
+        for (const auto& [name, measurement] : results) {
+            std::printf("%-16s %14.0f msgs/s %10.0f ns p99 %8.3f allocs/msg\n", name.c_str(), measurement.msgs_per_sec,
+                        measurement.p99_ns, measurement.allocs_per_msg);
+        }
+        std::printf("\nBaseline written to %s\n", baseline_path.c_str());
+        return 0;
+    }
+
+    std::printf("%-16s %-16s %14s %14s %9s  %s\n", "scenario", "metric", "baseline", "current", "change", "status");
+    std::printf("%s\n", std::string(86, '-').c_str());
+    size_t regressions = 0;
+    static const std::map<std::string, double> kEmpty;
+    for (const auto& [name, measurement] : results) {
+        auto it = baseline.find(name);
+        const auto& expected = it != baseline.end() ? it->second : kEmpty;
+        auto allowedFraction = [&expected](const char* metric, double pct) {
+            auto value = expected.find(metric);
+            return value != expected.end() ? value->second * pct / 100.0 : 0.0;
+        };
+        regressions += compareMetric(name, kThroughputMetric, expected, measurement.msgs_per_sec, true,
+                                     allowedFraction(kThroughputMetric, options.tolerance_pct));
+        regressions += compareMetric(name, kLatencyMetric, expected, measurement.p99_ns, false,
+                                     allowedFraction(kLatencyMetric, options.latency_tolerance_pct));
+        regressions += compareMetric(name, kAllocationMetric, expected, measurement.allocs_per_msg, false,
+                                     options.alloc_tolerance);
+    }
+
+    if (regressions > 0) {
+        std::printf("\n%zu metric(s) regressed against %s\n", regressions, baseline_path.c_str());
+        return kExitRegression;
+    }
+    std::printf("\nNo regressions against %s\n", baseline_path.c_str());
+    return 0;
+}
@@ -0,0 +1,311 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "cycle_clock.h"
+#include "latency_histogram.h"
+#include "null_log_sink.h"
+
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "vertexnova/logging/logging.h"
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * @file spdlog_compare_bench.cpp
+ *
+ * @brief Head-to-head benchmark of vnelogging against the bundled spdlog.
+ *
+ * Both libraries run the same workload: the same message with one integer
+ * argument, an equivalent pattern (timestamp, level, name, message), the same
+ * sink kind (null or file) and the same number of producer threads. Each call
+ * is timed with the cycle counter into an HDR-style histogram. Throughput is
+ * measured from the start of the timed phase until everything has been
+ * flushed, so async modes are charged for their backlog.
+ *
+ * Differences that cannot be removed: spdlog's async queue is bounded (here
+ * kSpdlogQueueSize, blocking when full) while the vnelogging queue is not, and
+ * spdlog's null sink skips formatting just like NullLogSink does.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+CREATE_VNE_LOGGER_CATEGORY("bench.compare")
+
+constexpr const char* kVneLoggerName = "compare_bench";
+constexpr const char* kSpdlogLoggerName = "bench.compare";
+constexpr const char* kVnePattern = "%x [%l] [%n] %v";
+constexpr const char* kSpdlogPattern = "%Y-%m-%d %H:%M:%S [%l] [%n] %v";
+constexpr size_t kSpdlogQueueSize = 1 << 17;
+constexpr size_t kWarmupMessages = 1000;
+
+struct Options {
+    std::vector<size_t> threads = {1, 2, 4, 8, 16};
+    std::vector<std::string> sinks = {"null", "file"};
+    std::vector<std::string> modes = {"sync", "async"};
+    size_t messages_per_thread = 50000;
+    std::string csv_path;
+};
+
+struct RunResult {
+    bench::LatencyHistogram histogram;
+    double elapsed_s = 0.0;
+
+    [[nodiscard]] double throughput() const {
+        return elapsed_s > 0.0 ? static_cast<double>(histogram.count()) / elapsed_s : 0.0;
+    }
+};
+
+/**
+ * @brief One library configured for one scenario: a log call and a flush.
+ */
+struct Workload {
+    std::function<void(int)> log;
+    std::function<void()> flush;
+    std::function<void()> teardown;
+};
+
+std::vector<std::string> split(std::string_view value) {
+    std::vector<std::string> parts;
+    std::stringstream stream{std::string(value)};
+    std::string part;
+    while (std::getline(stream, part, ',')) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        if (arg.rfind("--threads=", 0) == 0) {
+            options.threads.clear();
+            for (const auto& part : split(arg.substr(10))) {
+                options.threads.push_back(static_cast<size_t>(std::strtoull(part.c_str(), nullptr, 10)));
+            }
+        } else if (arg.rfind("--sinks=", 0) == 0) {
+            options.sinks = split(arg.substr(8));
+        } else if (arg.rfind("--modes=", 0) == 0) {
+            options.modes = split(arg.substr(8));
+        } else if (arg.rfind("--messages=", 0) == 0) {
+            options.messages_per_thread = static_cast<size_t>(std::strtoull(argv[i] + 11, nullptr, 10));
+        } else if (arg.rfind("--csv=", 0) == 0) {
+            options.csv_path = std::string(arg.substr(6));
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--threads=1,2,4,8,16] [--sinks=null,file] [--modes=sync,async]\n"
+                         "          [--messages=<per thread>] [--csv=<file>]\n",
+                         argv[0]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+Workload makeVneWorkload(const std::string& mode, const std::string& sink_type) {
+    std::shared_ptr<ILogger> logger;
+    if (mode == "async") {
+        logger = std::make_shared<AsyncLogger>(kVneLoggerName);
+    } else {
+        logger = std::make_shared<SyncLogger>(kVneLoggerName);
+    }
+    std::unique_ptr<ILogSink> sink;
+    if (sink_type == "file") {
+        sink = std::make_unique<FileLogSink>("bench_logs/compare_vnelogging.log", false);
+    } else {
+        sink = std::make_unique<bench::NullLogSink>();
+    }
+    sink->setPattern(kVnePattern);
+    logger->addLogSink(std::move(sink));
+    logger->setFlushLevel(LogLevel::eFatal);
+    LoggerController::registerLogger(logger);
+
+    Workload workload;
+    workload.log = [](int value) {
+        VNE_LOG_INFO_L(kVneLoggerName) << "Benchmark message #" << value << " with some additional data";
+    };
+    workload.flush = [logger] { logger->flush(); };
+    workload.teardown = [] { LoggerController::unregisterLogger(kVneLoggerName); };
+    return workload;
+}
+
+Workload makeSpdlogWorkload(const std::string& mode, const std::string& sink_type) {
+    spdlog::sink_ptr sink;
+    if (sink_type == "file") {
+        sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>("bench_logs/compare_spdlog.log", true);
+    } else {
+        sink = std::make_shared<spdlog::sinks::null_sink_mt>();
+    }
+
+    std::shared_ptr<spdlog::logger> logger;
+    std::shared_ptr<spdlog::details::thread_pool> pool;
+    if (mode == "async") {
+        pool = std::make_shared<spdlog::details::thread_pool>(kSpdlogQueueSize, 1);
+        logger = std::make_shared<spdlog::async_logger>(kSpdlogLoggerName, sink, pool,
+                                                        spdlog::async_overflow_policy::block);
+    } else {
+        logger = std::make_shared<spdlog::logger>(kSpdlogLoggerName, sink);
+    }
+    logger->set_pattern(kSpdlogPattern);
+    logger->set_level(spdlog::level::info);
+    logger->flush_on(spdlog::level::critical);
+
+    Workload workload;
+    workload.log = [raw = logger.get()](int value) {
+        raw->info("Benchmark message #{} with some additional data", value);
+    };
+    workload.flush = [logger, pool, async = (mode == "async")] {
+        logger->flush();
+        if (async) {
+            // spdlog's async flush is itself queued; wait until the pool has drained.
+            while (pool->queue_size() != 0) {
+                std::this_thread::yield();
+            }
+            logger->flush();
+        }
+    };
+    workload.teardown = [] {};
+    return workload;
+}
+
+RunResult runWorkload(Workload workload, size_t thread_count, size_t messages, const bench::CycleClock& clock) {
+    std::vector<bench::LatencyHistogram> histograms(thread_count);
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+
+    auto producer = [&](size_t index) {
+        bench::LatencyHistogram& histogram = histograms[index];
+        for (size_t i = 0; i < kWarmupMessages; ++i) {
+            workload.log(static_cast<int>(i));
+        }
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < messages; ++i) {
+            uint64_t start = bench::CycleClock::now();
+            workload.log(static_cast<int>(i));
+            uint64_t end = bench::CycleClock::now();
+            histogram.record(clock.elapsedNs(start, end));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads.emplace_back(producer, i);
+    }
+    while (ready.load() != thread_count) {
+        std::this_thread::yield();
+    }
+    workload.flush();
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    workload.flush();
+    auto end = std::chrono::steady_clock::now();
+    workload.teardown();
+
+    RunResult result;
+    for (const auto& histogram : histograms) {
+        result.histogram.merge(histogram);
+    }
+    result.elapsed_s = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+unsigned long long percentile(const RunResult& result, double p) {
+    return static_cast<unsigned long long>(result.histogram.valueAtPercentile(p));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+    bench::CycleClock clock;
+
+    std::printf("=== vnelogging vs spdlog %d.%d.%d ===\n", SPDLOG_VER_MAJOR, SPDLOG_VER_MINOR, SPDLOG_VER_PATCH);
+    std::printf("Messages per thread: %zu, latencies in ns (clock overhead %.1f ns subtracted)\n\n",
+                options.messages_per_thread,
+                clock.overheadNs());
+    std::printf("%-6s %-5s %7s | %12s %12s %7s | %8s %8s %8s %8s | %8s %8s %8s %8s\n", "mode", "sink", "threads",
+                "vne msg/s", "spd msg/s", "ratio", "vne p50", "p99", "p99.9", "max", "spd p50", "p99", "p99.9",
+                "max");
+    std::printf("%s\n", std::string(136, '-').c_str());
+
+    std::ofstream csv;
+    if (!options.csv_path.empty()) {
+        csv.open(options.csv_path);
+        csv << "library,mode,sink,threads,messages,msgs_per_sec,p50_ns,p90_ns,p99_ns,p99_9_ns,p99_99_ns,max_ns\n";
+    }
+    auto writeCsvRow = [&csv](const char* library, const std::string& mode, const std::string& sink, size_t threads,
+                              const RunResult& result) {
+        if (!csv.is_open()) {
+            return;
+        }
+        csv << library << ',' << mode << ',' << sink << ',' << threads << ',' << result.histogram.count() << ','
+            << static_cast<uint64_t>(result.throughput()) << ',' << percentile(result, 50.0) << ','
+            << percentile(result, 90.0) << ',' << percentile(result, 99.0) << ',' << percentile(result, 99.9) << ','
+            << percentile(result, 99.99) << ',' << result.histogram.max() << '\n';
+    };
+
+    for (const auto& mode : options.modes) {
+        for (const auto& sink : options.sinks) {
+            for (size_t threads : options.threads) {
+                RunResult vne = runWorkload(makeVneWorkload(mode, sink), threads, options.messages_per_thread, clock);
+                RunResult spd =
+                    runWorkload(makeSpdlogWorkload(mode, sink), threads, options.messages_per_thread, clock);
+
+                double ratio = spd.throughput() > 0.0 ? vne.throughput() / spd.throughput() : 0.0;
+                std::printf("%-6s %-5s %7zu | %12.0f %12.0f %6.2fx | %8llu %8llu %8llu %8llu | %8llu %8llu %8llu "
+                            "%8llu\n",
+                            mode.c_str(), sink.c_str(), threads, vne.throughput(), spd.throughput(), ratio,
+                            percentile(vne, 50.0), percentile(vne, 99.0), percentile(vne, 99.9),
+                            static_cast<unsigned long long>(vne.histogram.max()), percentile(spd, 50.0),
+                            percentile(spd, 99.0), percentile(spd, 99.9),
+                            static_cast<unsigned long long>(spd.histogram.max()));
+                std::fflush(stdout);
+
+                writeCsvRow("vnelogging", mode, sink, threads, vne);
+                writeCsvRow("spdlog", mode, sink, threads, spd);
+            }
+        }
+    }
+
+    std::printf("\nratio = vnelogging throughput / spdlog throughput (>1 means vnelogging is faster)\n");
+    spdlog::shutdown();
+    return 0;
+}
@@ -0,0 +1,62 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+
+#include "vertexnova/logging/core/time_stamp.h"
+
+#include <memory>
+
+/**
+ * @file time_stamp_bench.cpp
+ *
+ * @brief TimeStamp generation, including the former per-call provider allocation.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+void timeStampGetTimeStamp(bench::BenchState& state) {
+    while (state.keepRunning()) {
+        bench::doNotOptimize(TimeStamp(TimeStampType::eLocal).getTimeStamp());
+    }
+}
+
+void timeStampFormatToLocal(bench::BenchState& state) {
+    char buffer[TimeStamp::kBufferSize];
+    while (state.keepRunning()) {
+        bench::doNotOptimize(TimeStamp(TimeStampType::eLocal).formatTo(buffer, sizeof(buffer)));
+    }
+}
+
+void timeStampFormatToUtc(bench::BenchState& state) {
+    char buffer[TimeStamp::kBufferSize];
+    while (state.keepRunning()) {
+        bench::doNotOptimize(TimeStamp(TimeStampType::eUtc).formatTo(buffer, sizeof(buffer)));
+    }
+}
+
+// Reference point: what every %x expansion paid before the provider became process-wide.
+void timeStampSharedProviderPerCall(bench::BenchState& state) {
+    char buffer[TimeStamp::kBufferSize];
+    while (state.keepRunning()) {
+        std::shared_ptr<ITimeProvider> provider = std::make_shared<TimeProvider>();
+        bench::doNotOptimize(TimeStamp(TimeStampType::eLocal, *provider).formatTo(buffer, sizeof(buffer)));
+    }
+}
+
+}  // namespace
+
+VNE_BENCHMARK("time_stamp/get_time_stamp", timeStampGetTimeStamp);
+VNE_BENCHMARK("time_stamp/format_to_local", timeStampFormatToLocal);
+VNE_BENCHMARK("time_stamp/format_to_utc", timeStampFormatToUtc);
+VNE_BENCHMARK("time_stamp/shared_provider_per_call", timeStampSharedProviderPerCall);
@@ -0,0 +1,113 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "bench_harness.h"
+#include "null_log_sink.h"
+
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/chrome_trace_sink.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "vertexnova/logging/logging.h"
+
+#include <chrono>
+#include <memory>
+
+/**
+ * @file trace_bench.cpp
+ *
+ * @brief Cost of recording a VNE_TRACE_SCOPE span and of a VNE_LOG_TIMED_SCOPE.
+ *
+ * Compare trace/scope_disabled with log_stream/filtered_by_level: both are one
+ * logger lookup. The enabled cases add two clock reads and a dispatch.
+ * timed_scope/under_threshold is the two clock reads alone.
+ */
+
+namespace {
+
+using namespace vne::log;
+
+CREATE_VNE_LOGGER_CATEGORY("bench.trace")
+
+constexpr const char* kLoggerName = "bench_trace";
+
+template<typename LoggerType>
+class ScopedTraceLogger {
+   public:
+    ScopedTraceLogger(std::unique_ptr<ILogSink> sink, bool tracing_enabled)
+        : logger_(std::make_shared<LoggerType>(kLoggerName)) {
+        logger_->addLogSink(std::move(sink));
+        logger_->setTracingEnabled(tracing_enabled);
+        LoggerController::registerLogger(logger_);
+    }
+
+    ~ScopedTraceLogger() {
+        logger_->flush();
+        LoggerController::unregisterLogger(kLoggerName);
+    }
+
+    ScopedTraceLogger(const ScopedTraceLogger&) = delete;
+    ScopedTraceLogger& operator=(const ScopedTraceLogger&) = delete;
+
+   private:
+    std::shared_ptr<LoggerType> logger_;
+};
+
+void traceScopeDisabled(bench::BenchState& state) {
+    ScopedTraceLogger<SyncLogger> logger(std::make_unique<bench::NullLogSink>(), false);
+    while (state.keepRunning()) {
+        VNE_TRACE_SCOPE_L(kLoggerName, "span");
+    }
+}
+
+void traceScopeSyncNull(bench::BenchState& state) {
+    ScopedTraceLogger<SyncLogger> logger(std::make_unique<bench::NullLogSink>(), true);
+    while (state.keepRunning()) {
+        VNE_TRACE_SCOPE_L(kLoggerName, "span");
+    }
+}
+
+void traceScopeAsyncNull(bench::BenchState& state) {
+    ScopedTraceLogger<AsyncLogger> logger(std::make_unique<bench::NullLogSink>(), true);
+    while (state.keepRunning()) {
+        VNE_TRACE_SCOPE_L(kLoggerName, "span");
+    }
+}
+
+void traceScopeAsyncChrome(bench::BenchState& state) {
+    ScopedTraceLogger<AsyncLogger> logger(std::make_unique<ChromeTraceSink>("bench_logs/trace_bench.json"), true);
+    while (state.keepRunning()) {
+        VNE_TRACE_SCOPE_L(kLoggerName, "span");
+    }
+}
+
+void timedScopeUnderThreshold(bench::BenchState& state) {
+    ScopedTraceLogger<SyncLogger> logger(std::make_unique<bench::NullLogSink>(), false);
+    while (state.keepRunning()) {
+        VNE_LOG_TIMED_SCOPE_L(kLoggerName, LogLevel::eWarn, std::chrono::seconds(1));
+    }
+}
+
+void timedScopeOverThreshold(bench::BenchState& state) {
+    ScopedTraceLogger<SyncLogger> logger(std::make_unique<bench::NullLogSink>(), false);
+    while (state.keepRunning()) {
+        VNE_LOG_TIMED_SCOPE_L(kLoggerName, LogLevel::eWarn, std::chrono::nanoseconds(0));
+    }
+}
+
+}  // namespace
+
+VNE_BENCHMARK("timed_scope/under_threshold", timedScopeUnderThreshold);
+VNE_BENCHMARK("timed_scope/over_threshold", timedScopeOverThreshold);
+VNE_BENCHMARK("trace/scope_disabled", traceScopeDisabled);
+VNE_BENCHMARK("trace/scope_sync_null", traceScopeSyncNull);
+VNE_BENCHMARK("trace/scope_async_null", traceScopeAsyncNull);
+VNE_BENCHMARK("trace/scope_async_chrome", traceScopeAsyncChrome);
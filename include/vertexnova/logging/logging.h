@@ -11,16 +11,29 @@
  */
 
 #include "vertexnova/logging/log_manager.h"
+#include "vertexnova/logging/log_signal_handler.h"
 #include "vertexnova/logging/core/logger.h"
 #include "vertexnova/logging/core/log_stream.h"
 #include "vertexnova/logging/core/log_level.h"
 #include "vertexnova/logging/core/time_stamp.h"
-
+#include "vertexnova/logging/core/log_stats.h"
+#include "vertexnova/logging/core/log_queue.h"
+#include "vertexnova/logging/core/log_call_site.h"
+#include "vertexnova/logging/core/log_crash_handler.h"
+#include "vertexnova/logging/core/emergency_log.h"
+#include "vertexnova/logging/core/trace_scope.h"
+#include "vertexnova/logging/core/timed_log_scope.h"
+
+#include <chrono>
+#include <iosfwd>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace vne::log {
 
+class LogControlServer;
+
 /**
  * @enum LogSinkType
  * @brief Specifies the type of log sinks available.
@@ -45,15 +58,25 @@ enum class LogSinkType {
  * log level, and whether it operates asynchronously.
  */
 struct LoggerConfig {
-    std::string name;                          //!< The name of the logger.
-    LogSinkType sink = LogSinkType::eConsole;  //!< The type of log sink to use (console, file, or both).
-    std::string console_pattern;               //!< The pattern for formatting log messages in the console.
-    std::string file_pattern;                  //!< The pattern for formatting log messages in a file.
-    std::string file_path;                     //!< The path to the file where logs will be written, if applicable.
-    LogLevel log_level = LogLevel::eInfo;      //!< The log level for filtering messages (e.g., trace, debug, info,
-                                               //!< warn, error, fatal).
-    LogLevel flush_level = LogLevel::eError;   //!< The log level at which the logger will flush its output.
-    bool async = false;                        //!< Flag indicating whether the logger operates asynchronously.
+    std::string name;                                  //!< The name of the logger.
+    LogSinkType sink = LogSinkType::eConsole;          //!< The type of log sink to use (console, file, or both).
+    std::string console_pattern;                       //!< The pattern for formatting log messages in the console.
+    std::string file_pattern;                          //!< The pattern for formatting log messages in a file.
+    std::string file_path;                             //!< The path to the file where logs will be written, if any.
+    LogLevel log_level = LogLevel::eInfo;              //!< The log level for filtering messages (e.g., trace,
+                                                       //!< debug, info, warn, error, fatal).
+    LogLevel flush_level = LogLevel::eError;           //!< The log level at which the logger will flush its output.
+    bool async = false;                                //!< Flag indicating whether the logger operates asynchronously.
+    LoggerMode mode = LoggerMode::eSync;               //!< eSync, eAsync or eHybrid; async = true means eAsync.
+    LogLevel sync_level = LogLevel::eError;            //!< In hybrid mode, the lowest level written synchronously.
+    bool priority_lane = false;                        //!< Queue severe messages ahead of the backlog (async only).
+    LogLevel priority_level = LogLevel::eError;        //!< Lowest level queued on the priority lane.
+    LaneOrder lane_order = LaneOrder::ePriorityFirst;  //!< Order of priority and normal messages in a batch.
+    bool isolate_sinks = false;                        //!< Give each sink its own buffer and worker thread.
+    SinkBufferOptions console_buffer;                  //!< Console sink buffer, if isolate_sinks is set.
+    SinkBufferOptions file_buffer;                     //!< File sink buffer, if isolate_sinks is set.
+    bool pipelined = false;                            //!< Format and write on separate threads (async only).
+    size_t formatter_threads = 0;                      //!< If pipelined, threads formatting in parallel.
 };
 
 inline constexpr const char* kDefaultLoggerName = "vertexnova";  //!< Default logger name.
@@ -79,6 +102,19 @@ class Logging {
      */
     static void initialize(const std::string& logger_name, bool async = false);
 
+    /**
+     * @brief Initializes a logger in the given mode.
+     *
+     * In LoggerMode::eHybrid, messages at or above sync_level are written and
+     * flushed before the logging call returns, after the messages queued
+     * before them; less severe messages are queued and written by the worker.
+     *
+     * @param logger_name The name to assign to the logger instance.
+     * @param mode The logger's mode.
+     * @param sync_level In hybrid mode, the lowest level written synchronously.
+     */
+    static void initialize(const std::string& logger_name, LoggerMode mode, LogLevel sync_level = LogLevel::eError);
+
     /**
      * @brief Shuts down the logging system.
      *
@@ -119,6 +155,38 @@ class Logging {
      */
     static bool isLoggerAsync(const std::string& logger_name);
 
+    /**
+     * @brief Returns the mode of a logger; hybrid loggers are also reported as async by isLoggerAsync().
+     *
+     * @param logger_name The name of the logger to check.
+     * @return The logger's mode; LoggerMode::eSync if it doesn't exist.
+     */
+    static LoggerMode getLoggerMode(const std::string& logger_name);
+
+    /**
+     * @brief Sets the lowest level an async logger writes synchronously, switching it to hybrid mode.
+     *
+     * Has no effect on synchronous loggers.
+     *
+     * @param logger_name The name of the logger.
+     * @param level The lowest level written synchronously.
+     */
+    static void setSyncLevel(const std::string& logger_name, LogLevel level);
+
+    /**
+     * @brief Switches the pipelined backend of an async logger on or off.
+     *
+     * The worker then only formats messages into buffers and a second thread
+     * writes them to the sinks. With formatter threads, several buffers are
+     * formatted in parallel and written in their original order. Has no
+     * effect on synchronous loggers.
+     *
+     * @param logger_name The name of the logger.
+     * @param enabled True to format and write on separate threads.
+     * @param formatter_threads Threads formatting in parallel instead of the worker; 0 for none.
+     */
+    static void setPipelined(const std::string& logger_name, bool enabled, size_t formatter_threads = 0);
+
     /**
      * @brief Adds a console sink to the logger.
      *
@@ -129,6 +197,16 @@ class Logging {
      */
     static void addConsoleSink(const std::string& logger_name);
 
+    /**
+     * @brief Adds a console sink with its own buffer and worker thread.
+     *
+     * A slow terminal then no longer delays the logger's other sinks; see IsolatedLogSink.
+     *
+     * @param logger_name The name of the logger to which the console sink will be added.
+     * @param buffer The size and overflow policy of the sink's buffer.
+     */
+    static void addConsoleSink(const std::string& logger_name, const SinkBufferOptions& buffer);
+
     /**
      * @brief Adds a file sink to the logger.
      *
@@ -140,6 +218,46 @@ class Logging {
      */
     static void addFileSink(const std::string& logger_name, const std::string& file);
 
+    /**
+     * @brief Adds a file sink with its own buffer and worker thread; see IsolatedLogSink.
+     *
+     * @param logger_name The name of the logger to which the file sink will be added.
+     * @param file The name of the file where logs will be written.
+     * @param buffer The size and overflow policy of the sink's buffer.
+     */
+    static void addFileSink(const std::string& logger_name, const std::string& file, const SinkBufferOptions& buffer);
+
+    /**
+     * @brief Adds a file sink that writes a run of identical messages once, followed by its count.
+     *
+     * A message repeating the previous one in category, level and text is
+     * counted instead of written; "last message repeated N times" follows when
+     * the run ends, and every duplicate_window while it lasts. See
+     * DeduplicatingLogSink, and addDeduplicatedSink() for other sinks.
+     *
+     * @param logger_name The name of the logger to which the file sink will be added.
+     * @param file The name of the file where logs will be written.
+     * @param duplicate_window How long repeats are collected before their count is written.
+     */
+    static void addFileSink(const std::string& logger_name,
+                            const std::string& file,
+                            std::chrono::milliseconds duplicate_window);
+
+    /**
+     * @brief Adds a sink that writes a run of identical messages once, followed by its count.
+     *
+     * Works like the deduplicating addFileSink() for any sink, for example
+     * a ConsoleLogSink, SocketLogSink or RoutingLogSink built by the caller,
+     * or an IsolatedLogSink around one.
+     *
+     * @param logger_name The name of the logger to which the sink will be added.
+     * @param sink The sink to wrap.
+     * @param duplicate_window How long repeats are collected before their count is written.
+     */
+    static void addDeduplicatedSink(const std::string& logger_name,
+                                    std::unique_ptr<ILogSink> sink,
+                                    std::chrono::milliseconds duplicate_window = std::chrono::seconds(30));
+
     /**
      * @brief Sets the console pattern for the logger.
      *
@@ -182,6 +300,286 @@ class Logging {
      */
     static void setFlushLevel(const std::string& logger_name, LogLevel level);
 
+    /**
+     * @brief Adds a Chrome trace sink to the logger and enables tracing on it.
+     *
+     * VNE_TRACE_* spans recorded on this logger are then written to the file in
+     * the Chrome Trace Event format, viewable in chrome://tracing or Perfetto.
+     *
+     * @param logger_name The name of the logger to which the trace sink will be added.
+     * @param file The path of the trace file (truncated when the sink is created).
+     */
+    static void addChromeTraceSink(const std::string& logger_name, const std::string& file);
+
+    /**
+     * @brief Adds a sink that hands messages to a collector process through shared memory.
+     *
+     * Every process that logs to the same segment gets its own ring in it;
+     * the vnelog-collectord daemon merges the rings by time stamp into one
+     * rotated file. Logging makes no system call, and messages that do not
+     * fit while the collector is behind are dropped and counted. POSIX only;
+     * see SharedMemoryLogSink.
+     *
+     * @param logger_name The name of the logger to which the sink will be added.
+     * @param segment_name The POSIX shared-memory name, as passed to vnelog-collectord -n.
+     */
+    static void addSharedMemorySink(const std::string& logger_name,
+                                    const std::string& segment_name = SharedLogSegment::kDefaultName);
+
+    /**
+     * @brief Adds a sink that streams messages to a local aggregator over a socket.
+     *
+     * Messages are sent as length-prefixed frames, batched into one gather
+     * write. The socket never blocks the logger: while the aggregator is
+     * away, messages are spooled up to SocketSinkOptions::spool_bytes and the
+     * sink reconnects with a growing delay. POSIX only; see SocketLogSink.
+     *
+     * @param logger_name The name of the logger to which the sink will be added.
+     * @param endpoint "unix:<path>" or "tcp:<host>:<port>".
+     * @param options Batching, spooling and reconnect settings.
+     */
+    static void addSocketSink(const std::string& logger_name,
+                              const std::string& endpoint,
+                              const SocketSinkOptions& options = {});
+
+    /**
+     * @brief Adds a sink that writes to the local syslog daemon (RFC 5424) or to journald (native protocol).
+     *
+     * Category, file, function and line travel as structured data or journal
+     * fields, and datagrams are sent in batches rather than one syscall per
+     * message. POSIX only; see SyslogLogSink.
+     *
+     * @param logger_name The name of the logger to which the sink will be added.
+     * @param options Protocol, identity and batching.
+     */
+    static void addSyslogSink(const std::string& logger_name, const SyslogSinkOptions& options = {});
+
+    /**
+     * @brief Adds a sink that writes each message to the files its category and level are routed to.
+     *
+     * Gives subsystems files of their own without a logger, and a worker
+     * thread, per subsystem. A route's file may contain "{category}" for one
+     * file per category; the open files hold at most max_open_fds
+     * descriptors, the least recently used being closed first. See RoutingLogSink.
+     *
+     * @param logger_name The name of the logger to which the sink will be added.
+     * @param routes File routes, tried in order.
+     * @param max_open_fds Descriptors the open file targets may hold together.
+     */
+    static void addRoutingSink(const std::string& logger_name,
+                               const std::vector<LogRoute>& routes,
+                               size_t max_open_fds = 64);
+
+    /**
+     * @brief Enables or disables recording of VNE_TRACE_* spans for the logger.
+     *
+     * While disabled, a span costs one logger lookup, like a log call below the
+     * logger's level.
+     *
+     * @param logger_name The name of the logger.
+     * @param enabled True to record spans.
+     */
+    static void setTracingEnabled(const std::string& logger_name, bool enabled);
+
+    /**
+     * @brief Gives an asynchronous logger a priority lane for severe messages.
+     *
+     * Messages at or above the level are queued ahead of the logger's backlog
+     * and written after at most the batch the worker is running. When such a
+     * message also reaches the flush level, the caller waits for the priority
+     * lane only, not for the backlog. With LaneOrder::eTimestamp the worker
+     * keeps each batch in the order the messages were logged, so a priority
+     * message can move ahead of at most the older messages not yet in a batch.
+     * Has no effect on synchronous loggers, which write every message at once.
+     *
+     * @param logger_name The name of the logger.
+     * @param level The lowest level queued on the priority lane.
+     * @param order How the worker orders priority and normal messages within a batch.
+     */
+    static void setPriorityLane(const std::string& logger_name,
+                                LogLevel level = LogLevel::eError,
+                                LaneOrder order = LaneOrder::ePriorityFirst);
+
+    /**
+     * @brief Queues every message of the logger on its normal lane again.
+     *
+     * @param logger_name The name of the logger.
+     */
+    static void disablePriorityLane(const std::string& logger_name);
+
+    /**
+     * @brief Returns runtime statistics for every logger.
+     *
+     * Each entry holds the logger's accepted/filtered/dropped counts per level,
+     * flush count and time, queue depth and worker busy/idle time (async loggers)
+     * and per-sink byte, write-error and flush counts. Use it to size queues and
+     * to alert on drops or write errors.
+     *
+     * @return A snapshot of all loggers, sorted by name; empty if logging is not initialized.
+     */
+    static LoggingStats getStats();
+
+    /**
+     * @brief Returns runtime statistics for a single logger, including its sinks.
+     *
+     * @param logger_name The name of the logger.
+     * @return A snapshot of the logger, or an empty snapshot if it does not exist.
+     */
+    static LoggerStats getLoggerStats(const std::string& logger_name);
+
+    /**
+     * @brief Resets the runtime statistics of every logger, queue and sink to zero.
+     */
+    static void resetStats();
+
+    /**
+     * @brief Starts or stops counting messages and bytes per logging statement.
+     *
+     * While enabled, every message accepted by a logger is counted against the
+     * static descriptor of the VNE_LOG_* statement that produced it (file, line,
+     * category, level). The cost is two relaxed atomic increments per message;
+     * while disabled it is one relaxed load.
+     *
+     * @param enabled True to count.
+     */
+    static void setLogProfilingEnabled(bool enabled);
+
+    /**
+     * @brief Returns whether per-statement counting is enabled.
+     */
+    static bool isLogProfilingEnabled();
+
+    /**
+     * @brief Returns the counters of every statement that produced a message, most bytes first.
+     *
+     * Bytes are the length of the message text, before sink patterns are applied.
+     */
+    static std::vector<CallSiteProfile> getLogProfile();
+
+    /**
+     * @brief Resets the per-statement counters to zero.
+     */
+    static void resetLogProfile();
+
+    /**
+     * @brief Prints the top_n noisiest statements to standard output.
+     *
+     * @param top_n Number of statements to print.
+     */
+    static void dumpLogProfile(size_t top_n = 10);
+
+    /**
+     * @brief Prints the top_n noisiest statements as a table.
+     *
+     * Each row shows bytes, share of all bytes, cumulative share, messages,
+     * level, category and file:line, ranked by bytes.
+     *
+     * @param out The stream to print to.
+     * @param top_n Number of statements to print.
+     */
+    static void dumpLogProfile(std::ostream& out, size_t top_n = 10);
+
+    /**
+     * @brief Switches on the matching log statements, even below their logger's level.
+     *
+     * The spec is `<file-glob>[:<line>[-<line>]]`, e.g. `net/socket.cpp:120-200`.
+     * The glob matches the source path or any trailing part of it after a path
+     * separator. Statements that have not run yet pick the rule up when they
+     * first run, and the latest matching rule wins.
+     *
+     * @param spec The call-site spec.
+     * @return The number of already registered statements that matched.
+     */
+    static size_t enableCallSites(const std::string& spec);
+
+    /**
+     * @brief Switches off the matching log statements; a disabled statement costs one relaxed load.
+     *
+     * @param spec The call-site spec (see enableCallSites).
+     * @return The number of already registered statements that matched.
+     */
+    static size_t disableCallSites(const std::string& spec);
+
+    /**
+     * @brief Logs a category at the given level, whatever the level of the loggers it goes to.
+     *
+     * Works on the call sites of the category: statements at or above the level
+     * are enabled, those below it are disabled (one relaxed load each).
+     *
+     * @param category The category name, matched exactly.
+     * @param level The lowest level to log for the category.
+     * @return The number of already registered statements of the category.
+     */
+    static size_t setCategoryLevel(const std::string& category, LogLevel level);
+
+    /**
+     * @brief Drops all enable/disable and category-level rules; every statement follows its logger's level again.
+     */
+    static void resetCallSites();
+
+    /**
+     * @brief Returns every log statement that has run, ordered by file and line.
+     */
+    static std::vector<CallSiteProfile> getCallSites();
+
+    /**
+     * @brief Starts the runtime control endpoint on a Unix domain socket (POSIX only).
+     *
+     * Operators can then list loggers, change logger and category levels,
+     * switch statements on and off, flush, read statistics and reopen rotated
+     * files in the live process with the vnelogctl tool. See LogControlServer
+     * for the commands.
+     *
+     * @param socket_path The socket path; empty for `$TMPDIR/vnelogging-<pid>.sock`.
+     * @return True if the endpoint is listening.
+     */
+    static bool startControlServer(const std::string& socket_path = "");
+
+    /**
+     * @brief Stops the control endpoint and removes its socket; also done by shutdown().
+     */
+    static void stopControlServer();
+
+    /**
+     * @brief Returns the control socket path, or an empty string if the endpoint is not running.
+     */
+    static std::string getControlSocketPath();
+
+    /**
+     * @brief Installs SIGUSR1/SIGUSR2 handlers for verbosity and log rotation (POSIX only).
+     *
+     * SIGUSR1 changes the level of every logger as the mode says; SIGUSR2
+     * flushes every logger and reopens its files, for logrotate's `postrotate`.
+     * The handler only sets a flag; a handler thread does the work.
+     *
+     * @param mode What SIGUSR1 does.
+     * @return True if installed.
+     */
+    static bool installSignalHandlers(SignalLevelMode mode = SignalLevelMode::eToggleTrace);
+
+    /**
+     * @brief Restores the previous SIGUSR1/SIGUSR2 dispositions; also done by shutdown().
+     */
+    static void uninstallSignalHandlers();
+
+    /**
+     * @brief Writes out queued messages if the process crashes (POSIX only).
+     *
+     * On SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL or std::terminate, producers
+     * are stopped, async queues are drained and sinks flushed within the
+     * timeout, and a crash record with a backtrace goes to stderr and the
+     * optional crash file. See LogCrashHandler.
+     *
+     * @param options Drain timeout, crash file and whether to handle std::terminate.
+     * @return True if installed.
+     */
+    static bool installCrashHandler(const CrashHandlerOptions& options = {});
+
+    /**
+     * @brief Restores the previous fatal signal and std::terminate handlers.
+     */
+    static void uninstallCrashHandler();
+
     /**
      * @brief Gets the appropriate log directory based on build context.
      *
@@ -253,7 +651,9 @@ class Logging {
     static void configureLogger(const LoggerConfig& cfg);
 
    private:
-    static std::shared_ptr<LogManager> s_log_manager;  //!< The LogManager instance for managing logging operations.
+    static std::shared_ptr<LogManager> s_log_manager;           //!< The LogManager instance for managing logging.
+    static std::unique_ptr<LogControlServer> s_control_server;  //!< Runtime control endpoint, if started.
+    static std::unique_ptr<LogSignalHandler> s_signal_handler;  //!< SIGUSR1/SIGUSR2 handler, if installed.
 };
 
 }  // namespace vne::log
@@ -289,6 +689,19 @@ class Logging {
 #endif
 #endif
 
+/**
+ * @def VNE_LOG_CALL_SITE(CATEGORY, LEVEL)
+ * @brief The static vne::log::LogCallSite of the statement it appears in.
+ *
+ * The descriptor is created the first time the statement runs; its category
+ * and level are those of that first run.
+ */
+#define VNE_LOG_CALL_SITE(CATEGORY, LEVEL)                                                                 \
+    [&](const char* vne_function) -> ::vne::log::LogCallSite& {                                            \
+        static ::vne::log::LogCallSite s_vne_call_site(CATEGORY, LEVEL, __FILE__, __LINE__, vne_function); \
+        return s_vne_call_site;                                                                            \
+    }(VNE_FUNCTION_NAME)
+
 /**
  * @def VNE_LOG_IMPL(LOGGER, CATEGORY, LEVEL)
  * @brief General logging preprocessor macro with explicit logger.
@@ -297,18 +710,28 @@ class Logging {
  * levels to a specific logger. It uses the vne::log::LogStream class to format
  * and output log messages.
  *
+ * A statement switched off with Logging::disableCallSites costs one relaxed
+ * load: the LogStream is not created and the streamed arguments are not
+ * evaluated. The body runs at most once; a for statement rather than an
+ * if/else is used so that an unbraced `if (c) VNE_LOG_INFO << "x";` neither
+ * triggers -Wdangling-else nor captures a trailing user `else`.
+ *
  * @param LOGGER The name of the logger to use.
  * @param CATEGORY The category for the log message.
  * @param LEVEL The severity level to log at.
  */
-#define VNE_LOG_IMPL(LOGGER, CATEGORY, LEVEL)                \
-    ::vne::log::LogStream(LOGGER,                            \
-                          CATEGORY,                          \
-                          LEVEL,                             \
-                          ::vne::log::TimeStampType::eLocal, \
-                          __FILE__,                          \
-                          VNE_FUNCTION_NAME,                 \
-                          __LINE__)
+#define VNE_LOG_IMPL(LOGGER, CATEGORY, LEVEL)                                                       \
+    for (::vne::log::LogCallSite* vne_log_call_site = VNE_LOG_CALL_SITE(CATEGORY, LEVEL).ifEnabled(); \
+         vne_log_call_site != nullptr;                                                              \
+         vne_log_call_site = nullptr)                                                               \
+    ::vne::log::LogStream(LOGGER,                                                                   \
+                          CATEGORY,                                                                 \
+                          LEVEL,                                                                    \
+                          ::vne::log::TimeStampType::eLocal,                                        \
+                          __FILE__,                                                                 \
+                          VNE_FUNCTION_NAME,                                                        \
+                          __LINE__,                                                                 \
+                          vne_log_call_site)
 
 // Logger + Category macros (LC = Logger + Category)
 #define VNE_LOG_TRACE_LC(LOGGER, CATEGORY) VNE_LOG_IMPL(LOGGER, CATEGORY, ::vne::log::LogLevel::eTrace)
@@ -333,3 +756,79 @@ class Logging {
 #define VNE_LOG_WARN VNE_LOG_WARN_L(::vne::log::kDefaultLoggerName)
 #define VNE_LOG_ERROR VNE_LOG_ERROR_L(::vne::log::kDefaultLoggerName)
 #define VNE_LOG_FATAL VNE_LOG_FATAL_L(::vne::log::kDefaultLoggerName)
+
+/**
+ * @def VNE_LOG_EMERGENCY_C(CATEGORY, LEVEL)
+ * @brief Logs one line without allocating, locking or iostreams; safe in signal handlers.
+ *
+ * The line goes straight to every sink's reserved descriptor, bypassing
+ * loggers and levels (see vne::log::EmergencyStream). Only strings,
+ * characters, numbers, booleans and pointers can be streamed.
+ *
+ * @param CATEGORY The category for the log message.
+ * @param LEVEL The severity level shown in the line.
+ */
+#define VNE_LOG_EMERGENCY_C(CATEGORY, LEVEL) \
+    ::vne::log::EmergencyStream(CATEGORY, LEVEL, __FILE__, static_cast<uint32_t>(__LINE__))
+
+// Emergency macro (uses VNE_LOGGER_CATEGORY from CREATE_VNE_LOGGER_CATEGORY)
+#define VNE_LOG_EMERGENCY VNE_LOG_EMERGENCY_C(VNE_LOGGER_CATEGORY, ::vne::log::LogLevel::eFatal)
+
+// Token pasting helper for the scope macros below (unique variable name per line)
+#define VNE_LOG_CONCAT_IMPL(a, b) a##b
+#define VNE_LOG_CONCAT(a, b) VNE_LOG_CONCAT_IMPL(a, b)
+
+/**
+ * @def VNE_LOG_TIMED_SCOPE_LC(LOGGER, CATEGORY, LEVEL, THRESHOLD)
+ * @brief Logs the time spent in the enclosing scope if it exceeds THRESHOLD.
+ *
+ * THRESHOLD is a std::chrono duration (e.g. std::chrono::milliseconds(50)).
+ * Scopes under the threshold cost two steady-clock reads; slower ones log
+ * "Scope took <ms> ms (threshold <ms> ms)" at LEVEL from the call site.
+ *
+ * @param LOGGER The name of the logger to use.
+ * @param CATEGORY The category for the log message.
+ * @param LEVEL The severity level to log at.
+ * @param THRESHOLD The duration above which the scope is logged.
+ */
+#define VNE_LOG_TIMED_SCOPE_LC(LOGGER, CATEGORY, LEVEL, THRESHOLD)                \
+    const ::vne::log::TimedLogScope VNE_LOG_CONCAT(vne_timed_scope_, __LINE__)( \
+        LOGGER, CATEGORY, LEVEL, THRESHOLD, __FILE__, VNE_FUNCTION_NAME, static_cast<uint32_t>(__LINE__))
+
+#define VNE_LOG_TIMED_SCOPE_L(LOGGER, LEVEL, THRESHOLD) \
+    VNE_LOG_TIMED_SCOPE_LC(LOGGER, VNE_LOGGER_CATEGORY, LEVEL, THRESHOLD)
+#define VNE_LOG_TIMED_SCOPE(LEVEL, THRESHOLD) VNE_LOG_TIMED_SCOPE_L(::vne::log::kDefaultLoggerName, LEVEL, THRESHOLD)
+
+// Trace span macros: record timing spans through the logger's sinks (see ChromeTraceSink).
+// Names and categories must be string literals or otherwise have static storage duration.
+
+/**
+ * @def VNE_TRACE_SCOPE_LC(LOGGER, CATEGORY, NAME)
+ * @brief Records a span named NAME from this point to the end of the enclosing scope.
+ */
+#define VNE_TRACE_SCOPE_LC(LOGGER, CATEGORY, NAME) \
+    const ::vne::log::TraceScope VNE_LOG_CONCAT(vne_trace_scope_, __LINE__)(LOGGER, CATEGORY, NAME)
+
+/**
+ * @def VNE_TRACE_BEGIN_LC(LOGGER, CATEGORY, NAME)
+ * @brief Marks the start of a span that is ended by a matching VNE_TRACE_END_LC on the same thread.
+ */
+#define VNE_TRACE_BEGIN_LC(LOGGER, CATEGORY, NAME) \
+    ::vne::log::recordTraceEvent(LOGGER, CATEGORY, NAME, ::vne::log::TracePhase::eBegin)
+
+/**
+ * @def VNE_TRACE_END_LC(LOGGER, CATEGORY, NAME)
+ * @brief Marks the end of the innermost open span started by VNE_TRACE_BEGIN_LC on this thread.
+ */
+#define VNE_TRACE_END_LC(LOGGER, CATEGORY, NAME) \
+    ::vne::log::recordTraceEvent(LOGGER, CATEGORY, NAME, ::vne::log::TracePhase::eEnd)
+
+// Logger-only trace macros (uses VNE_LOGGER_CATEGORY from CREATE_VNE_LOGGER_CATEGORY)
+#define VNE_TRACE_SCOPE_L(LOGGER, NAME) VNE_TRACE_SCOPE_LC(LOGGER, VNE_LOGGER_CATEGORY, NAME)
+#define VNE_TRACE_BEGIN_L(LOGGER, NAME) VNE_TRACE_BEGIN_LC(LOGGER, VNE_LOGGER_CATEGORY, NAME)
+#define VNE_TRACE_END_L(LOGGER, NAME) VNE_TRACE_END_LC(LOGGER, VNE_LOGGER_CATEGORY, NAME)
+
+// Default logger trace macros (uses kDefaultLoggerName)
+#define VNE_TRACE_SCOPE(NAME) VNE_TRACE_SCOPE_L(::vne::log::kDefaultLoggerName, NAME)
+#define VNE_TRACE_BEGIN(NAME) VNE_TRACE_BEGIN_L(::vne::log::kDefaultLoggerName, NAME)
+#define VNE_TRACE_END(NAME) VNE_TRACE_END_L(::vne::log::kDefaultLoggerName, NAME)
@@ -10,6 +10,18 @@
  */
 
 #include "async_logger.h"
+#include "log_crash_handler.h"
+
+#include <chrono>
+
+namespace {
+
+uint64_t elapsedNs(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+}  // namespace
 
 namespace vne {  // Outer namespace
 namespace log {  // Inner namespace
@@ -18,9 +30,13 @@ AsyncLogger::AsyncLogger(std::string logger_name)
     : logger_name_(std::move(logger_name))
     , current_log_level_(LogLevel::eInfo)
     , flush_level_(LogLevel::eError)
-    , dispatcher_(std::make_unique<LogDispatcher>()) {}
+    , dispatcher_(std::make_unique<LogDispatcher>()) {
+    LogCrashHandler::registerLogger(this);
+}
 
-AsyncLogger::~AsyncLogger() {}
+AsyncLogger::~AsyncLogger() {
+    LogCrashHandler::unregisterLogger(this);
+}
 
 void AsyncLogger::addLogSink(std::unique_ptr<ILogSink> log_sink) {
     log_sinks_.push_back(std::move(log_sink));
@@ -31,19 +47,19 @@ const std::vector<std::unique_ptr<ILogSink>>& AsyncLogger::getLogSinks() const {
 }
 
 void AsyncLogger::setCurrentLogLevel(LogLevel level) {
-    current_log_level_ = level;
+    current_log_level_.store(level, std::memory_order_relaxed);
 }
 
 LogLevel AsyncLogger::getCurrentLogLevel() const {
-    return current_log_level_;
+    return current_log_level_.load(std::memory_order_relaxed);
 }
 
 void AsyncLogger::setFlushLevel(LogLevel level) {
-    flush_level_ = level;
+    flush_level_.store(level, std::memory_order_relaxed);
 }
 
 LogLevel AsyncLogger::getFlushLevel() const {
-    return flush_level_;
+    return flush_level_.load(std::memory_order_relaxed);
 }
 
 void AsyncLogger::log(const std::string& category_name,
@@ -53,16 +69,145 @@ void AsyncLogger::log(const std::string& category_name,
                       const std::string& file,
                       const std::string& function,
                       uint32_t line) {
-    if (level >= current_log_level_) {
-        dispatcher_->dispatch(log_sinks_, category_name, level, time_stamp_type, message, file, function, line);
-        if (level >= flush_level_) {
-            dispatcher_->flush(log_sinks_);
+    log(LogRecord{category_name, level, time_stamp_type, message, file, function, line});
+}
+
+void AsyncLogger::setPriorityLane(LogLevel level, LaneOrder order) {
+    priority_level_.store(level, std::memory_order_relaxed);
+    dispatcher_->setLaneOrder(order);
+    priority_lane_.store(true, std::memory_order_release);
+}
+
+void AsyncLogger::disablePriorityLane() {
+    priority_lane_.store(false, std::memory_order_release);
+}
+
+bool AsyncLogger::isPriorityLaneEnabled() const {
+    return priority_lane_.load(std::memory_order_acquire);
+}
+
+LogLevel AsyncLogger::getPriorityLevel() const {
+    return priority_level_.load(std::memory_order_relaxed);
+}
+
+LaneOrder AsyncLogger::getLaneOrder() const {
+    return dispatcher_->getLaneOrder();
+}
+
+void AsyncLogger::setSyncLevel(LogLevel level) {
+    sync_level_.store(level, std::memory_order_relaxed);
+    hybrid_.store(true, std::memory_order_release);
+}
+
+void AsyncLogger::clearSyncLevel() {
+    hybrid_.store(false, std::memory_order_release);
+}
+
+bool AsyncLogger::isHybrid() const {
+    return hybrid_.load(std::memory_order_acquire);
+}
+
+LogLevel AsyncLogger::getSyncLevel() const {
+    return sync_level_.load(std::memory_order_relaxed);
+}
+
+void AsyncLogger::setPipelined(bool enabled, size_t formatter_threads) {
+    dispatcher_->setPipelined(enabled, formatter_threads);
+}
+
+bool AsyncLogger::isPipelined() const {
+    return dispatcher_->isPipelined();
+}
+
+size_t AsyncLogger::getFormatterThreads() const {
+    return dispatcher_->getFormatterThreads();
+}
+
+void AsyncLogger::log(const LogRecord& record) {
+    if (record.force || record.level >= current_log_level_.load(std::memory_order_relaxed)) {
+        counters_.countAccepted(record.level);
+        bool priority = priority_lane_.load(std::memory_order_acquire)
+                        && record.level >= priority_level_.load(std::memory_order_relaxed);
+        if (hybrid_.load(std::memory_order_acquire) && record.level >= sync_level_.load(std::memory_order_relaxed)) {
+            // Written and flushed by the worker before we return; counted as a flush
+            auto start = std::chrono::steady_clock::now();
+            if (dispatcher_->dispatchAndWait(log_sinks_, record, priority)) {
+                counters_.countFlush(elapsedNs(start));
+            } else {
+                counters_.countDropped(record.level);
+            }
+            return;
         }
+        if (!dispatcher_->dispatch(log_sinks_, record, priority)) {
+            // The process is crashing; the crash handler drains what is already queued
+            counters_.countDropped(record.level);
+            return;
+        }
+        if (record.level >= flush_level_.load(std::memory_order_relaxed)) {
+            if (priority) {
+                // Only the priority lane needs to be written; the backlog keeps draining in the background
+                auto start = std::chrono::steady_clock::now();
+                dispatcher_->flushPriority(log_sinks_);
+                counters_.countFlush(elapsedNs(start));
+            } else {
+                flush();
+            }
+        }
+    } else {
+        counters_.countFiltered(record.level);
     }
 }
 
+void AsyncLogger::trace(const TraceEvent& event) {
+    dispatcher_->dispatch(log_sinks_, event);
+}
+
+void AsyncLogger::setTracingEnabled(bool enabled) {
+    tracing_enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool AsyncLogger::isTracingEnabled() const {
+    return tracing_enabled_.load(std::memory_order_relaxed);
+}
+
 void AsyncLogger::flush() {
+    auto start = std::chrono::steady_clock::now();
     dispatcher_->flush(log_sinks_);
+    counters_.countFlush(elapsedNs(start));
+}
+
+void AsyncLogger::reopenSinks() {
+    dispatcher_->reopen(log_sinks_);
+}
+
+bool AsyncLogger::drainOnCrash(std::chrono::steady_clock::time_point deadline) {
+    return dispatcher_->drainOnCrash(log_sinks_, deadline);
+}
+
+void AsyncLogger::countFiltered(LogLevel level) {
+    counters_.countFiltered(level);
+}
+
+LoggerStats AsyncLogger::getStats() const {
+    LoggerStats stats;
+    stats.name = logger_name_;
+    stats.async = true;
+    stats.hybrid = isHybrid();
+    stats.pipelined = isPipelined();
+    counters_.snapshot(stats);
+    stats.queue = dispatcher_->getStats();
+    for (const auto& sink : log_sinks_) {
+        stats.sinks.push_back(sink->getStats());
+    }
+    return stats;
+}
+
+void AsyncLogger::resetStats() {
+    counters_.reset();
+    dispatcher_->resetStats();
+    for (auto& sink : log_sinks_) {
+        sink->resetStats();
+    }
 }
 
 std::string AsyncLogger::getName() const {
@@ -71,8 +216,18 @@ std::string AsyncLogger::getName() const {
 
 std::unique_ptr<ILogger> AsyncLogger::clone(const std::string& logger_name) const {
     auto cloned = std::make_unique<AsyncLogger>(logger_name);
-    cloned->current_log_level_ = current_log_level_;
-    cloned->flush_level_ = flush_level_;
+    cloned->setCurrentLogLevel(getCurrentLogLevel());
+    cloned->setFlushLevel(getFlushLevel());
+    cloned->setTracingEnabled(isTracingEnabled());
+    if (isPriorityLaneEnabled()) {
+        cloned->setPriorityLane(getPriorityLevel(), getLaneOrder());
+    }
+    if (isHybrid()) {
+        cloned->setSyncLevel(getSyncLevel());
+    }
+    if (isPipelined()) {
+        cloned->setPipelined(true, getFormatterThreads());
+    }
     for (const auto& sink : log_sinks_) {
         cloned->log_sinks_.push_back(sink->clone());
     }
@@ -13,6 +13,7 @@
 #include "logger.h"
 #include "log_dispatcher.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -25,6 +26,20 @@ namespace vne::log {
  *
  * This logger asynchronously dispatches log messages to a worker queue for processing.
  * It manages log sinks, log levels, and provides methods to log messages and flush logs.
+ *
+ * With the priority lane enabled, messages at or above the priority level are
+ * queued ahead of the backlog of less severe ones, and a flush triggered by
+ * such a message waits only for the priority lane, so an error logged during
+ * a burst of info messages reaches the sinks within one worker batch.
+ *
+ * With a sync level set (hybrid mode), log() does not return for messages at
+ * or above that level until the worker has written them, in queue order, and
+ * flushed the sinks, so a severe message is not lost if the process dies
+ * right after logging it. Less severe messages stay asynchronous.
+ *
+ * With the pipelined backend on, the worker only formats messages into
+ * buffers and a second thread writes them, so formatting overlaps I/O; see
+ * LogPipeline.
  */
 class AsyncLogger : public ILogger {
    public:
@@ -90,11 +105,55 @@ class AsyncLogger : public ILogger {
              const std::string& function,
              uint32_t line) override;
 
+    /**
+     * @brief Logs a message whose text fields are views into caller-owned storage.
+     *
+     * The record is copied into a pooled queue slot; once the pool and the queue have
+     * grown to the peak number of in-flight messages this does not allocate.
+     *
+     * @param record The message to log.
+     */
+    void log(const LogRecord& record) override;
+
+    /**
+     * @brief Passes a trace span event to every sink.
+     *
+     * @param event The span event.
+     */
+    void trace(const TraceEvent& event) override;
+
+    /**
+     * @brief Enables or disables recording of trace spans.
+     *
+     * @param enabled True to record VNE_TRACE_* spans.
+     */
+    void setTracingEnabled(bool enabled) override;
+
+    /**
+     * @brief Returns whether trace spans are recorded.
+     *
+     * @return True if tracing is enabled.
+     */
+    [[nodiscard]] bool isTracingEnabled() const override;
+
     /**
      * @brief Flushes all loggers.
      */
     void flush() override;
 
+    /**
+     * @brief Reopens the output of every sink once the messages logged before the call are written.
+     */
+    void reopenSinks() override;
+
+    /**
+     * @brief Writes out pending messages and flushes the sinks while the process is crashing.
+     *
+     * @param deadline When to give up.
+     * @return True if everything was written before the deadline.
+     */
+    bool drainOnCrash(std::chrono::steady_clock::time_point deadline) override;
+
     /**
      * @brief Retrieves the name of the logger.
      *
@@ -124,12 +183,112 @@ class AsyncLogger : public ILogger {
      */
     [[nodiscard]] LogLevel getFlushLevel() const override;
 
+    /**
+     * @brief Queues messages at or above a level on the priority lane.
+     *
+     * The lane is off by default. A message that also reaches the flush level
+     * is flushed with LogDispatcher::flushPriority(), without waiting for the
+     * normal lane.
+     *
+     * @param level The lowest level queued on the priority lane.
+     * @param order How the worker orders priority and normal messages within a batch.
+     */
+    void setPriorityLane(LogLevel level, LaneOrder order = LaneOrder::ePriorityFirst);
+
+    /**
+     * @brief Queues every message on the normal lane again.
+     */
+    void disablePriorityLane();
+
+    /**
+     * @brief Returns whether messages at or above getPriorityLevel() use the priority lane.
+     */
+    [[nodiscard]] bool isPriorityLaneEnabled() const;
+
+    /**
+     * @brief Returns the lowest level queued on the priority lane, when it is enabled.
+     */
+    [[nodiscard]] LogLevel getPriorityLevel() const;
+
+    /**
+     * @brief Returns how the worker orders priority and normal messages within a batch.
+     */
+    [[nodiscard]] LaneOrder getLaneOrder() const;
+
+    /**
+     * @brief Switches the logger to hybrid mode: messages at or above the level are written synchronously.
+     *
+     * Such a message is queued like any other, and log() waits until the
+     * worker has written it and flushed the sinks.
+     *
+     * @param level The lowest level written synchronously.
+     */
+    void setSyncLevel(LogLevel level);
+
+    /**
+     * @brief Makes every message asynchronous again.
+     */
+    void clearSyncLevel();
+
+    /**
+     * @brief Returns whether messages at or above getSyncLevel() are written synchronously.
+     */
+    [[nodiscard]] bool isHybrid() const;
+
+    /**
+     * @brief Returns the lowest level written synchronously in hybrid mode.
+     */
+    [[nodiscard]] LogLevel getSyncLevel() const;
+
+    /**
+     * @brief Switches the pipelined backend on or off; see LogDispatcher::setPipelined().
+     *
+     * @param enabled True to format on the worker and write on a separate I/O thread.
+     * @param formatter_threads Threads formatting in parallel instead of the worker; 0 for none.
+     */
+    void setPipelined(bool enabled, size_t formatter_threads = 0);
+
+    /**
+     * @brief Returns whether the pipelined backend is on.
+     */
+    [[nodiscard]] bool isPipelined() const;
+
+    /**
+     * @brief Returns the number of formatter threads of the pipelined backend; 0 if the worker formats.
+     */
+    [[nodiscard]] size_t getFormatterThreads() const;
+
+    /**
+     * @brief Records a message that was discarded by the level filter before reaching log().
+     *
+     * @param level The log level of the discarded message.
+     */
+    void countFiltered(LogLevel level) override;
+
+    /**
+     * @brief Returns a snapshot of the logger's runtime counters, including its queue and sinks.
+     *
+     * @return The logger statistics.
+     */
+    [[nodiscard]] LoggerStats getStats() const override;
+
+    /**
+     * @brief Resets the logger's runtime counters, including its queue and sinks, to zero.
+     */
+    void resetStats() override;
+
    private:
-    std::string logger_name_;                           //!< Name of the logger.
-    LogLevel current_log_level_;                        //!< Current log level.
-    LogLevel flush_level_ = LogLevel::eError;           //!< Flush level (default: ERROR).
-    std::vector<std::unique_ptr<ILogSink>> log_sinks_;  //!< Collection of sinks.
-    std::unique_ptr<LogDispatcher> dispatcher_;         //!< The log dispatcher instance.
+    std::string logger_name_;                                 //!< Name of the logger.
+    std::atomic<LogLevel> current_log_level_;                 //!< Current log level (changed at runtime without locks).
+    std::atomic<LogLevel> flush_level_;                       //!< Flush level (default: ERROR).
+    std::atomic<bool> tracing_enabled_{false};                //!< Whether trace spans are recorded.
+    std::atomic<bool> priority_lane_{false};                  //!< Whether the priority lane is used.
+    std::atomic<LogLevel> priority_level_{LogLevel::eError};  //!< Lowest level queued on the priority lane.
+    std::atomic<bool> hybrid_{false};                         //!< Whether severe messages are written synchronously.
+    std::atomic<LogLevel> sync_level_{LogLevel::eError};      //!< Lowest level written synchronously in hybrid mode.
+    std::vector<std::unique_ptr<ILogSink>> log_sinks_;        //!< Collection of sinks.
+    std::unique_ptr<LogDispatcher> dispatcher_;               //!< The log dispatcher instance.
+    LoggerCounters counters_;                                 //!< Runtime statistics.
 };
 
 }  // namespace vne::log
@@ -0,0 +1,193 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "chrome_trace_sink.h"
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+uint64_t currentProcessId() {
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32)
+    return static_cast<uint64_t>(_getpid());
+#else
+    return static_cast<uint64_t>(getpid());
+#endif
+}
+
+/**
+ * @brief Appends a JSON string literal, escaping quotes, backslashes and control characters.
+ */
+void appendJsonString(std::string& out, const char* text) {
+    out.push_back('"');
+    for (const char* p = text; *p != '\0'; ++p) {
+        const char ch = *p;
+        if (ch == '"' || ch == '\\') {
+            out.push_back('\\');
+            out.push_back(ch);
+        } else if (static_cast<unsigned char>(ch) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(ch));
+            out.append(escaped);
+        } else {
+            out.push_back(ch);
+        }
+    }
+    out.push_back('"');
+}
+
+/**
+ * @brief Appends nanoseconds as microseconds with three decimals, the unit of "ts" and "dur".
+ */
+void appendMicroseconds(std::string& out, uint64_t ns) {
+    char digits[32];
+    int length = std::snprintf(digits,
+                               sizeof(digits),
+                               "%llu.%03llu",
+                               static_cast<unsigned long long>(ns / 1000),
+                               static_cast<unsigned long long>(ns % 1000));
+    out.append(digits, static_cast<size_t>(length));
+}
+
+void appendInteger(std::string& out, uint64_t value) {
+    char digits[24];
+    int length = std::snprintf(digits, sizeof(digits), "%llu", static_cast<unsigned long long>(value));
+    out.append(digits, static_cast<size_t>(length));
+}
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+ChromeTraceSink::TraceFile::~TraceFile() {
+    if (stream.is_open()) {
+        stream << "\n]\n";
+        stream.close();
+    }
+}
+
+ChromeTraceSink::ChromeTraceSink(const std::string& filename)
+    : file_(std::make_shared<TraceFile>())
+    , file_name_(filename)
+    , process_id_(currentProcessId()) {
+    event_buffer_.reserve(256);
+    try {
+        if (filename.empty()) {
+            throw std::runtime_error("No trace file specified.");
+        }
+        std::filesystem::path directory = std::filesystem::path(filename).parent_path();
+        if (!directory.empty() && !std::filesystem::exists(directory)) {
+            std::filesystem::create_directories(directory);
+        }
+
+        file_->stream.open(filename.c_str(), std::ofstream::out | std::ofstream::trunc);
+        if (!file_->stream.is_open()) {
+            throw std::runtime_error("Couldn't open file " + filename + " for write.");
+        }
+        file_->stream << "[\n";
+    } catch (std::exception& ex) {
+        std::cerr << "[ERROR] : " << ex.what() << std::endl;
+    }
+}
+
+ChromeTraceSink::ChromeTraceSink(std::string filename, std::shared_ptr<TraceFile> file)
+    : file_(std::move(file))
+    , file_name_(std::move(filename))
+    , process_id_(currentProcessId()) {
+    event_buffer_.reserve(256);
+}
+
+// The last sink sharing the file closes the array in ~TraceFile
+ChromeTraceSink::~ChromeTraceSink() = default;
+
+void ChromeTraceSink::log(const std::string& /*name*/,
+                          LogLevel /*level*/,
+                          TimeStampType /*time_stamp_type*/,
+                          const std::string& /*message*/,
+                          const std::string& /*file*/,
+                          const std::string& /*function*/,
+                          uint32_t /*line*/) {}
+
+void ChromeTraceSink::logTraceEvent(const TraceEvent& event) {
+    std::string& out = event_buffer_;
+    out.clear();
+    out.append(",\n{\"name\":");
+    appendJsonString(out, event.name);
+    out.append(",\"cat\":");
+    appendJsonString(out, event.category);
+    out.append(",\"ph\":\"");
+    out.push_back(static_cast<char>(event.phase));
+    out.append("\",\"ts\":");
+    appendMicroseconds(out, event.timestamp_ns);
+    if (event.phase == TracePhase::eComplete) {
+        out.append(",\"dur\":");
+        appendMicroseconds(out, event.duration_ns);
+    }
+    out.append(",\"pid\":");
+    appendInteger(out, process_id_);
+    out.append(",\"tid\":");
+    appendInteger(out, event.thread_id);
+    out.push_back('}');
+
+    // The buffer starts with the separator, which the first event of the file skips
+    std::lock_guard<std::mutex> lock(file_->mutex);
+    const size_t skip = file_->first_event ? 2 : 0;
+    file_->stream.write(out.data() + skip, static_cast<std::streamsize>(out.size() - skip));
+    file_->first_event = false;
+    counters_.countWrite(out.size() - skip, file_->stream.is_open() && file_->stream.good());
+}
+
+void ChromeTraceSink::flush() {
+    std::lock_guard<std::mutex> lock(file_->mutex);
+    if (file_->stream.is_open()) {
+        file_->stream.flush();
+        counters_.countFlush();
+    }
+}
+
+std::string ChromeTraceSink::getPattern() const {
+    return pattern_;
+}
+
+void ChromeTraceSink::setPattern(const std::string& pattern) {
+    pattern_ = pattern;
+}
+
+std::string ChromeTraceSink::getFileName() const {
+    return file_name_;
+}
+
+std::unique_ptr<ILogSink> ChromeTraceSink::clone() const {
+    return std::unique_ptr<ILogSink>(new ChromeTraceSink(file_name_, file_));
+}
+
+SinkStats ChromeTraceSink::getStats() const {
+    return counters_.snapshot();
+}
+
+void ChromeTraceSink::resetStats() {
+    counters_.reset();
+}
+
+}  // namespace log
+}  // namespace vne
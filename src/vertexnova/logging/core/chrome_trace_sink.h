@@ -0,0 +1,143 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_sink.h"
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace vne::log {
+
+/**
+ * @class ChromeTraceSink
+ * @brief Writes trace spans to a file in the Chrome Trace Event JSON format.
+ *
+ * The file can be opened in chrome://tracing or https://ui.perfetto.dev. It is
+ * a JSON array of events; the closing bracket is written when the sink is
+ * destroyed, and both viewers also accept a file whose array is not closed,
+ * such as one left behind by a crash. Timestamps are microseconds of the
+ * steady clock. Clones append to the same open file, and the array is closed
+ * when the last of them is destroyed.
+ *
+ * Plain log messages are not written: they carry neither a monotonic
+ * timestamp nor the recording thread. Add the sink next to a text sink on the
+ * same logger to get both.
+ */
+class ChromeTraceSink : public ILogSink {
+   public:
+    /**
+     * @brief Creates (or truncates) the trace file.
+     *
+     * @param filename The path of the trace file.
+     */
+    explicit ChromeTraceSink(const std::string& filename);
+
+    /**
+     * @brief Closes the JSON array and the file, unless a clone still writes to it.
+     */
+    ~ChromeTraceSink() override;
+
+    /**
+     * @brief Ignores plain log messages.
+     */
+    void log(const std::string& name,
+             LogLevel level,
+             TimeStampType time_stamp_type,
+             const std::string& message,
+             const std::string& file,
+             const std::string& function,
+             uint32_t line) override;
+
+    /**
+     * @brief Appends one trace event to the file.
+     *
+     * @param event The span event.
+     */
+    void logTraceEvent(const TraceEvent& event) override;
+
+    /**
+     * @brief Flushes the file output.
+     */
+    void flush() override;
+
+    /**
+     * @brief Gets the pattern; unused by this sink.
+     *
+     * @return The stored pattern.
+     */
+    [[nodiscard]] std::string getPattern() const override;
+
+    /**
+     * @brief Stores a pattern; the trace format is fixed, so it has no effect.
+     *
+     * @param pattern The pattern.
+     */
+    void setPattern(const std::string& pattern) override;
+
+    /**
+     * @brief Retrieves the trace file name.
+     *
+     * @return The name of the trace file.
+     */
+    [[nodiscard]] std::string getFileName() const;
+
+    /**
+     * @brief Creates a new trace sink appending to the same open file; the file is not truncated again.
+     *
+     * @return A unique pointer to the cloned sink.
+     */
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
+
+    /**
+     * @brief Returns a snapshot of the sink's runtime counters.
+     *
+     * @return The sink statistics.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the sink's runtime counters to zero.
+     */
+    void resetStats() override;
+
+   private:
+    /**
+     * @brief The open trace file, shared by a sink and its clones.
+     */
+    struct TraceFile {
+        std::mutex mutex;         //!< Serializes the sinks' writes.
+        std::ofstream stream;     //!< Output file stream.
+        bool first_event = true;  //!< Whether no event has been written yet (guarded by mutex).
+
+        ~TraceFile();
+    };
+
+    /**
+     * @brief Creates a clone writing to an already open file.
+     */
+    ChromeTraceSink(std::string filename, std::shared_ptr<TraceFile> file);
+
+    // Deleted copy constructor and assignment operator
+    ChromeTraceSink(const ChromeTraceSink&) = delete;
+    ChromeTraceSink& operator=(const ChromeTraceSink&) = delete;
+
+   private:
+    std::string pattern_;              //!< Stored pattern (unused).
+    std::shared_ptr<TraceFile> file_;  //!< The trace file, shared with clones.
+    std::string file_name_;            //!< The name of the trace file.
+    std::string event_buffer_;         //!< Reused buffer for one serialized event.
+    uint64_t process_id_;              //!< Written as "pid" in every event.
+    SinkCounters counters_;            //!< Runtime statistics.
+};
+
+}  // namespace vne::log
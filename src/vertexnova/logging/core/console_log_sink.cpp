@@ -10,6 +10,7 @@
  */
 
 #include "console_log_sink.h"
+#include "emergency_log.h"
 #include "log_formatter.h"
 #include "text_color.h"
 
@@ -17,23 +18,14 @@
 #include <memory>
 #include <sstream>
 
-namespace vne {  // Outer namespace
-namespace log {  // Inner namespace
-
-ConsoleLogSink::ConsoleLogSink()
-    : pattern_("%x [%l] %v") {}
-
-ConsoleLogSink::~ConsoleLogSink() {}
+namespace {
+constexpr int kStdoutFd = 1;  //!< std::cout's descriptor, reserved for EmergencyStream.
 
-void ConsoleLogSink::log(const std::string& name,
-                         LogLevel level,
-                         TimeStampType time_stamp_type,
-                         const std::string& message,
-                         const std::string& file,
-                         const std::string& function,
-                         uint32_t line) {
-    std::string formatted_log =
-        LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_);
+/**
+ * @brief Wraps a formatted message in its level's color and terminates the line.
+ */
+std::string colorLine(const std::string& formatted_log, vne::log::LogLevel level) {
+    using namespace vne::log;
 
     // Define colors for each log level
     TextColor color;
@@ -63,13 +55,60 @@ void ConsoleLogSink::log(const std::string& name,
 
     std::ostringstream oss;
     oss << color << formatted_log << getResetSequence() << '\n';
+    return oss.str();
+}
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+ConsoleLogSink::ConsoleLogSink()
+    : pattern_("%x [%l] %v") {
+    EmergencyLog::registerFd(kStdoutFd);
+}
+
+ConsoleLogSink::~ConsoleLogSink() {
+    EmergencyLog::unregisterFd(kStdoutFd);
+}
+
+void ConsoleLogSink::log(const std::string& name,
+                         LogLevel level,
+                         TimeStampType time_stamp_type,
+                         const std::string& message,
+                         const std::string& file,
+                         const std::string& function,
+                         uint32_t line) {
+    std::string output = colorLine(
+        LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_), level);
 
     // Single atomic write to stdout
-    std::cout << oss.str();
+    std::cout << output;
+    counters_.countWrite(output.size(), std::cout.good());
+}
+
+bool ConsoleLogSink::formatTo(std::string& out,
+                              const std::string& name,
+                              LogLevel level,
+                              TimeStampType time_stamp_type,
+                              const std::string& message,
+                              const std::string& file,
+                              const std::string& function,
+                              uint32_t line) {
+    std::string output = colorLine(
+        LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_), level);
+    out.append(output);
+    counters_.countFormatted(output.size());
+    return true;
+}
+
+void ConsoleLogSink::writeFormatted(std::string_view text, size_t messages) {
+    std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    counters_.countBufferWrite(messages, text.size(), std::cout.good());
 }
 
 void ConsoleLogSink::flush() {
     // No need to flush for console log
+    counters_.countFlush();
 }
 
 std::string ConsoleLogSink::getPattern() const {
@@ -84,5 +123,13 @@ std::unique_ptr<ILogSink> ConsoleLogSink::clone() const {
     return std::make_unique<ConsoleLogSink>();
 }
 
+SinkStats ConsoleLogSink::getStats() const {
+    return counters_.snapshot();
+}
+
+void ConsoleLogSink::resetStats() {
+    counters_.reset();
+}
+
 }  // namespace log
 }  // namespace vne
@@ -68,6 +68,33 @@ class ConsoleLogSink : public ILogSink {
              const std::string& function,
              uint32_t line) override;
 
+    /**
+     * @brief Returns true: formatTo() is supported and safe to call from several threads.
+     */
+    [[nodiscard]] bool canFormatTo() const override { return true; }
+
+    /**
+     * @brief Appends the colored, formatted message and a newline to out.
+     *
+     * @return Always true.
+     */
+    bool formatTo(std::string& out,
+                  const std::string& name,
+                  LogLevel level,
+                  TimeStampType time_stamp_type,
+                  const std::string& message,
+                  const std::string& file,
+                  const std::string& function,
+                  uint32_t line) override;
+
+    /**
+     * @brief Writes a buffer of formatted messages to the console.
+     *
+     * @param text One or more formatted messages.
+     * @param messages The number of messages in text.
+     */
+    void writeFormatted(std::string_view text, size_t messages) override;
+
     /**
      * @brief Flushes the console output.
      *
@@ -98,8 +125,21 @@ class ConsoleLogSink : public ILogSink {
      */
     [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
 
+    /**
+     * @brief Returns a snapshot of the sink's runtime counters.
+     *
+     * @return The sink statistics.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the sink's runtime counters to zero.
+     */
+    void resetStats() override;
+
    private:
-    std::string pattern_;  //!< The log pattern used by the console logger.
+    std::string pattern_;    //!< The log pattern used by the console logger.
+    SinkCounters counters_;  //!< Runtime statistics.
 };
 
 }  // namespace vne::log
@@ -0,0 +1,120 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "deduplicating_log_sink.h"
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+DeduplicatingLogSink::DeduplicatingLogSink(std::unique_ptr<ILogSink> sink, std::chrono::milliseconds window)
+    : sink_(std::move(sink))
+    , window_(window) {}
+
+DeduplicatingLogSink::~DeduplicatingLogSink() {
+    reportRepeats();
+    sink_->flush();
+}
+
+void DeduplicatingLogSink::log(const std::string& name,
+                               LogLevel level,
+                               TimeStampType time_stamp_type,
+                               const std::string& message,
+                               const std::string& file,
+                               const std::string& function,
+                               uint32_t line) {
+    if (isRepeat(name, level, message)) {
+        ++repeats_;
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        if (std::chrono::steady_clock::now() - window_start_ >= window_) {
+            reportRepeats();
+        }
+        return;
+    }
+    reportRepeats();
+    sink_->log(name, level, time_stamp_type, message, file, function, line);
+    last_.assign(LogRecord{name, level, time_stamp_type, message, file, function, line});
+    has_last_ = true;
+    window_start_ = std::chrono::steady_clock::now();
+}
+
+void DeduplicatingLogSink::logTraceEvent(const TraceEvent& event) {
+    sink_->logTraceEvent(event);
+}
+
+void DeduplicatingLogSink::flush() {
+    if (repeats_ > 0 && std::chrono::steady_clock::now() - window_start_ >= window_) {
+        reportRepeats();
+    }
+    sink_->flush();
+}
+
+void DeduplicatingLogSink::reopen() {
+    reportRepeats();
+    sink_->reopen();
+}
+
+void DeduplicatingLogSink::onIdle() {
+    if (repeats_ > 0 && std::chrono::steady_clock::now() - window_start_ >= window_) {
+        reportRepeats();
+    }
+    sink_->onIdle();
+}
+
+bool DeduplicatingLogSink::drainOnCrash(std::chrono::steady_clock::time_point deadline) {
+    reportRepeats();
+    return sink_->drainOnCrash(deadline);
+}
+
+std::string DeduplicatingLogSink::getPattern() const {
+    return sink_->getPattern();
+}
+
+void DeduplicatingLogSink::setPattern(const std::string& pattern) {
+    sink_->setPattern(pattern);
+}
+
+std::unique_ptr<ILogSink> DeduplicatingLogSink::clone() const {
+    return std::make_unique<DeduplicatingLogSink>(sink_->clone(), window_);
+}
+
+SinkStats DeduplicatingLogSink::getStats() const {
+    return sink_->getStats();
+}
+
+void DeduplicatingLogSink::resetStats() {
+    sink_->resetStats();
+    suppressed_.store(0, std::memory_order_relaxed);
+}
+
+bool DeduplicatingLogSink::isRepeat(const std::string& name, LogLevel level, const std::string& message) const {
+    // Cheapest checks first; std::string equality compares the lengths before the bytes
+    return has_last_ && level == last_.level && message == last_.message && name == last_.category;
+}
+
+void DeduplicatingLogSink::reportRepeats() {
+    if (repeats_ == 0) {
+        return;
+    }
+    summary_.assign("last message repeated ").append(std::to_string(repeats_));
+    summary_.append(repeats_ == 1 ? " time" : " times");
+    sink_->log(last_.category,
+               last_.level,
+               last_.time_stamp_type,
+               summary_,
+               last_.file,
+               last_.function,
+               last_.line);
+    repeats_ = 0;
+    window_start_ = std::chrono::steady_clock::now();
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,162 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_sink.h"
+#include "log_record.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace vne::log {
+
+/**
+ * @class DeduplicatingLogSink
+ * @brief Collapses runs of identical messages into the first one and a "repeated N times" line.
+ *
+ * A retry loop that fails on every iteration writes the same line over and
+ * over, costing disk bandwidth and pushing the lines that explain the failure
+ * out of rotated files. This decorator passes a message to the wrapped sink
+ * only if it differs from the previous one in category, level or text; the
+ * repeats are counted instead, and when the run ends the wrapped sink
+ * receives "last message repeated N times" with the run's category and level.
+ *
+ * A run that goes on reports its count every window: the first repeat after
+ * the window has passed writes the line for the repeats so far and starts a
+ * new window. flush() writes it too once the window has passed, so a run
+ * that simply stops is reported on the next flush after the window;
+ * reopen(), crash draining and destruction report it at once.
+ *
+ * Repeats are recognised by comparing category and level, then the length
+ * and bytes of the text, which rejects a different message at its first
+ * differing byte. Source location and time do not matter.
+ */
+class DeduplicatingLogSink : public ILogSink {
+   public:
+    /**
+     * @brief Wraps a sink.
+     *
+     * @param sink The sink to write to.
+     * @param window How long repeats are collected before their count is written.
+     */
+    explicit DeduplicatingLogSink(std::unique_ptr<ILogSink> sink,
+                                  std::chrono::milliseconds window = std::chrono::seconds(30));
+
+    /**
+     * @brief Reports a pending run and flushes the wrapped sink.
+     */
+    ~DeduplicatingLogSink() override;
+
+    /**
+     * @brief Writes the message unless it repeats the previous one.
+     */
+    void log(const std::string& name,
+             LogLevel level,
+             TimeStampType time_stamp_type,
+             const std::string& message,
+             const std::string& file,
+             const std::string& function,
+             uint32_t line) override;
+
+    /**
+     * @brief Passes the trace event through; spans are never collapsed.
+     *
+     * @param event The span event.
+     */
+    void logTraceEvent(const TraceEvent& event) override;
+
+    /**
+     * @brief Reports a run whose window has passed, then flushes the wrapped sink.
+     */
+    void flush() override;
+
+    /**
+     * @brief Reports a pending run, then reopens the wrapped sink.
+     */
+    void reopen() override;
+
+    /**
+     * @brief Reports a pending run whose window has passed, then passes the notification on.
+     */
+    void onIdle() override;
+
+    /**
+     * @brief Reports a pending run, then drains the wrapped sink.
+     */
+    bool drainOnCrash(std::chrono::steady_clock::time_point deadline) override;
+
+    /**
+     * @brief Returns the wrapped sink's pattern.
+     */
+    [[nodiscard]] std::string getPattern() const override;
+
+    /**
+     * @brief Sets the wrapped sink's pattern.
+     *
+     * @param pattern The new log pattern.
+     */
+    void setPattern(const std::string& pattern) override;
+
+    /**
+     * @brief Returns a deduplicating clone of the wrapped sink with the same window.
+     */
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
+
+    /**
+     * @brief Returns the wrapped sink's counters.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the wrapped sink's counters and the suppressed count.
+     */
+    void resetStats() override;
+
+    /**
+     * @brief Returns the sink that messages are written to.
+     */
+    [[nodiscard]] ILogSink& getWrappedSink() const { return *sink_; }
+
+    /**
+     * @brief Returns how long repeats are collected before their count is written.
+     */
+    [[nodiscard]] std::chrono::milliseconds getWindow() const { return window_; }
+
+    /**
+     * @brief Returns the number of repeated messages that were not written.
+     */
+    [[nodiscard]] uint64_t getSuppressedCount() const { return suppressed_.load(std::memory_order_relaxed); }
+
+   private:
+    /**
+     * @brief Returns whether the message repeats the last one written.
+     */
+    bool isRepeat(const std::string& name, LogLevel level, const std::string& message) const;
+
+    /**
+     * @brief Writes the "repeated N times" line for the pending repeats, if any.
+     */
+    void reportRepeats();
+
+   private:
+    std::unique_ptr<ILogSink> sink_;                      //!< The sink messages are written to.
+    std::chrono::milliseconds window_;                    //!< How long repeats are collected.
+    LogRecordBuffer last_;                                //!< The last message written; reused.
+    bool has_last_ = false;                               //!< Whether last_ holds a message.
+    uint64_t repeats_ = 0;                                //!< Repeats of last_ not reported yet.
+    std::chrono::steady_clock::time_point window_start_;  //!< When the current window began.
+    std::string summary_;                                 //!< The "repeated N times" text; reused.
+    std::atomic<uint64_t> suppressed_{0};                 //!< Repeats not written.
+};
+
+}  // namespace vne::log
@@ -0,0 +1,312 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "emergency_log.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32)
+#include <io.h>
+#else
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr int kStderrFd = 2;
+
+/**
+ * @brief A registered descriptor and the writes using it.
+ */
+struct FdSlot {
+    std::atomic<int> value{0};    //!< The descriptor + 1; 0 marks a free slot.
+    std::atomic<int> writers{0};  //!< Writes that may have read value and not finished yet.
+};
+
+FdSlot s_fds[vne::log::kMaxEmergencyFds];  //!< Registered descriptors.
+
+/**
+ * @brief Slots store fd + 1 so that zero-initialised slots are free.
+ */
+int slotValue(int fd) {
+    return fd + 1;
+}
+
+void writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32)
+        int written = _write(fd, data, static_cast<unsigned>(size));
+#else
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+#endif
+        if (written <= 0) {
+            return;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+const char* levelName(vne::log::LogLevel level) {
+    switch (level) {
+        case vne::log::LogLevel::eTrace:
+            return "TRACE";
+        case vne::log::LogLevel::eDebug:
+            return "DEBUG";
+        case vne::log::LogLevel::eInfo:
+            return "INFO";
+        case vne::log::LogLevel::eWarn:
+            return "WARN";
+        case vne::log::LogLevel::eError:
+            return "ERROR";
+        case vne::log::LogLevel::eFatal:
+            return "FATAL";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * @brief Writes value as width zero-padded digits.
+ */
+char* formatPadded(char* out, uint64_t value, int width) {
+    for (int i = width - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + width;
+}
+
+/**
+ * @brief Formats the current UTC time as `YYYY-MM-DD HH:MM:SS.uuuuuu UTC`, without gmtime().
+ *
+ * @return The number of characters written (31).
+ */
+size_t formatUtcNow(char* out) {
+    using namespace std::chrono;
+    const int64_t micros = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+    const int64_t seconds = micros / 1000000;
+    int64_t days = seconds / 86400;
+    const int64_t second_of_day = seconds % 86400;
+
+    // Civil date from days since 1970-01-01 (H. Hinnant's algorithm)
+    days += 719468;
+    const int64_t era = days / 146097;
+    const int64_t day_of_era = days - era * 146097;
+    const int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const int64_t month_index = (5 * day_of_year + 2) / 153;
+    const int64_t day = day_of_year - (153 * month_index + 2) / 5 + 1;
+    const int64_t month = month_index < 10 ? month_index + 3 : month_index - 9;
+    const int64_t year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+
+    char* p = out;
+    p = formatPadded(p, static_cast<uint64_t>(year), 4);
+    *p++ = '-';
+    p = formatPadded(p, static_cast<uint64_t>(month), 2);
+    *p++ = '-';
+    p = formatPadded(p, static_cast<uint64_t>(day), 2);
+    *p++ = ' ';
+    p = formatPadded(p, static_cast<uint64_t>(second_of_day / 3600), 2);
+    *p++ = ':';
+    p = formatPadded(p, static_cast<uint64_t>(second_of_day / 60 % 60), 2);
+    *p++ = ':';
+    p = formatPadded(p, static_cast<uint64_t>(second_of_day % 60), 2);
+    *p++ = '.';
+    p = formatPadded(p, static_cast<uint64_t>(micros % 1000000), 6);
+    std::memcpy(p, " UTC", 4);
+    return static_cast<size_t>(p + 4 - out);
+}
+
+/**
+ * @brief Returns the part of a path after the last separator.
+ */
+const char* baseName(const char* path) {
+    const char* name = path;
+    for (const char* p = path; *p != '\0'; ++p) {
+        if (*p == '/' || *p == '\\') {
+            name = p + 1;
+        }
+    }
+    return name;
+}
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+bool EmergencyLog::registerFd(int fd) {
+    if (fd < 0) {
+        return false;
+    }
+    for (auto& slot : s_fds) {
+        int expected = 0;
+        if (slot.value.compare_exchange_strong(expected, slotValue(fd))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void EmergencyLog::unregisterFd(int fd) {
+    for (auto& slot : s_fds) {
+        int expected = slotValue(fd);
+        if (slot.value.compare_exchange_strong(expected, 0)) {
+            // A write that read the descriptor before it was cleared may still be using it; once
+            // it is done, the caller can close the descriptor without a later number reuse
+            // receiving that write
+            while (slot.writers.load() != 0) {
+                std::this_thread::yield();
+            }
+            return;
+        }
+    }
+}
+
+void EmergencyLog::write(const char* data, size_t size) {
+    int written[kMaxEmergencyFds];
+    size_t written_count = 0;
+    for (auto& slot : s_fds) {
+        // Announced before the descriptor is read, so that unregisterFd() waits for this write
+        slot.writers.fetch_add(1);
+        const int value = slot.value.load();
+        if (value != 0) {
+            const int fd = value - 1;
+            bool duplicate = false;
+            for (size_t i = 0; i < written_count; ++i) {
+                duplicate = duplicate || written[i] == fd;
+            }
+            if (!duplicate) {
+                writeAll(fd, data, size);
+                written[written_count++] = fd;
+            }
+        }
+        slot.writers.fetch_sub(1);
+    }
+    if (written_count == 0) {
+        writeAll(kStderrFd, data, size);
+    }
+}
+
+EmergencyStream::EmergencyStream(const char* category, LogLevel level, const char* file, uint32_t line)
+    : file_(file)
+    , line_(line) {
+    length_ = formatUtcNow(buffer_);
+    *this << " [" << levelName(level) << "] [" << category << "] ";
+}
+
+EmergencyStream::~EmergencyStream() {
+    *this << " (" << baseName(file_) << ':' << line_ << ')';
+    buffer_[length_++] = '\n';
+    EmergencyLog::write(buffer_, length_);
+}
+
+void EmergencyStream::append(const char* text, size_t length) {
+    // Keep one byte for the newline
+    const size_t room = sizeof(buffer_) - 1 - length_;
+    const size_t count = length < room ? length : room;
+    std::memcpy(buffer_ + length_, text, count);
+    length_ += count;
+}
+
+EmergencyStream& EmergencyStream::operator<<(const char* text) {
+    if (text == nullptr) {
+        text = "(null)";
+    }
+    append(text, std::strlen(text));
+    return *this;
+}
+
+EmergencyStream& EmergencyStream::operator<<(std::string_view text) {
+    append(text.data(), text.size());
+    return *this;
+}
+
+EmergencyStream& EmergencyStream::operator<<(char value) {
+    append(&value, 1);
+    return *this;
+}
+
+EmergencyStream& EmergencyStream::operator<<(bool value) {
+    return *this << (value ? "true" : "false");
+}
+
+EmergencyStream& EmergencyStream::appendSigned(long long value) {
+    if (value < 0) {
+        append("-", 1);
+        // Negate in unsigned arithmetic so that the minimum value does not overflow
+        return appendUnsigned(0ULL - static_cast<unsigned long long>(value));
+    }
+    return appendUnsigned(static_cast<unsigned long long>(value));
+}
+
+EmergencyStream& EmergencyStream::appendUnsigned(unsigned long long value) {
+    char digits[24];
+    size_t count = 0;
+    do {
+        digits[sizeof(digits) - 1 - count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    append(digits + sizeof(digits) - count, count);
+    return *this;
+}
+
+EmergencyStream& EmergencyStream::operator<<(double value) {
+    if (std::isnan(value)) {
+        return *this << "nan";
+    }
+    if (value < 0) {
+        append("-", 1);
+        value = -value;
+    }
+    if (std::isinf(value)) {
+        return *this << "inf";
+    }
+    // Six decimals as printf's %f; values too large for the integer part in scientific notation
+    int exponent = 0;
+    if (value >= 1e12) {
+        while (value >= 10) {
+            value /= 10;
+            ++exponent;
+        }
+    }
+    auto scaled = static_cast<unsigned long long>(value * 1e6 + 0.5);
+    appendUnsigned(scaled / 1000000);
+    char fraction[7] = {'.'};
+    formatPadded(fraction + 1, scaled % 1000000, 6);
+    append(fraction, sizeof(fraction));
+    if (exponent > 0) {
+        *this << "e+" << exponent;
+    }
+    return *this;
+}
+
+EmergencyStream& EmergencyStream::operator<<(const void* pointer) {
+    auto value = reinterpret_cast<uintptr_t>(pointer);
+    char digits[2 + sizeof(uintptr_t) * 2] = {'0', 'x'};
+    for (size_t i = sizeof(digits) - 1; i >= 2; --i) {
+        digits[i] = "0123456789abcdef"[value & 0xF];
+        value >>= 4;
+    }
+    append(digits, sizeof(digits));
+    return *this;
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,142 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_level.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @file emergency_log.h
+ *
+ * @brief Logging path that is safe in signal handlers and when the allocator has failed.
+ *
+ * LogStream allocates and loggers lock, so logging from a signal handler or
+ * an out-of-memory path can deadlock. EmergencyStream formats into a fixed
+ * buffer on the caller's stack and writes the line with write(2) to the file
+ * descriptors reserved by the sinks: every FileLogSink keeps an extra
+ * append-mode descriptor of its file and every ConsoleLogSink registers
+ * stdout. Nothing is allocated, locked or passed through iostreams, and the
+ * message bypasses loggers, levels and patterns.
+ *
+ * Lines look like `2026-10-17 09:30:00.123456 UTC [FATAL] [net] message (socket.cpp:42)`;
+ * the time is UTC because the local time zone cannot be read safely. Longer
+ * messages are cut to kEmergencyBufferSize bytes.
+ */
+
+namespace vne::log {
+
+/// Maximum length of one emergency line, including the newline.
+constexpr size_t kEmergencyBufferSize = 512;
+
+/// Maximum number of file descriptors that receive emergency lines.
+constexpr size_t kMaxEmergencyFds = 32;
+
+/**
+ * @class EmergencyLog
+ * @brief The file descriptors that receive emergency lines.
+ *
+ * The table is a fixed array of atomics, so registering is lock-free and
+ * writing only reads it. A descriptor registered twice (e.g. by two console
+ * sinks) gets each line once. With nothing registered, lines go to stderr.
+ * Each slot counts the writes using it, so that unregisterFd() can wait for
+ * them before the descriptor is closed and its number reused.
+ */
+class EmergencyLog {
+   public:
+    /**
+     * @brief Adds a descriptor; called by the sinks when they open their output.
+     *
+     * @param fd The descriptor.
+     * @return True if added, false if the table is full.
+     */
+    static bool registerFd(int fd);
+
+    /**
+     * @brief Removes one registration of a descriptor; called before the sink closes it.
+     *
+     * Returns once no write() that may have seen the descriptor is still running, so it can be
+     * closed safely. Not async-signal-safe: a signal handler that interrupted a write() would wait
+     * for itself.
+     *
+     * @param fd The descriptor.
+     */
+    static void unregisterFd(int fd);
+
+    /**
+     * @brief Writes a complete line to every registered descriptor. Async-signal-safe.
+     *
+     * @param data The line, including its newline.
+     * @param size Its length.
+     */
+    static void write(const char* data, size_t size);
+};
+
+/**
+ * @class EmergencyStream
+ * @brief Formats one emergency line in a stack buffer and writes it when destroyed.
+ *
+ * Use through the VNE_LOG_EMERGENCY macros. Only types that can be formatted
+ * without allocating are accepted: strings, characters, integers, floating
+ * point numbers, booleans and pointers.
+ */
+class EmergencyStream {
+   public:
+    /**
+     * @brief Starts the line with the time, level and category.
+     *
+     * @param category The category; must stay valid for the statement.
+     * @param level The level.
+     * @param file The source file.
+     * @param line The source line.
+     */
+    EmergencyStream(const char* category, LogLevel level, const char* file, uint32_t line);
+
+    /**
+     * @brief Appends the source location and writes the line.
+     */
+    ~EmergencyStream();
+
+    EmergencyStream(const EmergencyStream&) = delete;
+    EmergencyStream& operator=(const EmergencyStream&) = delete;
+
+    EmergencyStream& operator<<(const char* text);
+    EmergencyStream& operator<<(std::string_view text);
+    EmergencyStream& operator<<(char value);
+    EmergencyStream& operator<<(bool value);
+    EmergencyStream& operator<<(int value) { return appendSigned(value); }
+    EmergencyStream& operator<<(long value) { return appendSigned(value); }
+    EmergencyStream& operator<<(long long value) { return appendSigned(value); }
+    EmergencyStream& operator<<(unsigned value) { return appendUnsigned(value); }
+    EmergencyStream& operator<<(unsigned long value) { return appendUnsigned(value); }
+    EmergencyStream& operator<<(unsigned long long value) { return appendUnsigned(value); }
+    EmergencyStream& operator<<(double value);
+    EmergencyStream& operator<<(const void* pointer);
+
+   private:
+    EmergencyStream& appendSigned(long long value);
+    EmergencyStream& appendUnsigned(unsigned long long value);
+
+    /**
+     * @brief Appends as much of the text as fits, keeping room for the newline.
+     */
+    void append(const char* text, size_t length);
+
+   private:
+    char buffer_[kEmergencyBufferSize];  //!< The line being formatted.
+    size_t length_ = 0;                  //!< Bytes used in buffer_.
+    const char* file_;                   //!< Source file of the statement.
+    uint32_t line_;                      //!< Source line of the statement.
+};
+
+}  // namespace vne::log
@@ -10,19 +10,71 @@
  */
 
 #include "file_log_sink.h"
+#include "emergency_log.h"
 #include "log_formatter.h"
 
 #include <iostream>
 #include <exception>
 #include <filesystem>
 
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+void closeFd(int fd) {
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32)
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+/**
+ * @brief Opens a second, append-mode descriptor of the file and registers it for EmergencyStream.
+ *
+ * @return The descriptor, or -1 if it could not be opened or the emergency table is full.
+ */
+int openEmergencyFd(const std::string& filename) {
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32)
+    int fd = _open(filename.c_str(), _O_WRONLY | _O_APPEND | _O_BINARY);
+#else
+    int fd = ::open(filename.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+#endif
+    if (fd >= 0 && !vne::log::EmergencyLog::registerFd(fd)) {
+        std::cerr << "[WARN] : " << vne::log::kMaxEmergencyFds
+                  << " emergency outputs are in use; emergency lines will not reach " << filename << std::endl;
+        closeFd(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+void closeEmergencyFd(int& fd) {
+    if (fd < 0) {
+        return;
+    }
+    // Waits for emergency writes in progress, which must not land on a file that reuses the number
+    vne::log::EmergencyLog::unregisterFd(fd);
+    closeFd(fd);
+    fd = -1;
+}
+
+}  // namespace
+
 namespace vne {  // Outer namespace
 namespace log {  // Inner namespace
 
-FileLogSink::FileLogSink(const std::string& filename, bool append)
+FileLogSink::FileLogSink(const std::string& filename, bool append, bool emergency_output)
     : pattern_("%x [%l] [%!] %v")
     , file_name_(filename)
     , is_append_(append)
+    , emergency_output_(emergency_output)
 
 {
     try {
@@ -37,16 +89,26 @@ FileLogSink::FileLogSink(const std::string& filename, bool append)
             std::filesystem::create_directories(directory);
         }
 
-        file_stream_.open(filename.c_str(), append ? std::ofstream::out | std::ofstream::app : std::ofstream::out);
+        // Truncate first if asked, then always write in append mode so that emergency lines
+        // written through the second descriptor are never overwritten by the stream
+        if (!append) {
+            file_stream_.open(filename.c_str(), std::ofstream::out | std::ofstream::trunc);
+            file_stream_.close();
+        }
+        file_stream_.open(filename.c_str(), std::ofstream::out | std::ofstream::app);
         if (!file_stream_.is_open()) {
             throw std::runtime_error("Couldn't open file " + filename + " for write.");
         }
+        if (emergency_output_) {
+            emergency_fd_ = openEmergencyFd(filename);
+        }
     } catch (std::exception& ex) {
         std::cerr << "[ERROR] : " << ex.what() << std::endl;
     }
 }
 
 FileLogSink::~FileLogSink() {
+    closeEmergencyFd(emergency_fd_);
     if (file_stream_.is_open()) {
         file_stream_.close();
     }
@@ -62,11 +124,50 @@ void FileLogSink::log(const std::string& name,
     std::string formatted_log =
         LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_);
     file_stream_ << formatted_log << '\n';
+    counters_.countWrite(formatted_log.size() + 1, file_stream_.is_open() && file_stream_.good());
+}
+
+bool FileLogSink::formatTo(std::string& out,
+                           const std::string& name,
+                           LogLevel level,
+                           TimeStampType time_stamp_type,
+                           const std::string& message,
+                           const std::string& file,
+                           const std::string& function,
+                           uint32_t line) {
+    std::string formatted_log =
+        LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_);
+    out.append(formatted_log).push_back('\n');
+    counters_.countFormatted(formatted_log.size() + 1);
+    return true;
+}
+
+void FileLogSink::writeFormatted(std::string_view text, size_t messages) {
+    file_stream_.write(text.data(), static_cast<std::streamsize>(text.size()));
+    counters_.countBufferWrite(messages, text.size(), file_stream_.is_open() && file_stream_.good());
 }
 
 void FileLogSink::flush() {
     if (file_stream_.is_open()) {
         file_stream_.flush();
+        counters_.countFlush();
+    }
+}
+
+void FileLogSink::reopen() {
+    if (file_stream_.is_open()) {
+        file_stream_.flush();
+        file_stream_.close();
+    }
+    file_stream_.clear();
+    closeEmergencyFd(emergency_fd_);
+    file_stream_.open(file_name_.c_str(), std::ofstream::out | std::ofstream::app);
+    if (!file_stream_.is_open()) {
+        std::cerr << "[ERROR] : Couldn't reopen file " << file_name_ << " for write." << std::endl;
+        return;
+    }
+    if (emergency_output_) {
+        emergency_fd_ = openEmergencyFd(file_name_);
     }
 }
 
@@ -87,7 +188,15 @@ bool FileLogSink::isAppend() const {
 }
 
 std::unique_ptr<ILogSink> FileLogSink::clone() const {
-    return std::make_unique<FileLogSink>(file_name_, is_append_);
+    return std::make_unique<FileLogSink>(file_name_, is_append_, emergency_output_);
+}
+
+SinkStats FileLogSink::getStats() const {
+    return counters_.snapshot();
+}
+
+void FileLogSink::resetStats() {
+    counters_.reset();
 }
 
 }  // namespace log
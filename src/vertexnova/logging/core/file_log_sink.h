@@ -34,8 +34,10 @@ class FileLogSink : public ILogSink {
      *
      * @param filename The name of the file to log to.
      * @param append A flag for opening mode append. Defaults to true.
+     * @param emergency_output Whether EmergencyStream lines also go to the file; this takes a second
+     *                         descriptor and one of the kMaxEmergencyFds slots.
      */
-    FileLogSink(const std::string& filename, bool append = true);
+    FileLogSink(const std::string& filename, bool append = true, bool emergency_output = true);
 
     /**
      * @brief Destructor.
@@ -67,6 +69,33 @@ class FileLogSink : public ILogSink {
              const std::string& function,
              uint32_t line) override;
 
+    /**
+     * @brief Returns true: formatTo() is supported and safe to call from several threads.
+     */
+    [[nodiscard]] bool canFormatTo() const override { return true; }
+
+    /**
+     * @brief Appends the formatted message and a newline to out.
+     *
+     * @return Always true.
+     */
+    bool formatTo(std::string& out,
+                  const std::string& name,
+                  LogLevel level,
+                  TimeStampType time_stamp_type,
+                  const std::string& message,
+                  const std::string& file,
+                  const std::string& function,
+                  uint32_t line) override;
+
+    /**
+     * @brief Writes a buffer of formatted messages to the file.
+     *
+     * @param text One or more formatted messages.
+     * @param messages The number of messages in text.
+     */
+    void writeFormatted(std::string_view text, size_t messages) override;
+
     /**
      * @brief Flushes the file output.
      *
@@ -74,6 +103,14 @@ class FileLogSink : public ILogSink {
      */
     void flush() override;
 
+    /**
+     * @brief Flushes and closes the file, then opens the same path again for appending.
+     *
+     * After an external tool (e.g. logrotate) renamed the file, this starts a
+     * new file under the original name.
+     */
+    void reopen() override;
+
     /**
      * @brief Gets the current log pattern.
      *
@@ -107,6 +144,13 @@ class FileLogSink : public ILogSink {
      */
     [[nodiscard]] bool isAppend() const;
 
+    /**
+     * @brief Returns whether EmergencyStream lines reach the file.
+     *
+     * False if emergency output was not asked for, or if the emergency descriptor table was full.
+     */
+    [[nodiscard]] bool hasEmergencyOutput() const { return emergency_fd_ >= 0; }
+
     /**
      * @brief Creates a new instance of the file log sink.
      *
@@ -116,6 +160,18 @@ class FileLogSink : public ILogSink {
      */
     [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
 
+    /**
+     * @brief Returns a snapshot of the sink's runtime counters.
+     *
+     * @return The sink statistics.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the sink's runtime counters to zero.
+     */
+    void resetStats() override;
+
    private:
     // Deleted copy constructor and assignment operator
     FileLogSink(const FileLogSink&) = delete;
@@ -126,6 +182,9 @@ class FileLogSink : public ILogSink {
     std::ofstream file_stream_;  //!< Output file stream for logging.
     std::string file_name_;      //!< The name of the file to log to.
     bool is_append_;             //!< The flag of opening mode
+    bool emergency_output_;      //!< Whether to reserve a descriptor for EmergencyStream.
+    SinkCounters counters_;      //!< Runtime statistics.
+    int emergency_fd_ = -1;      //!< Append-mode descriptor of the file reserved for EmergencyStream.
 };
 
 }  // namespace vne::log
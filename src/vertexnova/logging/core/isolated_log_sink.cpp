@@ -0,0 +1,216 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "isolated_log_sink.h"
+#include "log_crash_handler.h"
+
+#include <future>
+#include <thread>
+
+namespace {
+
+constexpr auto kBlockPollInterval = std::chrono::milliseconds(10);  //!< How often a blocked log() checks for a crash.
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+IsolatedLogSink::IsolatedLogSink(std::unique_ptr<ILogSink> sink, const SinkBufferOptions& options)
+    : sink_(std::move(sink))
+    , options_(options)
+    , worker_(queue_) {
+    if (options_.capacity == 0) {
+        options_.capacity = 1;
+    }
+    // The logger's idle notification arrives on its own worker; this is the thread that writes
+    worker_.setBatchEndHook([this] {
+        if (queue_.empty()) {
+            sink_->onIdle();
+        }
+    });
+    worker_.start();
+}
+
+IsolatedLogSink::~IsolatedLogSink() {
+    worker_.stop();
+    // The worker may have stopped with messages left; write them here
+    worker_.flush();
+    sink_->flush();
+}
+
+void IsolatedLogSink::log(const std::string& name,
+                          LogLevel level,
+                          TimeStampType time_stamp_type,
+                          const std::string& message,
+                          const std::string& file,
+                          const std::string& function,
+                          uint32_t line) {
+    if (!reserveSlot()) {
+        return;
+    }
+    PendingRecord* pending = records_.acquire();
+    pending->is_trace = false;
+    pending->record.assign(LogRecord{name, level, time_stamp_type, message, file, function, line});
+    enqueue(pending);
+}
+
+void IsolatedLogSink::logTraceEvent(const TraceEvent& event) {
+    if (!reserveSlot()) {
+        return;
+    }
+    PendingRecord* pending = records_.acquire();
+    pending->is_trace = true;
+    pending->trace_event = event;
+    enqueue(pending);
+}
+
+void IsolatedLogSink::flush() {
+    if (LogCrashHandler::isCrashing()) {
+        // The worker may be the crashed thread; drainOnCrash() waits for it with a deadline
+        return;
+    }
+    if (worker_.isWorkerThread()) {
+        sink_->flush();
+        return;
+    }
+    // A flush queued after every message pushed so far covers this request too. pushed_ only counts
+    // messages already in the queue, so the flush pushed below lands behind all of them
+    const uint64_t pushed = pushed_.load(std::memory_order_acquire);
+    uint64_t covered = flush_covers_.load(std::memory_order_acquire);
+    do {
+        if (covered >= pushed) {
+            return;
+        }
+    } while (!flush_covers_.compare_exchange_weak(covered, pushed, std::memory_order_acq_rel));
+    ILogSink* sink = sink_.get();
+    queue_.pushControl([sink] { sink->flush(); });
+}
+
+void IsolatedLogSink::reopen() {
+    runOnWorker([](ILogSink& sink) { sink.reopen(); });
+}
+
+bool IsolatedLogSink::drainOnCrash(std::chrono::steady_clock::time_point deadline) {
+    if (worker_.isWorkerThread()) {
+        // The wrapped sink crashed in a task; what is still buffered can be written from here
+        std::function<void()> log_task;
+        while (queue_.tryPopIfUnlocked(log_task)) {
+            if (log_task) {
+                log_task();
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+        }
+    } else {
+        // The wrapped sink is not thread-safe, so wait for the worker instead of competing with it
+        while (!queue_.isIdle()) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    return sink_->drainOnCrash(deadline);
+}
+
+std::string IsolatedLogSink::getPattern() const {
+    return sink_->getPattern();
+}
+
+void IsolatedLogSink::setPattern(const std::string& pattern) {
+    sink_->setPattern(pattern);
+}
+
+std::unique_ptr<ILogSink> IsolatedLogSink::clone() const {
+    return std::make_unique<IsolatedLogSink>(sink_->clone(), options_);
+}
+
+SinkStats IsolatedLogSink::getStats() const {
+    SinkStats stats = sink_->getStats();
+    stats.dropped += dropped_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void IsolatedLogSink::resetStats() {
+    sink_->resetStats();
+    dropped_.store(0, std::memory_order_relaxed);
+}
+
+bool IsolatedLogSink::reserveSlot() {
+    size_t buffered = buffered_.load(std::memory_order_relaxed);
+    while (buffered < options_.capacity) {
+        if (buffered_.compare_exchange_weak(buffered, buffered + 1, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    if (options_.overflow == OverflowPolicy::eBlock) {
+        std::unique_lock<std::mutex> lock(space_mutex_);
+        while (!LogCrashHandler::isCrashing()) {
+            buffered = buffered_.load(std::memory_order_relaxed);
+            if (buffered < options_.capacity
+                && buffered_.compare_exchange_strong(buffered, buffered + 1, std::memory_order_relaxed)) {
+                return true;
+            }
+            space_freed_.wait_for(lock, kBlockPollInterval);
+        }
+    }
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void IsolatedLogSink::enqueue(PendingRecord* pending) {
+    // Two pointers fit in std::function's inline storage, so the task itself does not allocate
+    queue_.push([this, pending] {
+        if (pending->is_trace) {
+            sink_->logTraceEvent(pending->trace_event);
+        } else {
+            const LogRecordBuffer& buffer = pending->record;
+            sink_->log(buffer.category,
+                       buffer.level,
+                       buffer.time_stamp_type,
+                       buffer.message,
+                       buffer.file,
+                       buffer.function,
+                       buffer.line);
+        }
+        releaseRecord(pending);
+    });
+    pushed_.fetch_add(1, std::memory_order_release);
+}
+
+void IsolatedLogSink::runOnWorker(void (*action)(ILogSink&)) {
+    if (worker_.isWorkerThread()) {
+        action(*sink_);
+        return;
+    }
+    ILogSink* sink = sink_.get();
+    std::promise<void> finished;
+    std::promise<void>* done = &finished;
+    queue_.pushControl([sink, action, done] {
+        action(*sink);
+        done->set_value();
+    });
+    finished.get_future().wait();
+}
+
+void IsolatedLogSink::releaseRecord(PendingRecord* pending) {
+    records_.release(pending);
+    buffered_.fetch_sub(1, std::memory_order_relaxed);
+    if (options_.overflow == OverflowPolicy::eBlock) {
+        std::lock_guard<std::mutex> lock(space_mutex_);
+        space_freed_.notify_one();
+    }
+}
+
+}  // namespace log
+}  // namespace vne
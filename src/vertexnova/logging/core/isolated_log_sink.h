@@ -0,0 +1,211 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_sink.h"
+#include "log_record.h"
+#include "log_queue.h"
+#include "log_queue_worker.h"
+#include "record_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace vne::log {
+
+/**
+ * @enum OverflowPolicy
+ * @brief What an IsolatedLogSink does with a message when its buffer is full.
+ */
+enum class OverflowPolicy : uint8_t {
+    eBlock = 0,      //!< Wait until the sink's worker has made room; a stalled sink then stalls the logger.
+    eDropNewest = 1  //!< Discard the message and count it in SinkStats::dropped; the caller never waits.
+};
+
+/**
+ * @struct SinkBufferOptions
+ * @brief Size and overflow policy of an IsolatedLogSink's buffer.
+ */
+struct SinkBufferOptions {
+    size_t capacity = 8192;                                 //!< Messages that may wait for the sink's worker.
+    OverflowPolicy overflow = OverflowPolicy::eDropNewest;  //!< What to do when capacity messages are waiting.
+};
+
+/**
+ * @class IsolatedLogSink
+ * @brief Gives another sink its own bounded queue and worker thread.
+ *
+ * An AsyncLogger's worker calls its sinks one after the other, so a sink that
+ * stalls (a terminal over a slow SSH connection, a file on a hung NFS mount)
+ * holds up every other sink of the logger. Wrapped in an IsolatedLogSink, the
+ * slow sink only receives a copy of each message in its own buffer and writes
+ * it on its own thread; the logger's worker moves on to the next sink at once.
+ *
+ * When the buffer holds SinkBufferOptions::capacity messages, the overflow
+ * policy decides whether log() discards the message (eDropNewest, the
+ * default) or waits for room (eBlock). eBlock loses nothing but couples the
+ * logger to the sink again once the buffer is full: a sink that stalls for
+ * longer than it takes to fill the buffer then stalls every other sink too.
+ *
+ * flush() queues a flush of the wrapped sink behind the buffered messages and
+ * returns at once, so a flush-level message does not wait for a slow sink;
+ * a request is folded into a queued flush only if no message was pushed
+ * after that one.
+ * reopen() runs on the worker in the same way but waits for it. Crash
+ * draining and destruction wait for the buffer to be written. The wrapped
+ * sink is only ever called from the worker, so it need not be thread-safe.
+ */
+class IsolatedLogSink : public ILogSink {
+   public:
+    /**
+     * @brief Wraps a sink and starts its worker thread.
+     *
+     * @param sink The sink to isolate.
+     * @param options The buffer size and overflow policy.
+     */
+    explicit IsolatedLogSink(std::unique_ptr<ILogSink> sink, const SinkBufferOptions& options = {});
+
+    /**
+     * @brief Writes the buffered messages and stops the worker thread.
+     */
+    ~IsolatedLogSink() override;
+
+    /**
+     * @brief Copies the message into the buffer for the worker to write.
+     */
+    void log(const std::string& name,
+             LogLevel level,
+             TimeStampType time_stamp_type,
+             const std::string& message,
+             const std::string& file,
+             const std::string& function,
+             uint32_t line) override;
+
+    /**
+     * @brief Copies the trace event into the buffer for the worker to write.
+     *
+     * @param event The span event.
+     */
+    void logTraceEvent(const TraceEvent& event) override;
+
+    /**
+     * @brief Queues a flush of the wrapped sink behind the buffered messages; does not wait for it.
+     */
+    void flush() override;
+
+    /**
+     * @brief Reopens the wrapped sink once the buffered messages are written.
+     */
+    void reopen() override;
+
+    /**
+     * @brief Lets the worker finish the buffer and flushes the wrapped sink while the process is crashing.
+     *
+     * If the worker itself crashed, what is left in the buffer is written on the calling thread.
+     *
+     * @param deadline When to give up.
+     * @return True if the buffer was written and the sink flushed before the deadline.
+     */
+    bool drainOnCrash(std::chrono::steady_clock::time_point deadline) override;
+
+    /**
+     * @brief Returns the wrapped sink's pattern.
+     */
+    [[nodiscard]] std::string getPattern() const override;
+
+    /**
+     * @brief Sets the wrapped sink's pattern.
+     *
+     * @param pattern The new log pattern.
+     */
+    void setPattern(const std::string& pattern) override;
+
+    /**
+     * @brief Returns an isolated clone of the wrapped sink with the same buffer options.
+     */
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
+
+    /**
+     * @brief Returns the wrapped sink's counters together with the messages dropped on overflow.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the wrapped sink's counters and the dropped count.
+     */
+    void resetStats() override;
+
+    /**
+     * @brief Returns the sink that messages are written to.
+     */
+    [[nodiscard]] ILogSink& getWrappedSink() const { return *sink_; }
+
+    /**
+     * @brief Returns the buffer size and overflow policy.
+     */
+    [[nodiscard]] const SinkBufferOptions& getOptions() const { return options_; }
+
+    /**
+     * @brief Returns the number of messages waiting for the worker.
+     */
+    [[nodiscard]] size_t getBufferedCount() const { return buffered_.load(std::memory_order_relaxed); }
+
+   private:
+    /**
+     * @brief A buffered message or trace event.
+     */
+    struct PendingRecord {
+        LogRecordBuffer record;  //!< Owned copy of the message.
+        TraceEvent trace_event;  //!< Copy of the trace event.
+        bool is_trace = false;   //!< Whether trace_event rather than record is to be written.
+    };
+
+    /**
+     * @brief Reserves a buffer slot according to the overflow policy.
+     *
+     * @return False if the message is to be dropped.
+     */
+    bool reserveSlot();
+
+    /**
+     * @brief Queues the task that writes a pooled record.
+     */
+    void enqueue(PendingRecord* pending);
+
+    /**
+     * @brief Runs a task on the worker after the buffered messages and waits for it.
+     */
+    void runOnWorker(void (*action)(ILogSink&));
+
+    /**
+     * @brief Returns a record to the pool and frees its buffer slot.
+     */
+    void releaseRecord(PendingRecord* pending);
+
+   private:
+    std::unique_ptr<ILogSink> sink_;         //!< The isolated sink.
+    SinkBufferOptions options_;              //!< Buffer size and overflow policy.
+    std::atomic<size_t> buffered_{0};        //!< Messages reserved in the buffer.
+    std::atomic<uint64_t> dropped_{0};       //!< Messages discarded on overflow.
+    std::atomic<uint64_t> pushed_{0};        //!< Messages pushed onto the buffer so far.
+    std::atomic<uint64_t> flush_covers_{0};  //!< Value of pushed_ when the latest flush was queued.
+    std::mutex space_mutex_;                 //!< Guards waiting for room (eBlock).
+    std::condition_variable space_freed_;    //!< Signalled when the worker frees a slot.
+    RecordPool<PendingRecord> records_;      //!< Buffer entries, reused.
+    LogQueue queue_;                         //!< The sink's buffer.
+    LogQueueWorker worker_;                  //!< The sink's worker thread.
+};
+
+}  // namespace vne::log
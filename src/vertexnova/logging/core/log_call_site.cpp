@@ -0,0 +1,311 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_call_site.h"
+
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <limits>
+#include <mutex>
+
+namespace vne::log {
+
+/**
+ * @brief An override rule set through LogCallSite::applySpec or LogCallSite::applyCategoryLevel.
+ */
+struct CallSiteRule {
+    std::string file_glob;                          //!< Glob matched against the source path (empty: any).
+    uint32_t first_line = 0;                        //!< First matching line.
+    uint32_t last_line = 0;                         //!< Last matching line.
+    std::string category;                           //!< Category to match (empty: any).
+    CallSiteState state = CallSiteState::eDefault;  //!< Override applied to matching call sites.
+    bool by_level = false;                          //!< Derive the override from min_level instead.
+    LogLevel min_level = LogLevel::eTrace;          //!< Lowest level enabled when by_level is set.
+};
+
+bool globMatch(std::string_view glob, std::string_view text) {
+    size_t g = 0;
+    size_t t = 0;
+    size_t star = std::string_view::npos;
+    size_t star_text = 0;
+    while (t < text.size()) {
+        if (g < glob.size() && (glob[g] == '?' || glob[g] == text[t])) {
+            ++g;
+            ++t;
+        } else if (g < glob.size() && glob[g] == '*') {
+            star = g++;
+            star_text = t;
+        } else if (star != std::string_view::npos) {
+            g = star + 1;
+            t = ++star_text;
+        } else {
+            return false;
+        }
+    }
+    while (g < glob.size() && glob[g] == '*') {
+        ++g;
+    }
+    return g == glob.size();
+}
+
+}  // namespace vne::log
+
+namespace {
+
+using vne::log::CallSiteRule;
+using vne::log::CallSiteState;
+using vne::log::globMatch;
+
+/**
+ * @brief Guards the list of live call sites and the rules.
+ */
+std::mutex& registryMutex() {
+    static std::mutex s_mutex;
+    return s_mutex;
+}
+
+/**
+ * @brief Rules in the order they were applied; guarded by registryMutex().
+ */
+std::vector<CallSiteRule>& rules() {
+    static std::vector<CallSiteRule> s_rules;
+    return s_rules;
+}
+
+/**
+ * @brief Matches the whole path, or any trailing part of it that starts after a separator.
+ */
+bool pathMatches(std::string_view glob, std::string_view path) {
+    if (globMatch(glob, path)) {
+        return true;
+    }
+    for (size_t i = 0; i < path.size(); ++i) {
+        if ((path[i] == '/' || path[i] == '\\') && globMatch(glob, path.substr(i + 1))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ruleMatches(const CallSiteRule& rule, const char* file, uint32_t line, std::string_view category) {
+    return line >= rule.first_line && line <= rule.last_line
+           && (rule.category.empty() || rule.category == category)
+           && (rule.file_glob.empty() || pathMatches(rule.file_glob, file));
+}
+
+/**
+ * @brief Returns the override a matching rule gives a call site of the given level.
+ */
+CallSiteState ruleState(const CallSiteRule& rule, vne::log::LogLevel level) {
+    if (!rule.by_level) {
+        return rule.state;
+    }
+    return level >= rule.min_level ? CallSiteState::eEnabled : CallSiteState::eDisabled;
+}
+
+bool parseLine(std::string_view text, uint32_t& line) {
+    const char* end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, line);
+    return ec == std::errc() && ptr == end;
+}
+
+/**
+ * @brief Parses `<file-glob>[:<line>[-<line>]]`.
+ *
+ * A colon followed by anything but digits and a dash belongs to the glob (e.g. a drive letter).
+ */
+bool parseSpec(std::string_view spec, CallSiteRule& rule) {
+    rule.first_line = 0;
+    rule.last_line = std::numeric_limits<uint32_t>::max();
+    std::string_view glob = spec;
+    size_t colon = spec.rfind(':');
+    if (colon != std::string_view::npos && colon + 1 < spec.size()
+        && spec.find_first_not_of("0123456789-", colon + 1) == std::string_view::npos) {
+        std::string_view lines = spec.substr(colon + 1);
+        glob = spec.substr(0, colon);
+        size_t dash = lines.find('-');
+        if (dash == std::string_view::npos) {
+            if (!parseLine(lines, rule.first_line)) {
+                return false;
+            }
+            rule.last_line = rule.first_line;
+        } else if (!parseLine(lines.substr(0, dash), rule.first_line)
+                   || !parseLine(lines.substr(dash + 1), rule.last_line) || rule.last_line < rule.first_line) {
+            return false;
+        }
+    }
+    if (glob.empty()) {
+        return false;
+    }
+    rule.file_glob = std::string(glob);
+    return true;
+}
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+std::atomic<bool> LogCallSite::s_profiling_enabled{false};
+LogCallSite* LogCallSite::s_first = nullptr;
+
+LogCallSite::LogCallSite(std::string_view category,
+                         LogLevel level,
+                         const char* file,
+                         uint32_t line,
+                         const char* function)
+    : category_(category)
+    , level_(level)
+    , file_(file)
+    , line_(line)
+    , function_(function) {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (const CallSiteRule& rule : rules()) {
+        if (ruleMatches(rule, file_, line_, category_)) {
+            state_.store(ruleState(rule, level_), std::memory_order_relaxed);
+        }
+    }
+    next_ = s_first;
+    s_first = this;
+}
+
+LogCallSite::~LogCallSite() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (LogCallSite** link = &s_first; *link; link = &(*link)->next_) {
+        if (*link == this) {
+            *link = next_;
+            break;
+        }
+    }
+}
+
+CallSiteProfile LogCallSite::profile() const {
+    CallSiteProfile profile;
+    profile.file = file_;
+    profile.line = line_;
+    profile.function = function_;
+    profile.category = category_;
+    profile.level = level_;
+    profile.state = state_.load(std::memory_order_relaxed);
+    profile.messages = messages_.load(std::memory_order_relaxed);
+    profile.bytes = bytes_.load(std::memory_order_relaxed);
+    return profile;
+}
+
+void LogCallSite::setProfilingEnabled(bool enabled) {
+    s_profiling_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<CallSiteProfile> LogCallSite::collectProfile() {
+    std::vector<CallSiteProfile> profiles;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (const LogCallSite* site = s_first; site; site = site->next_) {
+            if (site->messages_.load(std::memory_order_relaxed) > 0) {
+                profiles.push_back(site->profile());
+            }
+        }
+    }
+    std::sort(profiles.begin(), profiles.end(), [](const CallSiteProfile& lhs, const CallSiteProfile& rhs) {
+        if (lhs.bytes != rhs.bytes) {
+            return lhs.bytes > rhs.bytes;
+        }
+        return lhs.messages > rhs.messages;
+    });
+    return profiles;
+}
+
+std::vector<CallSiteProfile> LogCallSite::collectCallSites() {
+    std::vector<CallSiteProfile> sites;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (const LogCallSite* site = s_first; site; site = site->next_) {
+            sites.push_back(site->profile());
+        }
+    }
+    std::sort(sites.begin(), sites.end(), [](const CallSiteProfile& lhs, const CallSiteProfile& rhs) {
+        if (lhs.file != rhs.file) {
+            return lhs.file < rhs.file;
+        }
+        return lhs.line < rhs.line;
+    });
+    return sites;
+}
+
+void LogCallSite::resetProfile() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (LogCallSite* site = s_first; site; site = site->next_) {
+        site->messages_.store(0, std::memory_order_relaxed);
+        site->bytes_.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t LogCallSite::applySpec(std::string_view spec, CallSiteState state) {
+    CallSiteRule rule;
+    if (!parseSpec(spec, rule)) {
+        std::cerr << "[ERROR] : Invalid call-site spec '" << spec << "', expected <file-glob>[:<line>[-<line>]]"
+                  << std::endl;
+        return 0;
+    }
+    rule.state = state;
+    return addRule(std::move(rule));
+}
+
+size_t LogCallSite::applyCategoryLevel(std::string_view category, LogLevel level) {
+    CallSiteRule rule;
+    rule.last_line = std::numeric_limits<uint32_t>::max();
+    rule.category = std::string(category);
+    rule.by_level = true;
+    rule.min_level = level;
+    return addRule(std::move(rule));
+}
+
+size_t LogCallSite::addRule(CallSiteRule rule) {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    size_t matched = 0;
+    for (LogCallSite* site = s_first; site; site = site->next_) {
+        if (ruleMatches(rule, site->file_, site->line_, site->category_)) {
+            site->state_.store(ruleState(rule, site->level_), std::memory_order_relaxed);
+            ++matched;
+        }
+    }
+    // A rule for the same statements supersedes the old one, so repeated calls do not grow the list;
+    // it moves to the end because later rules override earlier ones for new call sites
+    std::vector<CallSiteRule>& applied = rules();
+    applied.erase(std::remove_if(applied.begin(),
+                                 applied.end(),
+                                 [&rule](const CallSiteRule& existing) {
+                                     return existing.file_glob == rule.file_glob
+                                            && existing.first_line == rule.first_line
+                                            && existing.last_line == rule.last_line
+                                            && existing.category == rule.category;
+                                 }),
+                  applied.end());
+    applied.push_back(std::move(rule));
+    return matched;
+}
+
+size_t LogCallSite::getRuleCount() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    return rules().size();
+}
+
+void LogCallSite::resetStates() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    rules().clear();
+    for (LogCallSite* site = s_first; site; site = site->next_) {
+        site->state_.store(CallSiteState::eDefault, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,217 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_level.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file log_call_site.h
+ *
+ * @brief Static descriptor of one VNE_LOG_* statement.
+ *
+ * Every logging macro expands to a function-local static LogCallSite, created
+ * the first time the statement runs and registered in a process-wide list.
+ * It identifies the statement (file, line, function, category, level), holds
+ * its enable override and, while log profiling is enabled, counts the
+ * messages and message bytes it produces. Registration links the descriptor
+ * into an intrusive list, so the first run of a statement does not allocate
+ * beyond copying a long category name.
+ */
+
+namespace vne::log {
+
+/**
+ * @enum CallSiteState
+ * @brief Per-statement override of the logger's level filter.
+ */
+enum class CallSiteState : uint8_t {
+    eDefault = 0,  //!< The logger's level decides.
+    eEnabled = 1,  //!< Logged even below the logger's level.
+    eDisabled = 2  //!< Never logged; the message is not formatted.
+};
+
+struct CallSiteRule;
+
+/**
+ * @brief Matches text against a glob with `*` (any run) and `?` (any one character).
+ */
+bool globMatch(std::string_view glob, std::string_view text);
+
+/**
+ * @struct CallSiteProfile
+ * @brief Snapshot of one call site: where it is, its override and the volume it produced.
+ */
+struct CallSiteProfile {
+    std::string file;                               //!< Source file of the statement.
+    uint32_t line = 0;                              //!< Source line of the statement.
+    std::string function;                           //!< Function containing the statement.
+    std::string category;                           //!< Category of the statement.
+    LogLevel level = LogLevel::eInfo;               //!< Level of the statement.
+    CallSiteState state = CallSiteState::eDefault;  //!< Enable override.
+    uint64_t messages = 0;                          //!< Messages accepted by the logger.
+    uint64_t bytes = 0;                             //!< Message text bytes, before sink formatting.
+};
+
+/**
+ * @class LogCallSite
+ * @brief Descriptor, enable override and volume counters of one logging statement.
+ */
+class LogCallSite {
+   public:
+    /**
+     * @brief Creates the descriptor, registers it and applies matching enable rules.
+     *
+     * @param category The category of the statement (copied).
+     * @param level The level of the statement.
+     * @param file The source file; must have static storage duration.
+     * @param line The source line.
+     * @param function The enclosing function; must have static storage duration.
+     */
+    LogCallSite(std::string_view category, LogLevel level, const char* file, uint32_t line, const char* function = "");
+
+    /**
+     * @brief Unregisters the descriptor.
+     */
+    ~LogCallSite();
+
+    LogCallSite(const LogCallSite&) = delete;
+    LogCallSite& operator=(const LogCallSite&) = delete;
+
+    /**
+     * @brief Returns whether the statement is switched off (checked by the logging macros).
+     */
+    [[nodiscard]] bool isDisabled() const {
+        return state_.load(std::memory_order_relaxed) == CallSiteState::eDisabled;
+    }
+
+    /**
+     * @brief Returns this call site, or nullptr if the statement is switched off.
+     */
+    [[nodiscard]] LogCallSite* ifEnabled() { return isDisabled() ? nullptr : this; }
+
+    /**
+     * @brief Returns whether the statement is switched on regardless of the logger's level.
+     */
+    [[nodiscard]] bool isForceEnabled() const {
+        return state_.load(std::memory_order_relaxed) == CallSiteState::eEnabled;
+    }
+
+    /**
+     * @brief Counts one message produced by this statement.
+     *
+     * @param bytes Length of the message text.
+     */
+    void count(size_t bytes) {
+        messages_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns a snapshot of this call site.
+     */
+    [[nodiscard]] CallSiteProfile profile() const;
+
+    /**
+     * @brief Returns whether messages are being counted per call site.
+     */
+    static bool isProfilingEnabled() { return s_profiling_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Starts or stops counting messages per call site.
+     *
+     * @param enabled True to count.
+     */
+    static void setProfilingEnabled(bool enabled);
+
+    /**
+     * @brief Returns every call site that produced a message, noisiest (most bytes) first.
+     */
+    static std::vector<CallSiteProfile> collectProfile();
+
+    /**
+     * @brief Returns every registered call site, ordered by file and line.
+     */
+    static std::vector<CallSiteProfile> collectCallSites();
+
+    /**
+     * @brief Resets the counters of every call site to zero.
+     */
+    static void resetProfile();
+
+    /**
+     * @brief Sets the override of every call site matching a spec, now and when it first runs.
+     *
+     * The spec is `<file-glob>[:<line>[-<line>]]`. The glob matches the whole
+     * source path or any trailing part of it that starts after a path
+     * separator; `*` matches any run of characters and `?` one character.
+     * Examples: `net/socket.cpp:120-200`, `render_*.cpp:88`, `*`.
+     *
+     * Rules are kept and applied in order to statements that have not run yet,
+     * so a later rule wins over an earlier one. A rule for the same glob and
+     * line range replaces the earlier one.
+     *
+     * @param spec The call-site spec.
+     * @param state The override to apply.
+     * @return The number of registered call sites that matched, or 0 if the spec is malformed.
+     */
+    static size_t applySpec(std::string_view spec, CallSiteState state);
+
+    /**
+     * @brief Gives a category its own level, now and for statements that have not run yet.
+     *
+     * Statements of the category at or above the level are enabled even below
+     * their logger's level; those below it are disabled. Like applySpec rules,
+     * a later rule wins, and a new level for the category replaces the old one.
+     *
+     * @param category The category to match exactly.
+     * @param level The lowest level to log.
+     * @return The number of registered call sites of the category.
+     */
+    static size_t applyCategoryLevel(std::string_view category, LogLevel level);
+
+    /**
+     * @brief Drops every rule and returns all call sites to CallSiteState::eDefault.
+     */
+    static void resetStates();
+
+    /**
+     * @brief Returns the number of rules kept for statements that have not run yet.
+     */
+    static size_t getRuleCount();
+
+   private:
+    /**
+     * @brief Applies a rule to the registered call sites and keeps it for later ones.
+     */
+    static size_t addRule(CallSiteRule rule);
+
+   private:
+    std::string category_;                                       //!< Category of the statement.
+    LogLevel level_;                                             //!< Level of the statement.
+    const char* file_;                                           //!< Source file of the statement.
+    uint32_t line_;                                              //!< Source line of the statement.
+    const char* function_;                                       //!< Function containing the statement.
+    std::atomic<CallSiteState> state_{CallSiteState::eDefault};  //!< Enable override.
+    std::atomic<uint64_t> messages_{0};                          //!< Messages counted while profiling.
+    std::atomic<uint64_t> bytes_{0};                             //!< Message bytes counted while profiling.
+    LogCallSite* next_ = nullptr;                                //!< Next registered call site (intrusive list).
+
+    static std::atomic<bool> s_profiling_enabled;  //!< Whether LogStream counts messages.
+    static LogCallSite* s_first;                   //!< Head of the registered call sites.
+};
+
+}  // namespace vne::log
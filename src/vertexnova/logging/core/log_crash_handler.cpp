@@ -0,0 +1,335 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_crash_handler.h"
+#include "logger.h"
+
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32) || defined(VNE_PLATFORM_WEB)
+#define VNE_LOG_CRASH_UNSUPPORTED 1
+#else
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define VNE_LOG_HAS_BACKTRACE 1
+#endif
+#endif
+
+namespace {
+
+using vne::log::ILogger;
+
+constexpr size_t kMaxLoggers = 64;             //!< Loggers beyond this many are not drained.
+std::atomic<ILogger*> s_loggers[kMaxLoggers];  //!< Registered loggers; null slots are free.
+std::atomic<bool> s_handling{false};           //!< Set by the first crash; later ones pass through.
+std::atomic<bool> s_registry_full{false};      //!< Set once a logger did not fit in s_loggers.
+
+#ifndef VNE_LOG_CRASH_UNSUPPORTED
+
+constexpr int kMaxFrames = 64;               //!< Backtrace depth.
+constexpr size_t kRecordCapacity = 512;      //!< Bytes of crash record text, excluding the backtrace.
+constexpr size_t kAltStackSize = 64 * 1024;  //!< Signal stack, so that stack overflows are handled too.
+
+/**
+ * @brief Text appended to a fixed buffer without allocating; overlong text is cut.
+ */
+class RecordWriter {
+   public:
+    void append(const char* text) {
+        while (*text != '\0' && length_ < kRecordCapacity) {
+            buffer_[length_++] = *text++;
+        }
+    }
+
+    void append(uint64_t value) {
+        char digits[24];
+        size_t count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        while (count > 0 && length_ < kRecordCapacity) {
+            buffer_[length_++] = digits[--count];
+        }
+    }
+
+    void clear() { length_ = 0; }
+
+    [[nodiscard]] const char* data() const { return buffer_; }
+    [[nodiscard]] size_t size() const { return length_; }
+
+   private:
+    char buffer_[kRecordCapacity];
+    size_t length_ = 0;
+};
+
+constexpr int kFatalSignals[] = {SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL};
+constexpr size_t kFatalSignalCount = sizeof(kFatalSignals) / sizeof(kFatalSignals[0]);
+
+bool s_installed = false;                                //!< Guarded by the caller of install/uninstall.
+uint32_t s_drain_timeout_ms = 0;                         //!< CrashHandlerOptions::drain_timeout_ms.
+int s_crash_fd = -1;                                     //!< CrashHandlerOptions::crash_file, opened by install.
+struct sigaction s_previous_actions[kFatalSignalCount];  //!< Dispositions before install.
+std::terminate_handler s_previous_terminate = nullptr;   //!< std::terminate handler before install.
+RecordWriter s_record;                                   //!< Crash record text.
+const char* s_exception_what = nullptr;                  //!< what() of the exception that reached std::terminate.
+alignas(16) char s_alt_stack[kAltStackSize];             //!< Stack the handler runs on.
+#ifdef VNE_LOG_HAS_BACKTRACE
+void* s_frames[kMaxFrames];  //!< Return addresses of the crashing thread.
+#endif
+
+const char* signalName(int signal_number) {
+    switch (signal_number) {
+        case SIGSEGV:
+            return "SIGSEGV";
+        case SIGABRT:
+            return "SIGABRT";
+        case SIGBUS:
+            return "SIGBUS";
+        case SIGFPE:
+            return "SIGFPE";
+        case SIGILL:
+            return "SIGILL";
+        default:
+            return "signal";
+    }
+}
+
+void writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written <= 0) {
+            return;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void writeRecord(int fd, int frame_count) {
+    writeAll(fd, s_record.data(), s_record.size());
+#ifdef VNE_LOG_HAS_BACKTRACE
+    if (frame_count > 0) {
+        ::backtrace_symbols_fd(s_frames, frame_count, fd);
+    }
+#else
+    (void)frame_count;
+#endif
+}
+
+void writeRecord(int frame_count) {
+    writeRecord(STDERR_FILENO, frame_count);
+    if (s_crash_fd >= 0) {
+        writeRecord(s_crash_fd, frame_count);
+        ::fsync(s_crash_fd);
+    }
+}
+
+void restorePreviousHandlers() {
+    for (size_t i = 0; i < kFatalSignalCount; ++i) {
+        ::sigaction(kFatalSignals[i], &s_previous_actions[i], nullptr);
+    }
+}
+
+void onFatalSignal(int signal_number) {
+    vne::log::LogCrashHandler::handleCrash(signal_number);
+    // Let the previous handler (by default: terminate, with a core dump) see the signal
+    restorePreviousHandlers();
+    ::raise(signal_number);
+}
+
+[[noreturn]] void onTerminate() {
+    // Not a signal handler, so the exception can be inspected
+    if (std::exception_ptr exception = std::current_exception()) {
+        try {
+            std::rethrow_exception(exception);
+        } catch (const std::exception& ex) {
+            s_exception_what = ex.what();
+        } catch (...) {
+            s_exception_what = "unknown exception";
+        }
+    }
+    vne::log::LogCrashHandler::handleCrash(0);
+    if (s_previous_terminate) {
+        s_previous_terminate();
+    }
+    std::abort();
+}
+
+#endif  // VNE_LOG_CRASH_UNSUPPORTED
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+std::atomic<bool> LogCrashHandler::s_crashing{false};
+
+void LogCrashHandler::registerLogger(ILogger* logger) {
+    for (auto& slot : s_loggers) {
+        ILogger* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, logger)) {
+            return;
+        }
+    }
+    if (!s_registry_full.exchange(true)) {
+        std::cerr << "[WARN] : More than " << kMaxLoggers
+                  << " loggers; the crash handler will not drain the ones that did not fit" << std::endl;
+    }
+}
+
+void LogCrashHandler::unregisterLogger(ILogger* logger) {
+    for (auto& slot : s_loggers) {
+        ILogger* expected = logger;
+        if (slot.compare_exchange_strong(expected, nullptr)) {
+            return;
+        }
+    }
+}
+
+#ifdef VNE_LOG_CRASH_UNSUPPORTED
+
+bool LogCrashHandler::install(const CrashHandlerOptions& /*options*/) {
+    return false;
+}
+
+void LogCrashHandler::uninstall() {}
+
+bool LogCrashHandler::isInstalled() {
+    return false;
+}
+
+void LogCrashHandler::handleCrash(int /*signal_number*/) {}
+
+#else
+
+bool LogCrashHandler::install(const CrashHandlerOptions& options) {
+    if (s_installed) {
+        return false;
+    }
+    s_drain_timeout_ms = options.drain_timeout_ms;
+    if (!options.crash_file.empty()) {
+        s_crash_fd = ::open(options.crash_file.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (s_crash_fd < 0) {
+            std::cerr << "[ERROR] : Couldn't open crash file " << options.crash_file << std::endl;
+        }
+    }
+#ifdef VNE_LOG_HAS_BACKTRACE
+    // The first call may load the unwinder, which allocates; do it now rather than in the handler
+    ::backtrace(s_frames, kMaxFrames);
+#endif
+
+    // Per thread: other threads' stack overflows are not caught (see the header)
+    stack_t alt_stack;
+    std::memset(&alt_stack, 0, sizeof(alt_stack));
+    alt_stack.ss_sp = s_alt_stack;
+    alt_stack.ss_size = sizeof(s_alt_stack);
+    ::sigaltstack(&alt_stack, nullptr);
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = &onFatalSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_ONSTACK;
+    for (size_t i = 0; i < kFatalSignalCount; ++i) {
+        ::sigaction(kFatalSignals[i], &action, &s_previous_actions[i]);
+    }
+    s_previous_terminate = options.handle_terminate ? std::set_terminate(&onTerminate) : nullptr;
+    s_installed = true;
+    return true;
+}
+
+void LogCrashHandler::uninstall() {
+    if (!s_installed) {
+        return;
+    }
+    restorePreviousHandlers();
+    if (s_previous_terminate) {
+        std::set_terminate(s_previous_terminate);
+        s_previous_terminate = nullptr;
+    }
+    if (s_crash_fd >= 0) {
+        ::close(s_crash_fd);
+        s_crash_fd = -1;
+    }
+    s_installed = false;
+}
+
+bool LogCrashHandler::isInstalled() {
+    return s_installed;
+}
+
+void LogCrashHandler::handleCrash(int signal_number) {
+    if (s_handling.exchange(true)) {
+        return;
+    }
+    s_crashing.store(true, std::memory_order_relaxed);
+
+#ifdef VNE_LOG_HAS_BACKTRACE
+    const int frame_count = ::backtrace(s_frames, kMaxFrames);
+#else
+    const int frame_count = 0;
+#endif
+
+    s_record.clear();
+    s_record.append("==== vnelogging crash record: ");
+    if (signal_number == 0) {
+        s_record.append("std::terminate called");
+        if (s_exception_what) {
+            s_record.append(" after an uncaught exception: ");
+            s_record.append(s_exception_what);
+        }
+    } else {
+        s_record.append("fatal signal ");
+        s_record.append(signalName(signal_number));
+        s_record.append(" (");
+        s_record.append(static_cast<uint64_t>(signal_number));
+        s_record.append(")");
+    }
+    s_record.append(" in process ");
+    s_record.append(static_cast<uint64_t>(::getpid()));
+    s_record.append(" ====\nbacktrace:\n");
+    // Written before the drain, which runs sink code and can hang or crash again
+    writeRecord(frame_count);
+
+    // Drain the loggers; each one gets what is left of the timeout
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(s_drain_timeout_ms);
+    uint64_t drained = 0;
+    uint64_t timed_out = 0;
+    for (auto& slot : s_loggers) {
+        if (ILogger* logger = slot.load(std::memory_order_acquire)) {
+            if (logger->drainOnCrash(deadline)) {
+                ++drained;
+            } else {
+                ++timed_out;
+            }
+        }
+    }
+
+    s_record.clear();
+    s_record.append("loggers drained: ");
+    s_record.append(drained);
+    s_record.append(", timed out: ");
+    s_record.append(timed_out);
+    s_record.append("\n==== end of crash record ====\n");
+    writeRecord(0);
+}
+
+#endif  // VNE_LOG_CRASH_UNSUPPORTED
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,119 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file log_crash_handler.h
+ *
+ * @brief Writes out queued log messages when the process crashes.
+ *
+ * Without it, a crash loses the messages still waiting in the async queues
+ * and the text buffered in the file streams, which is usually the context
+ * that explains the crash. Once installed, a fatal signal (SIGSEGV, SIGABRT,
+ * SIGBUS, SIGFPE, SIGILL) or std::terminate:
+ *
+ * 1. stops producers: asynchronous loggers drop new messages;
+ * 2. writes a crash record with a backtrace to stderr and the optional crash
+ *    file, from preallocated buffers with write(2) only;
+ * 3. lets every async worker finish its queue and flushes every logger's
+ *    sinks, giving up on a logger when the drain timeout expires, then ends
+ *    the record with the number of loggers drained and timed out;
+ * 4. restores the previous handler and re-raises, so the exit status and
+ *    core dump are unchanged.
+ *
+ * Step 3 runs the normal sink code, so it is best effort rather than
+ * async-signal-safe. The timeout is only checked between tasks and sink
+ * calls: a sink that hangs or crashes again stops the drain, and the record
+ * then lacks its last line. That is why the record is written first.
+ *
+ * The handler runs on an alternate signal stack, so that a stack overflow is
+ * reported too. sigaltstack() is per thread and install() only sets it up for
+ * the calling thread: a stack overflow on any other thread cannot run the
+ * handler and ends the process without a record or a drain.
+ */
+
+namespace vne::log {
+
+class ILogger;
+
+/**
+ * @struct CrashHandlerOptions
+ * @brief Settings of LogCrashHandler::install.
+ */
+struct CrashHandlerOptions {
+    uint32_t drain_timeout_ms = 2000;  //!< Time allowed for draining queues and flushing sinks.
+    std::string crash_file;            //!< Also append the crash record here (opened by install); empty for none.
+    bool handle_terminate = true;      //!< Also handle std::terminate (uncaught exceptions).
+};
+
+/**
+ * @class LogCrashHandler
+ * @brief Process-wide fatal signal and std::terminate handler that drains the loggers.
+ *
+ * Loggers register themselves on construction, in a fixed table of 64 slots
+ * that the handler can walk without locking or allocating. Loggers beyond
+ * that are not drained; the first one that does not fit is reported on stderr.
+ */
+class LogCrashHandler {
+   public:
+    /**
+     * @brief Installs the fatal signal handlers (and std::terminate handler).
+     *
+     * The alternate signal stack is only installed for the calling thread (see the file comment).
+     *
+     * @param options Drain timeout, crash file and terminate handling.
+     * @return True if installed; false if already installed or unsupported.
+     */
+    static bool install(const CrashHandlerOptions& options = {});
+
+    /**
+     * @brief Restores the previous handlers. Safe to call when not installed.
+     */
+    static void uninstall();
+
+    /**
+     * @brief Returns whether the handlers are installed.
+     */
+    static bool isInstalled();
+
+    /**
+     * @brief Returns whether a crash is being handled; producers stop logging once it is.
+     */
+    static bool isCrashing() { return s_crashing.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Adds a logger to the loggers drained on a crash; called by the logger constructors.
+     */
+    static void registerLogger(ILogger* logger);
+
+    /**
+     * @brief Removes a logger from the loggers drained on a crash; called by the logger destructors.
+     */
+    static void unregisterLogger(ILogger* logger);
+
+    /**
+     * @brief Runs steps 1-3 of the crash sequence; called by the installed handlers.
+     *
+     * Only the first call does anything, and producers stay stopped afterwards.
+     *
+     * @param signal_number The fatal signal, or 0 for std::terminate.
+     */
+    static void handleCrash(int signal_number);
+
+   private:
+    static std::atomic<bool> s_crashing;  //!< Set when a crash is being handled.
+};
+
+}  // namespace vne::log
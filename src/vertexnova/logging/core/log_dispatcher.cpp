@@ -10,17 +10,25 @@
  */
 
 #include "log_dispatcher.h"
+#include "log_crash_handler.h"
+
+#include <future>
+#include <thread>
+#include <utility>
 
 namespace vne {  // Outer namespace
 namespace log {  // Inner namespace
 
 LogDispatcher::LogDispatcher()
     : log_queue_worker_(log_queue_) {
+    log_queue_worker_.setBatchEndHook([this] { onBatchEnd(); });
     log_queue_worker_.start();
 }
 
 LogDispatcher::~LogDispatcher() {
     log_queue_worker_.stop();
+    // Writes what the pipeline still holds; nothing formats into it any more
+    pipeline_.reset();
 }
 
 void LogDispatcher::dispatch(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
@@ -31,25 +39,286 @@ void LogDispatcher::dispatch(const std::vector<std::unique_ptr<ILogSink>>& log_s
                              std::string file,
                              std::string function,
                              uint32_t line) {
-    // Move strings into the lambda capture to avoid copies
-    log_queue_.push([&log_sinks,
-                     name = std::move(name),
-                     level,
-                     time_stamp_type,
-                     message = std::move(message),
-                     file = std::move(file),
-                     function = std::move(function),
-                     line] {
-        for (auto& sink : log_sinks) {
-            sink->log(name, level, time_stamp_type, message, file, function, line);
+    dispatch(log_sinks, LogRecord{name, level, time_stamp_type, message, file, function, line});
+}
+
+bool LogDispatcher::dispatch(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                             const LogRecord& record,
+                             bool priority) {
+    if (LogCrashHandler::isCrashing()) {
+        return false;
+    }
+    enqueueRecord(log_sinks, record, priority, nullptr);
+    return true;
+}
+
+bool LogDispatcher::dispatchAndWait(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                                    const LogRecord& record,
+                                    bool priority) {
+    if (LogCrashHandler::isCrashing()) {
+        return false;
+    }
+    if (log_queue_worker_.isWorkerThread()) {
+        // Waiting here would wait for ourselves
+        enqueueRecord(log_sinks, record, priority, nullptr);
+        return true;
+    }
+    std::promise<void> written;
+    enqueueRecord(log_sinks, record, priority, &written);
+    written.get_future().wait();
+    return true;
+}
+
+void LogDispatcher::dispatch(const std::vector<std::unique_ptr<ILogSink>>& log_sinks, const TraceEvent& event) {
+    if (LogCrashHandler::isCrashing()) {
+        return;
+    }
+    PendingRecord* pending = records_.acquire();
+    pending->trace_event = event;
+    pending->sinks = &log_sinks;
+
+    log_queue_.push([this, pending] {
+        for (auto& sink : *pending->sinks) {
+            sink->logTraceEvent(pending->trace_event);
         }
+        idle_sinks_ = pending->sinks;
+        records_.release(pending);
     });
 }
 
 void LogDispatcher::flush(const std::vector<std::unique_ptr<ILogSink>>& log_sinks) {
-    log_queue_worker_.flush();
+    if (log_queue_worker_.isWorkerThread()) {
+        drainPipeline();
+        for (auto& sink : log_sinks) {
+            sink->flush();
+        }
+        return;
+    }
+    if (LogCrashHandler::isCrashing()) {
+        // The worker may be the crashed thread; drainOnCrash() waits for it with a deadline
+        return;
+    }
+    // Sinks are only ever called from the worker, so the queue is not drained here: running tasks on this
+    // thread would call the sinks concurrently with the worker's batch
+    const std::vector<std::unique_ptr<ILogSink>>* sinks = &log_sinks;
+    std::promise<void> flushed;
+    std::promise<void>* done = &flushed;
+    log_queue_.pushControl([this, sinks, done] {
+        drainPipeline();
+        for (auto& sink : *sinks) {
+            sink->flush();
+        }
+        done->set_value();
+    });
+    flushed.get_future().wait();
+}
+
+void LogDispatcher::setPipelined(bool enabled, size_t formatter_threads) {
+    auto apply = [this, enabled, formatter_threads] {
+        if (enabled) {
+            std::unique_ptr<LogPipeline> replaced;
+            {
+                std::lock_guard<std::mutex> lock(pipeline_mutex_);
+                if (!pipeline_ || pipeline_->getFormatterThreads() != formatter_threads) {
+                    replaced = std::move(pipeline_);
+                    pipeline_ = std::make_unique<LogPipeline>(kDefaultPipelineBuffers, formatter_threads);
+                }
+            }
+            // Writes what the old pipeline holds before anything reaches the new one
+            replaced.reset();
+            pipelined_.store(true, std::memory_order_release);
+        } else {
+            drainPipeline();
+            pipelined_.store(false, std::memory_order_release);
+        }
+    };
+    if (log_queue_worker_.isWorkerThread()) {
+        apply();
+        return;
+    }
+    std::promise<void> switched;
+    std::promise<void>* done = &switched;
+    log_queue_.pushControl([&apply, done] {
+        apply();
+        done->set_value();
+    });
+    switched.get_future().wait();
+}
+
+size_t LogDispatcher::getFormatterThreads() const {
+    std::lock_guard<std::mutex> lock(pipeline_mutex_);
+    return pipeline_ ? pipeline_->getFormatterThreads() : 0;
+}
+
+void LogDispatcher::enqueueRecord(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                                  const LogRecord& record,
+                                  bool priority,
+                                  std::promise<void>* written) {
+    PendingRecord* pending = records_.acquire();
+    pending->record.assign(record);
+    pending->sinks = &log_sinks;
+    pending->written = written;
+
+    // Two pointers fit in std::function's inline storage, so the task itself does not allocate
+    auto log_task = [this, pending] {
+        writeRecord(*pending->sinks, pending->record);
+        idle_sinks_ = pending->sinks;
+        std::promise<void>* done = std::exchange(pending->written, nullptr);
+        if (done) {
+            drainPipeline();
+            for (auto& sink : *pending->sinks) {
+                sink->flush();
+            }
+        }
+        records_.release(pending);
+        if (done) {
+            done->set_value();
+        }
+    };
+    if (priority) {
+        log_queue_.pushPriority(log_task);
+    } else {
+        log_queue_.push(log_task);
+    }
+}
+
+void LogDispatcher::flushPriority(const std::vector<std::unique_ptr<ILogSink>>& log_sinks) {
+    if (LogCrashHandler::isCrashing() || log_queue_worker_.isWorkerThread()) {
+        return;
+    }
+    // Queued behind the priority messages, so the sinks have received them when it runs
+    const std::vector<std::unique_ptr<ILogSink>>* sinks = &log_sinks;
+    std::promise<void> flushed;
+    std::promise<void>* done = &flushed;
+    log_queue_.pushControl(
+        [this, sinks, done] {
+            drainPipeline();
+            for (auto& sink : *sinks) {
+                sink->flush();
+            }
+            done->set_value();
+        },
+        true);
+    flushed.get_future().wait();
+}
+
+void LogDispatcher::reopen(const std::vector<std::unique_ptr<ILogSink>>& log_sinks) {
+    if (log_queue_worker_.isWorkerThread()) {
+        drainPipeline();
+        for (auto& sink : log_sinks) {
+            sink->reopen();
+        }
+        return;
+    }
+    if (LogCrashHandler::isCrashing()) {
+        // The worker may be the crashed thread; drainOnCrash() flushes the files as they are
+        return;
+    }
+    // Run on the worker rather than draining here, so that no sink write overlaps the reopen
+    const std::vector<std::unique_ptr<ILogSink>>* sinks = &log_sinks;
+    std::promise<void> reopened;
+    std::promise<void>* done = &reopened;
+    log_queue_.pushControl([this, sinks, done] {
+        drainPipeline();
+        for (auto& sink : *sinks) {
+            sink->reopen();
+        }
+        done->set_value();
+    });
+    reopened.get_future().wait();
+}
+
+bool LogDispatcher::drainOnCrash(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                                 std::chrono::steady_clock::time_point deadline) {
+    if (log_queue_worker_.isWorkerThread()) {
+        // The worker crashed in a task; the rest of its batch is lost, the queue is not
+        std::function<void()> log_task;
+        while (log_queue_.tryPopIfUnlocked(log_task)) {
+            if (log_task) {
+                log_task();
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+        }
+    } else {
+        // Sinks are not thread-safe, so wait for the worker instead of competing with it
+        while (!log_queue_.isIdle()) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    bool drained = true;
+    if (isPipelined()) {
+        // The queue is written, but possibly only into the pipeline's buffers
+        drained = pipeline_->drainOnCrash(deadline);
+    }
+    for (auto& sink : log_sinks) {
+        drained = sink->drainOnCrash(deadline) && drained;
+    }
+    return drained;
+}
+
+QueueStats LogDispatcher::getStats() const {
+    QueueStats stats;
+    log_queue_.snapshot(stats);
+    log_queue_worker_.snapshot(stats);
+    std::lock_guard<std::mutex> lock(pipeline_mutex_);
+    if (pipeline_) {
+        pipeline_->snapshot(stats);
+    }
+    return stats;
+}
+
+void LogDispatcher::resetStats() {
+    log_queue_.resetStats();
+    log_queue_worker_.resetStats();
+    std::lock_guard<std::mutex> lock(pipeline_mutex_);
+    if (pipeline_) {
+        pipeline_->resetStats();
+    }
+}
+
+void LogDispatcher::writeRecord(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                                const LogRecordBuffer& record) {
+    // Only the worker runs tasks, so the pipeline has a single producer
+    if (isPipelined()) {
+        pipeline_->append(log_sinks, record);
+        return;
+    }
     for (auto& sink : log_sinks) {
-        sink->flush();
+        sink->log(record.category,
+                  record.level,
+                  record.time_stamp_type,
+                  record.message,
+                  record.file,
+                  record.function,
+                  record.line);
+    }
+}
+
+void LogDispatcher::drainPipeline() {
+    if (isPipelined()) {
+        pipeline_->drain();
+    }
+}
+
+void LogDispatcher::onBatchEnd() {
+    if ((idle_sinks_ == nullptr && !isPipelined()) || !log_queue_.empty()) {
+        return;
+    }
+    // Under load the pipeline hands buffers over as they fill; once idle, the rest must not wait for more messages
+    if (isPipelined()) {
+        pipeline_->submit();
+    }
+    // The same goes for sinks that batch on their own
+    if (idle_sinks_ != nullptr) {
+        for (auto& sink : *idle_sinks_) {
+            sink->onIdle();
+        }
+        idle_sinks_ = nullptr;
     }
 }
 
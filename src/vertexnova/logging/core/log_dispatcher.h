@@ -10,11 +10,18 @@
  * ----------------------------------------------------------------------
  */
 
+#include "log_record.h"
 #include "log_sink.h"
 #include "log_queue.h"
 #include "log_queue_worker.h"
+#include "log_pipeline.h"
+#include "record_pool.h"
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 /**
@@ -27,9 +34,20 @@
  * process log messages, ensuring efficient logging without blocking the main
  * application thread.
  *
+ * Each dispatched message is copied into a pooled PendingRecord and the queue
+ * only carries a two-pointer task referring to it, which fits in
+ * std::function's inline storage. Records are returned to the pool after the
+ * worker has passed them to the sinks, so once the pool has grown to the peak
+ * number of in-flight messages, dispatching does not allocate.
+ *
+ * Optionally the backend is pipelined (setPipelined()): the worker then only
+ * formats messages into buffers and a LogPipeline's I/O thread writes them, so
+ * that formatting the next batch overlaps writing the previous one.
+ *
  * @see ILogSink
  * @see LogQueue
  * @see LogQueueWorker
+ * @see LogPipeline
  */
 
 namespace vne::log {
@@ -62,7 +80,8 @@ class LogDispatcher {
      * @param function The function name where the log was generated.
      * @param line The line number where the log was generated.
      *
-     * @note Parameters are taken by value to enable move semantics for better performance.
+     * @note Kept for existing callers; forwards to the LogRecord overload, which copies the
+     *       fields into a pooled record.
      */
     void dispatch(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
                   std::string name,
@@ -73,24 +92,189 @@ class LogDispatcher {
                   std::string function,
                   uint32_t line);
 
+    /**
+     * @brief Dispatches a log message to all registered log_sinks.
+     *
+     * @param log_sinks The collection of log sinks to which the message should be dispatched.
+     *                  It must outlive the processing of the message.
+     * @param record The message; its fields are copied before this call returns.
+     * @param priority True to queue the message on the priority lane, ahead of the normal backlog.
+     * @return False if the message was discarded because the process is crashing.
+     */
+    bool dispatch(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                  const LogRecord& record,
+                  bool priority = false);
+
+    /**
+     * @brief Queues a log message behind the ones already queued and waits until it is written and flushed.
+     *
+     * The worker writes the message in queue order and then flushes every
+     * sink, so when this returns the message and everything queued before it
+     * on the same lane have reached the sinks. Called from the worker thread
+     * itself, the message is only queued.
+     *
+     * @param log_sinks The collection of log sinks to which the message should be dispatched.
+     * @param record The message; its fields are copied before this call returns.
+     * @param priority True to queue the message on the priority lane, ahead of the normal backlog.
+     * @return False if the message was discarded because the process is crashing.
+     */
+    bool dispatchAndWait(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                         const LogRecord& record,
+                         bool priority = false);
+
+    /**
+     * @brief Dispatches a trace span event to all registered log_sinks.
+     *
+     * @param log_sinks The collection of log sinks to which the event should be dispatched.
+     *                  It must outlive the processing of the event.
+     * @param event The span event; it is copied into a pooled record before this call returns.
+     */
+    void dispatch(const std::vector<std::unique_ptr<ILogSink>>& log_sinks, const TraceEvent& event);
+
     /**
      * @brief Flushes all pending log messages in the log_sinks.
      *
      * @param log_sinks The collection of log sinks to flush.
      *
      * This method ensures that all log messages currently in the queue are
-     * processed and written out by the log sinks.
+     * processed and written out by the log sinks. The flush is queued behind
+     * them and runs on the worker thread, which is the only thread that calls
+     * the sinks; this returns once it has run.
      */
     void flush(const std::vector<std::unique_ptr<ILogSink>>& log_sinks);
 
+    /**
+     * @brief Flushes the sinks once the priority lane has been written, without waiting for the normal lane.
+     *
+     * The flush runs on the worker thread after the batch it is working on, so
+     * a caller that logged a priority message waits for at most one batch, not
+     * for the whole backlog of normal messages.
+     *
+     * @param log_sinks The collection of log sinks to flush.
+     */
+    void flushPriority(const std::vector<std::unique_ptr<ILogSink>>& log_sinks);
+
+    /**
+     * @brief Sets how the worker orders priority and normal messages within a batch.
+     *
+     * @param order The lane order.
+     */
+    void setLaneOrder(LaneOrder order) { log_queue_.setLaneOrder(order); }
+
+    /**
+     * @brief Returns how the worker orders priority and normal messages within a batch.
+     */
+    [[nodiscard]] LaneOrder getLaneOrder() const { return log_queue_.getLaneOrder(); }
+
+    /**
+     * @brief Switches the pipelined backend on or off.
+     *
+     * The switch happens on the worker thread, after the messages queued
+     * before it; when switching off, the buffers still held by the pipeline are
+     * written before this returns. The pipeline's I/O thread is started the
+     * first time the backend is switched on and kept until destruction, or
+     * until it is switched on with a different number of formatter threads.
+     *
+     * @param enabled True to format on the worker and write on the pipeline's I/O thread.
+     * @param formatter_threads Threads formatting in parallel instead of the worker; 0 for none.
+     */
+    void setPipelined(bool enabled, size_t formatter_threads = 0);
+
+    /**
+     * @brief Returns whether the pipelined backend is on.
+     */
+    [[nodiscard]] bool isPipelined() const { return pipelined_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Returns the number of formatter threads of the pipelined backend; 0 if the worker formats.
+     */
+    [[nodiscard]] size_t getFormatterThreads() const;
+
+    /**
+     * @brief Reopens every sink on the worker thread, after the messages queued before it.
+     *
+     * Returns once the sinks have been reopened. Called from the worker thread itself, the sinks
+     * are reopened at once; while a crash is handled, nothing is done.
+     *
+     * @param log_sinks The sinks to reopen.
+     */
+    void reopen(const std::vector<std::unique_ptr<ILogSink>>& log_sinks);
+
+    /**
+     * @brief Lets the worker finish the queue and flushes the sinks; see ILogger::drainOnCrash.
+     *
+     * If the worker itself crashed, what is left in the queue is written on the calling thread.
+     * The deadline is checked between tasks and sink calls; one that blocks is not interrupted.
+     *
+     * @param log_sinks The sinks to flush.
+     * @param deadline When to give up.
+     * @return True if the queue was written and the sinks flushed before the deadline.
+     */
+    bool drainOnCrash(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                      std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief Returns a snapshot of the queue and worker counters.
+     *
+     * @return The queue statistics.
+     */
+    [[nodiscard]] QueueStats getStats() const;
+
+    /**
+     * @brief Resets the queue and worker counters.
+     */
+    void resetStats();
+
    private:
+    /**
+     * @brief A queued message or trace event together with the sinks it is destined for.
+     */
+    struct PendingRecord {
+        LogRecordBuffer record;                                         //!< Owned copy of the message.
+        TraceEvent trace_event;                                         //!< Copy of the trace event.
+        const std::vector<std::unique_ptr<ILogSink>>* sinks = nullptr;  //!< Destination sinks.
+        std::promise<void>* written = nullptr;                          //!< Set once written and flushed, if awaited.
+    };
+
+    /**
+     * @brief Copies a message into a pooled record and queues the task that writes it.
+     */
+    void enqueueRecord(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                       const LogRecord& record,
+                       bool priority,
+                       std::promise<void>* written);
+
+    /**
+     * @brief Passes a message to the sinks, or to the pipeline when it is on; called on the worker.
+     */
+    void writeRecord(const std::vector<std::unique_ptr<ILogSink>>& log_sinks, const LogRecordBuffer& record);
+
+    /**
+     * @brief Waits until the pipeline has written everything formatted so far, if it is on.
+     *
+     * Called on the worker before the sinks are flushed or reopened.
+     */
+    void drainPipeline();
+
+    /**
+     * @brief Called by the worker after each batch: once the queue runs dry, hands the pipeline's buffer
+     *        over and calls ILogSink::onIdle() on the sinks written to since the last time.
+     */
+    void onBatchEnd();
+
     // Deleted copy constructor and assignment operator
     LogDispatcher(const LogDispatcher&) = delete;
     LogDispatcher& operator=(const LogDispatcher&) = delete;
 
    private:
-    LogQueue log_queue_;               //!< Queue for storing log tasks.
-    LogQueueWorker log_queue_worker_;  //!< Worker for processing log tasks.
+    RecordPool<PendingRecord> records_;      //!< Queue entries, reused.
+    LogQueue log_queue_;                     //!< Queue for storing log tasks.
+    LogQueueWorker log_queue_worker_;        //!< Worker for processing log tasks.
+    std::atomic<bool> pipelined_{false};     //!< Whether the worker formats into pipeline_.
+    mutable std::mutex pipeline_mutex_;      //!< Guards creating pipeline_ against getStats().
+    std::unique_ptr<LogPipeline> pipeline_;  //!< Second backend stage, once switched on.
+
+    const std::vector<std::unique_ptr<ILogSink>>* idle_sinks_ = nullptr;  //!< Written to since the queue last ran dry.
 };
 
 }  // namespace vne::log
@@ -48,8 +48,9 @@ std::string LogFormatter::format(const std::string& name,
         if (format[i] == '%' && i + 1 < format.length()) {
             switch (format[i + 1]) {
                 case 'x': {  // Timestamp
-                    TimeStamp time_stamp(time_stamp_type);
-                    message_stream << time_stamp.getTimeStamp();
+                    char time_buffer[TimeStamp::kBufferSize];
+                    size_t time_length = TimeStamp(time_stamp_type).formatTo(time_buffer, sizeof(time_buffer));
+                    message_stream.write(time_buffer, static_cast<std::streamsize>(time_length));
                     i++;  // Skip next character
                 } break;
                 case 'n':  // Log category
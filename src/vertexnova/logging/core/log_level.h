@@ -10,7 +10,9 @@
  * ----------------------------------------------------------------------
  */
 
+#include <cctype>
 #include <iostream>
+#include <string_view>
 
 namespace vne::log {
 
@@ -62,4 +64,39 @@ inline std::ostream& operator<<(std::ostream& stream, const LogLevel& level) {
     return stream;
 }
 
+/**
+ * @brief Parses a level name as printed by operator<< (case-insensitive; "warning" is accepted too).
+ *
+ * @param text The level name.
+ * @param level Receives the level on success.
+ * @return True if the name was recognized.
+ */
+inline bool parseLogLevel(std::string_view text, LogLevel& level) {
+    struct Name {
+        std::string_view name;
+        LogLevel level;
+    };
+    static constexpr Name kNames[] = {{"trace", LogLevel::eTrace},
+                                      {"debug", LogLevel::eDebug},
+                                      {"info", LogLevel::eInfo},
+                                      {"warn", LogLevel::eWarn},
+                                      {"warning", LogLevel::eWarn},
+                                      {"error", LogLevel::eError},
+                                      {"fatal", LogLevel::eFatal}};
+    for (const Name& entry : kNames) {
+        if (entry.name.size() != text.size()) {
+            continue;
+        }
+        bool equal = true;
+        for (size_t i = 0; i < text.size() && equal; ++i) {
+            equal = std::tolower(static_cast<unsigned char>(text[i])) == entry.name[i];
+        }
+        if (equal) {
+            level = entry.level;
+            return true;
+        }
+    }
+    return false;
+}
+
 }  // namespace vne::log
@@ -0,0 +1,334 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_pipeline.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr size_t kChunkCapacity = 2 * vne::log::kPipelineSubmitBytes;  //!< Text reserved per sink and buffer.
+constexpr size_t kRecordMessageCapacity = 256;                          //!< Message bytes reserved per copied record.
+constexpr size_t kRecordFieldCapacity = 128;                            //!< Category, file and function bytes reserved.
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+LogPipeline::LogPipeline(size_t buffer_count, size_t formatter_threads) {
+    // Every formatter needs a buffer of its own, besides the one being filled and the one being written
+    buffer_count = std::max<size_t>({buffer_count, 2, formatter_threads + 2});
+    buffers_.reserve(buffer_count);
+    free_.reserve(buffer_count);
+    ready_.reserve(buffer_count);
+    unformatted_.reserve(buffer_count);
+    for (size_t i = 0; i < buffer_count; ++i) {
+        buffers_.push_back(std::make_unique<Buffer>());
+        if (formatter_threads > 0) {
+            buffers_.back()->records.resize(kPipelineSubmitRecords);
+            for (LogRecordBuffer& record : buffers_.back()->records) {
+                record.reserve(kRecordMessageCapacity, kRecordFieldCapacity);
+            }
+        }
+        free_.push_back(buffers_.back().get());
+    }
+    current_ = free_.back();
+    free_.pop_back();
+    io_thread_ = std::thread(&LogPipeline::run, this);
+    formatter_threads_.reserve(formatter_threads);
+    for (size_t i = 0; i < formatter_threads; ++i) {
+        formatter_threads_.emplace_back(&LogPipeline::runFormatter, this);
+    }
+}
+
+LogPipeline::~LogPipeline() {
+    submit();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    format_condition_.notify_all();
+    ready_condition_.notify_one();
+    for (std::thread& formatter : formatter_threads_) {
+        formatter.join();
+    }
+    if (io_thread_.joinable()) {
+        io_thread_.join();
+    }
+}
+
+void LogPipeline::append(const std::vector<std::unique_ptr<ILogSink>>& log_sinks, const LogRecordBuffer& record) {
+    if (!formatter_threads_.empty()) {
+        appendRecord(log_sinks, record);
+        return;
+    }
+    std::vector<Chunk>& chunks = current_->chunks;
+    if (chunks.size() < log_sinks.size()) {
+        chunks.resize(log_sinks.size());
+    }
+    for (size_t i = 0; i < log_sinks.size(); ++i) {
+        ILogSink* sink = log_sinks[i].get();
+        Chunk& chunk = chunks[i];
+        if (chunk.sink != sink) {
+            chunk.sink = sink;
+            chunk.text.reserve(kChunkCapacity);
+        }
+        size_t before = chunk.text.size();
+        if (sink->formatTo(chunk.text,
+                           record.category,
+                           record.level,
+                           record.time_stamp_type,
+                           record.message,
+                           record.file,
+                           record.function,
+                           record.line)) {
+            ++chunk.messages;
+            current_->bytes += chunk.text.size() - before;
+        } else {
+            sink->log(record.category,
+                      record.level,
+                      record.time_stamp_type,
+                      record.message,
+                      record.file,
+                      record.function,
+                      record.line);
+        }
+    }
+    if (current_->bytes >= kPipelineSubmitBytes) {
+        submit(kPipelineSubmitBytes);
+    }
+}
+
+void LogPipeline::appendRecord(const std::vector<std::unique_ptr<ILogSink>>& log_sinks,
+                               const LogRecordBuffer& record) {
+    if (current_->record_count > 0 && current_->sinks != &log_sinks) {
+        submit();
+    }
+    bool formatted_later = false;
+    for (auto& sink : log_sinks) {
+        if (sink->canFormatTo()) {
+            formatted_later = true;
+        } else {
+            sink->log(record.category,
+                      record.level,
+                      record.time_stamp_type,
+                      record.message,
+                      record.file,
+                      record.function,
+                      record.line);
+        }
+    }
+    if (!formatted_later) {
+        return;
+    }
+    current_->sinks = &log_sinks;
+    if (current_->record_count == current_->records.size()) {
+        current_->records.emplace_back().reserve(kRecordMessageCapacity, kRecordFieldCapacity);
+    }
+    current_->records[current_->record_count++].assign(record.view());
+    current_->bytes += record.message.size();
+    if (current_->record_count >= kPipelineSubmitRecords || current_->bytes >= kPipelineSubmitBytes) {
+        submit();
+    }
+}
+
+void LogPipeline::submit(size_t min_bytes) {
+    bool empty = current_->bytes == 0 && current_->record_count == 0;
+    if (empty || current_->bytes < min_bytes) {
+        return;
+    }
+    bool needs_format = current_->record_count > 0;
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    if (!needs_format) {
+        bytes_submitted_.fetch_add(current_->bytes, std::memory_order_relaxed);
+    }
+    in_flight_.fetch_add(1, std::memory_order_release);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    // ready_ keeps the fill order; a formatted buffer is written only once those before it are
+    current_->formatted = !needs_format;
+    ready_.push_back(current_);
+    if (needs_format) {
+        unformatted_.push_back(current_);
+        format_condition_.notify_one();
+    } else {
+        ready_condition_.notify_one();
+    }
+    if (free_.empty()) {
+        stalls_.fetch_add(1, std::memory_order_relaxed);
+        free_condition_.wait(lock, [this] { return !free_.empty(); });
+    }
+    current_ = free_.back();
+    free_.pop_back();
+}
+
+void LogPipeline::drain() {
+    submit();
+    std::unique_lock<std::mutex> lock(mutex_);
+    free_condition_.wait(lock, [this] { return in_flight_.load(std::memory_order_acquire) == 0; });
+}
+
+bool LogPipeline::drainOnCrash(std::chrono::steady_clock::time_point deadline) {
+    if (isIoThread()) {
+        // The buffer being written when the crash hit is lost; write the ones behind it from here
+        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return false;
+        }
+        for (auto it = ready_.begin() + (ready_.empty() ? 0 : 1); it != ready_.end(); ++it) {
+            if (!(*it)->formatted) {
+                // Still with a formatter; writing what follows would break the order
+                return false;
+            }
+            writeBuffer(**it);
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (!isFormatterThread()) {
+        submit();
+    }
+    while (in_flight_.load(std::memory_order_acquire) != 0) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+bool LogPipeline::isFormatterThread() const {
+    std::thread::id self = std::this_thread::get_id();
+    return std::any_of(formatter_threads_.begin(), formatter_threads_.end(), [self](const std::thread& formatter) {
+        return formatter.get_id() == self;
+    });
+}
+
+void LogPipeline::snapshot(QueueStats& stats) const {
+    stats.pipeline_buffers = submitted_.load(std::memory_order_relaxed);
+    stats.pipeline_bytes = bytes_submitted_.load(std::memory_order_relaxed);
+    stats.pipeline_stalls = stalls_.load(std::memory_order_relaxed);
+    stats.pipeline_io_busy_ns = io_busy_ns_.load(std::memory_order_relaxed);
+    stats.pipeline_format_busy_ns = format_busy_ns_.load(std::memory_order_relaxed);
+}
+
+void LogPipeline::resetStats() {
+    submitted_.store(0, std::memory_order_relaxed);
+    bytes_submitted_.store(0, std::memory_order_relaxed);
+    stalls_.store(0, std::memory_order_relaxed);
+    io_busy_ns_.store(0, std::memory_order_relaxed);
+    format_busy_ns_.store(0, std::memory_order_relaxed);
+}
+
+void LogPipeline::writeBuffer(Buffer& buffer) {
+    for (Chunk& chunk : buffer.chunks) {
+        if (chunk.messages > 0) {
+            chunk.sink->writeFormatted(chunk.text, chunk.messages);
+        }
+        chunk.text.clear();
+        chunk.messages = 0;
+    }
+    buffer.bytes = 0;
+}
+
+void LogPipeline::formatBuffer(Buffer& buffer) {
+    const std::vector<std::unique_ptr<ILogSink>>& log_sinks = *buffer.sinks;
+    if (buffer.chunks.size() < log_sinks.size()) {
+        buffer.chunks.resize(log_sinks.size());
+    }
+    buffer.bytes = 0;
+    // One sink at a time, so that each sink's pattern and chunk stay in cache
+    for (size_t i = 0; i < log_sinks.size(); ++i) {
+        ILogSink* sink = log_sinks[i].get();
+        if (!sink->canFormatTo()) {
+            continue;
+        }
+        Chunk& chunk = buffer.chunks[i];
+        if (chunk.sink != sink) {
+            chunk.sink = sink;
+            chunk.text.reserve(kChunkCapacity);
+        }
+        size_t before = chunk.text.size();
+        for (size_t r = 0; r < buffer.record_count; ++r) {
+            const LogRecordBuffer& record = buffer.records[r];
+            if (sink->formatTo(chunk.text,
+                               record.category,
+                               record.level,
+                               record.time_stamp_type,
+                               record.message,
+                               record.file,
+                               record.function,
+                               record.line)) {
+                ++chunk.messages;
+            }
+        }
+        buffer.bytes += chunk.text.size() - before;
+    }
+    buffer.record_count = 0;
+}
+
+void LogPipeline::runFormatter() {
+    using Clock = std::chrono::steady_clock;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        format_condition_.wait(lock, [this] { return !unformatted_.empty() || !running_; });
+        if (unformatted_.empty()) {
+            break;
+        }
+        Buffer* buffer = unformatted_.front();
+        unformatted_.erase(unformatted_.begin());
+        lock.unlock();
+
+        auto busy_start = Clock::now();
+        formatBuffer(*buffer);
+        auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - busy_start);
+        format_busy_ns_.fetch_add(static_cast<uint64_t>(busy.count()), std::memory_order_relaxed);
+        bytes_submitted_.fetch_add(buffer->bytes, std::memory_order_relaxed);
+
+        lock.lock();
+        buffer->formatted = true;
+        ready_condition_.notify_one();
+    }
+}
+
+void LogPipeline::run() {
+    using Clock = std::chrono::steady_clock;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        // Only the oldest buffer may be written; one formatted ahead of it waits its turn
+        ready_condition_.wait(lock, [this] {
+            return (!ready_.empty() && ready_.front()->formatted) || (!running_ && ready_.empty());
+        });
+        if (ready_.empty()) {
+            break;
+        }
+        Buffer* buffer = ready_.front();
+        lock.unlock();
+
+        auto busy_start = Clock::now();
+        writeBuffer(*buffer);
+        auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - busy_start);
+        io_busy_ns_.fetch_add(static_cast<uint64_t>(busy.count()), std::memory_order_relaxed);
+
+        lock.lock();
+        // Removed only once written, so that a crash drain still finds a buffer that was being written
+        ready_.erase(ready_.begin());
+        free_.push_back(buffer);
+        in_flight_.fetch_sub(1, std::memory_order_release);
+        free_condition_.notify_all();
+    }
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,223 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_record.h"
+#include "log_sink.h"
+#include "log_stats.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @file log_pipeline.h
+ *
+ * @brief Second stage of the pipelined asynchronous backend: writes formatted buffers.
+ *
+ * Without a pipeline, the dispatcher's worker formats a message and writes it
+ * before taking the next one, so CPU (formatting) and I/O (write) never
+ * overlap. With a pipeline, the worker (stage 1) only formats: it appends each
+ * message to a per-sink text chunk of the current buffer. Full buffers, and the
+ * last one once the queue runs dry, are handed to the pipeline's I/O thread
+ * (stage 2), which passes each chunk to its sink in one write while stage 1
+ * formats into the next buffer.
+ *
+ * The buffers are allocated up front and reused; with two of them stage 1
+ * fills one while the other is written, a third lets stage 1 keep formatting
+ * through a slow write. When every buffer is waiting to be written, stage 1
+ * waits for one (counted in QueueStats::pipeline_stalls).
+ *
+ * When one core cannot format fast enough, formatter threads take formatting
+ * off stage 1: it then only copies each message into the current buffer and
+ * hands full buffers to the formatter threads, which format different buffers
+ * in parallel. Buffers are queued for the I/O thread in the order stage 1
+ * filled them, and it writes the oldest one as soon as it is formatted, so
+ * the output keeps the order of the queue however the formatters finish.
+ * Time stamps are still taken when a message is formatted.
+ */
+
+namespace vne::log {
+
+/// Default number of buffers cycled between the formatting and the I/O stage.
+constexpr size_t kDefaultPipelineBuffers = 3;
+
+/// Formatted bytes after which stage 1 hands a buffer over without waiting for the batch to end.
+constexpr size_t kPipelineSubmitBytes = 64 * 1024;
+
+/// Messages after which stage 1 hands a buffer to the formatter threads.
+constexpr size_t kPipelineSubmitRecords = 512;
+
+class LogPipeline {
+   public:
+    /**
+     * @brief Allocates the buffers and starts the I/O thread and the formatter threads.
+     *
+     * @param buffer_count Number of buffers; at least 2, and at least formatter_threads + 2.
+     * @param formatter_threads Threads formatting buffers in parallel; 0 formats on stage 1.
+     */
+    explicit LogPipeline(size_t buffer_count = kDefaultPipelineBuffers, size_t formatter_threads = 0);
+
+    /**
+     * @brief Writes the buffers already handed over and stops the I/O thread.
+     *
+     * Text still in the current buffer is written too.
+     */
+    ~LogPipeline();
+
+    /**
+     * @brief Formats a message into the current buffer for every sink that supports it.
+     *
+     * Sinks whose ILogSink::formatTo() returns false receive the message
+     * through ILogSink::log() immediately. With formatter threads, the message
+     * is copied into the buffer instead and formatted later for every sink
+     * whose ILogSink::canFormatTo() is true; the other sinks receive it through
+     * ILogSink::log() immediately. Called by stage 1 only.
+     *
+     * @param log_sinks The sinks the message is destined for.
+     * @param record The message.
+     */
+    void append(const std::vector<std::unique_ptr<ILogSink>>& log_sinks, const LogRecordBuffer& record);
+
+    /**
+     * @brief Hands the current buffer over if it holds at least min_bytes.
+     *
+     * The buffer goes to the I/O thread, or first to a formatter thread if
+     * there are any. Waits for a free buffer to continue with if every buffer
+     * is in use. Called by stage 1 only.
+     *
+     * @param min_bytes The smallest amount of text (of message text, with formatter threads) worth a write.
+     */
+    void submit(size_t min_bytes = 0);
+
+    /**
+     * @brief Hands over the current buffer and waits until the I/O thread has written everything.
+     *
+     * Afterwards no sink is being written to, so sinks can be flushed or
+     * reopened. Called by stage 1 only.
+     */
+    void drain();
+
+    /**
+     * @brief Like drain(), but gives up at the deadline; for the crash handler.
+     *
+     * If the I/O thread itself crashed, the buffers not yet written are written on the calling thread.
+     *
+     * @param deadline When to give up.
+     * @return True if everything was written before the deadline.
+     */
+    bool drainOnCrash(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief Returns whether the calling thread is the I/O thread.
+     */
+    [[nodiscard]] bool isIoThread() const { return io_thread_.get_id() == std::this_thread::get_id(); }
+
+    /**
+     * @brief Returns whether the calling thread is one of the formatter threads.
+     */
+    [[nodiscard]] bool isFormatterThread() const;
+
+    /**
+     * @brief Returns the number of formatter threads; 0 if stage 1 formats.
+     */
+    [[nodiscard]] size_t getFormatterThreads() const { return formatter_threads_.size(); }
+
+    /**
+     * @brief Copies the pipeline counters into a snapshot.
+     *
+     * @param stats The snapshot whose pipeline_* fields are filled.
+     */
+    void snapshot(QueueStats& stats) const;
+
+    /**
+     * @brief Resets the pipeline counters to zero.
+     */
+    void resetStats();
+
+   private:
+    /**
+     * @brief Text formatted for one sink.
+     */
+    struct Chunk {
+        ILogSink* sink = nullptr;  //!< The sink the text is for.
+        std::string text;          //!< Formatted messages.
+        size_t messages = 0;       //!< Number of messages in text.
+    };
+
+    /**
+     * @brief One buffer: a chunk per sink, and with formatter threads the messages still to be formatted.
+     */
+    struct Buffer {
+        std::vector<Chunk> chunks;                                      //!< Indexed like the logger's sinks.
+        size_t bytes = 0;                                               //!< Text in all chunks (or in records).
+        std::vector<LogRecordBuffer> records;                           //!< Copied messages (formatter threads only).
+        size_t record_count = 0;                                        //!< Messages in records.
+        const std::vector<std::unique_ptr<ILogSink>>* sinks = nullptr;  //!< Sinks the records are for.
+        bool formatted = true;                                          //!< Whether chunks are complete (mutex_).
+    };
+
+    /**
+     * @brief Passes every chunk of a buffer to its sink and empties it.
+     */
+    static void writeBuffer(Buffer& buffer);
+
+    /**
+     * @brief Formats a buffer's records into its chunks; called by a formatter thread.
+     */
+    static void formatBuffer(Buffer& buffer);
+
+    /**
+     * @brief Copies a message into the current buffer for the formatter threads.
+     */
+    void appendRecord(const std::vector<std::unique_ptr<ILogSink>>& log_sinks, const LogRecordBuffer& record);
+
+    /**
+     * @brief I/O thread function.
+     */
+    void run();
+
+    /**
+     * @brief Formatter thread function.
+     */
+    void runFormatter();
+
+    // Deleted copy constructor and assignment operator
+    LogPipeline(const LogPipeline&) = delete;
+    LogPipeline& operator=(const LogPipeline&) = delete;
+
+   private:
+    std::vector<std::unique_ptr<Buffer>> buffers_;  //!< Every buffer (owning).
+    Buffer* current_ = nullptr;                     //!< Buffer stage 1 formats into.
+    std::vector<Buffer*> free_;                     //!< Buffers ready to be filled (guarded by mutex_).
+    std::vector<Buffer*> ready_;                    //!< Buffers to be written, in fill order (guarded by mutex_).
+    std::vector<Buffer*> unformatted_;              //!< Buffers waiting for a formatter (guarded by mutex_).
+    std::atomic<size_t> in_flight_{0};              //!< Buffers handed over and not yet written.
+    bool running_ = true;                           //!< False once the I/O thread is to stop (guarded by mutex_).
+    mutable std::mutex mutex_;                      //!< Guards the buffer lists.
+    std::condition_variable ready_condition_;       //!< Wakes the I/O thread.
+    std::condition_variable free_condition_;        //!< Wakes stage 1 waiting for a buffer or for drain().
+    std::condition_variable format_condition_;      //!< Wakes the formatter threads.
+    std::atomic<uint64_t> submitted_{0};            //!< Buffers handed to the I/O thread.
+    std::atomic<uint64_t> bytes_submitted_{0};      //!< Text in those buffers.
+    std::atomic<uint64_t> stalls_{0};               //!< Times stage 1 waited for a free buffer.
+    std::atomic<uint64_t> io_busy_ns_{0};           //!< Time the I/O thread spent writing.
+    std::atomic<uint64_t> format_busy_ns_{0};       //!< Time the formatter threads spent formatting.
+    std::thread io_thread_;                         //!< Stage 2.
+    std::vector<std::thread> formatter_threads_;    //!< Parallel formatting, if any.
+};
+
+}  // namespace vne::log
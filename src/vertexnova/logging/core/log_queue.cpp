@@ -11,48 +11,158 @@
 
 #include "log_queue.h"
 
+#include <algorithm>
+
 namespace vne {  // Outer namespace
 namespace log {  // Inner namespace
 void LogQueue::push(std::function<void()> log_task) {
     std::lock_guard<std::mutex> lock(mutex_);
-    queue_.push(std::move(log_task));
-    condition_.notify_one();
+    pushLane(normal_, std::move(log_task));
+}
+
+void LogQueue::pushPriority(std::function<void()> log_task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pushLane(priority_, std::move(log_task));
+    ++priority_enqueued_;
+}
+
+void LogQueue::pushControl(std::function<void()> task, bool priority) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pushLane(priority ? priority_ : normal_, std::move(task), false);
 }
 
 std::function<void()> LogQueue::pop() {
     std::unique_lock<std::mutex> lock(mutex_);
-    while (queue_.empty()) {
+    while (size() == 0) {
         condition_.wait(lock);
     }
 
-    auto log_task = queue_.front();
-    queue_.pop();
-    return log_task;
+    return takeNext();
+}
+
+bool LogQueue::tryPop(std::function<void()>& log_task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size() == 0) {
+        return false;
+    }
+    log_task = takeNext();
+    return true;
+}
+
+bool LogQueue::tryPopIfUnlocked(std::function<void()>& log_task) {
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock() || size() == 0) {
+        return false;
+    }
+    log_task = takeNext();
+    return true;
 }
 
 bool LogQueue::empty() const {
     std::lock_guard<std::mutex> lock(mutex_);
-    return queue_.empty();
+    return size() == 0;
 }
 
 std::vector<std::function<void()>> LogQueue::drain(size_t max_items) {
+    std::vector<std::function<void()>> batch;
+    drain(batch, max_items);
+    return batch;
+}
+
+void LogQueue::drain(std::vector<std::function<void()>>& batch, size_t max_items) {
+    batch.clear();
     std::unique_lock<std::mutex> lock(mutex_);
 
     // Wait for at least one item
-    while (queue_.empty()) {
+    while (size() == 0) {
         condition_.wait(lock);
     }
 
-    // Drain up to max_items
-    std::vector<std::function<void()>> batch;
-    batch.reserve(std::min(max_items, queue_.size()));
+    // Every waiting priority task first, then fill up to max_items from the normal lane
+    size_t from_priority = std::min(max_items, priority_.size);
+    size_t from_normal = std::min(max_items - from_priority, normal_.size);
+    batch.reserve(from_priority + from_normal);
+    if (lane_order_.load(std::memory_order_relaxed) == LaneOrder::eTimestamp) {
+        // Merge the two lanes' fronts by push order
+        while (from_priority > 0 && from_normal > 0) {
+            bool priority_older = priority_.ring[priority_.head].sequence < normal_.ring[normal_.head].sequence;
+            Lane& lane = priority_older ? priority_ : normal_;
+            --(priority_older ? from_priority : from_normal);
+            batch.push_back(takeFront(lane));
+        }
+    }
+    for (; from_priority > 0; --from_priority) {
+        batch.push_back(takeFront(priority_));
+    }
+    for (; from_normal > 0; --from_normal) {
+        batch.push_back(takeFront(normal_));
+    }
+}
+
+size_t LogQueue::capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return normal_.ring.size() + priority_.ring.size();
+}
+
+void LogQueue::snapshot(QueueStats& stats) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.enqueued = enqueued_;
+    stats.priority_enqueued = priority_enqueued_;
+    stats.dequeued = dequeued_;
+    stats.current_depth = record_depth_;
+    stats.high_water_depth = high_water_depth_;
+}
+
+void LogQueue::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enqueued_ = 0;
+    priority_enqueued_ = 0;
+    dequeued_ = 0;
+    high_water_depth_ = record_depth_;
+}
 
-    while (!queue_.empty() && batch.size() < max_items) {
-        batch.push_back(std::move(queue_.front()));
-        queue_.pop();
+void LogQueue::pushLane(Lane& lane, std::function<void()> log_task, bool is_record) {
+    if (lane.size == lane.ring.size()) {
+        grow(lane);
     }
+    Slot& slot = lane.ring[(lane.head + lane.size) % lane.ring.size()];
+    slot.task = std::move(log_task);
+    slot.sequence = next_sequence_++;
+    slot.is_record = is_record;
+    ++lane.size;
+    unfinished_.fetch_add(1, std::memory_order_relaxed);
+    if (is_record) {
+        ++enqueued_;
+        ++record_depth_;
+        high_water_depth_ = std::max(high_water_depth_, record_depth_);
+    }
+    condition_.notify_one();
+}
 
-    return batch;
+void LogQueue::grow(Lane& lane) {
+    std::vector<Slot> grown(std::max(kInitialQueueCapacity, lane.ring.size() * 2));
+    for (size_t i = 0; i < lane.size; ++i) {
+        grown[i] = std::move(lane.ring[(lane.head + i) % lane.ring.size()]);
+    }
+    lane.ring.swap(grown);
+    lane.head = 0;
+}
+
+std::function<void()> LogQueue::takeFront(Lane& lane) {
+    Slot& slot = lane.ring[lane.head];
+    if (slot.is_record) {
+        ++dequeued_;
+        --record_depth_;
+    }
+    std::function<void()> log_task = std::move(slot.task);
+    slot.task = nullptr;
+    lane.head = (lane.head + 1) % lane.ring.size();
+    --lane.size;
+    return log_task;
+}
+
+std::function<void()> LogQueue::takeNext() {
+    return takeFront(priority_.size > 0 ? priority_ : normal_);
 }
 }  // namespace log
 }  // namespace vne
@@ -10,7 +10,9 @@
  * ----------------------------------------------------------------------
  */
 
-#include <queue>
+#include "log_stats.h"
+
+#include <atomic>
 #include <mutex>
 #include <functional>
 #include <condition_variable>
@@ -20,6 +22,17 @@
  * @file log_queue.h
  *
  * @brief Thread-safe queue for storing log tasks.
+ *
+ * Tasks are kept in a ring buffer that only grows (doubling) when it is full
+ * and never shrinks, so once it has reached the peak backlog, pushing and
+ * draining do not allocate. Tasks whose captures fit std::function's inline
+ * storage (such as the dispatcher's two-pointer lambda) are allocation-free
+ * end to end.
+ *
+ * Tasks are pushed onto one of two lanes, each its own ring buffer. The
+ * priority lane is always taken first, so a record pushed with pushPriority()
+ * is written after at most the batch the worker is running, however long the
+ * normal lane's backlog is.
  */
 
 namespace vne::log {
@@ -27,20 +40,78 @@ namespace vne::log {
 /// Default maximum number of items to drain from the queue in a single operation.
 constexpr size_t kDefaultDrainBatchSize = 32;
 
+/// Number of task slots allocated by the first push onto a lane.
+constexpr size_t kInitialQueueCapacity = 1024;
+
+/**
+ * @enum LaneOrder
+ * @brief How a drained batch orders the tasks taken from the two lanes.
+ */
+enum class LaneOrder : uint8_t {
+    ePriorityFirst = 0,  //!< Priority tasks, then normal ones; priority records may overtake older output.
+    eTimestamp = 1       //!< Tasks of a batch in the order they were pushed, so the output stays chronological.
+};
+
 class LogQueue {
    public:
     /**
-     * @brief Pushes a new log task onto the queue.
+     * @brief Pushes a new log task onto the normal lane.
      * @param log_task The log task to push (moved for efficiency).
      */
     void push(std::function<void()> log_task);
 
     /**
-     * @brief Pops a log task from the queue.
+     * @brief Pushes a log task onto the priority lane, which is taken before the normal lane.
+     * @param log_task The log task to push.
+     */
+    void pushPriority(std::function<void()> log_task);
+
+    /**
+     * @brief Pushes a task that carries no log record, such as a flush or a reopen.
+     *
+     * It runs in order with the records like any other task, but is left out of the statistics, which
+     * count log records only.
+     *
+     * @param task The task to push.
+     * @param priority Whether to push onto the priority lane.
+     */
+    void pushControl(std::function<void()> task, bool priority = false);
+
+    /**
+     * @brief Pops a log task from the queue, priority lane first.
      * @return The next log task.
      */
     std::function<void()> pop();
 
+    /**
+     * @brief Pops a log task if one is available, without blocking.
+     * @param log_task Receives the task.
+     * @return True if a task was popped, false if the queue was empty.
+     */
+    bool tryPop(std::function<void()>& log_task);
+
+    /**
+     * @brief Like tryPop(), but also returns false instead of waiting if another thread holds the lock.
+     *
+     * For the crash handler, which must not block on a lock the crashed thread may hold.
+     *
+     * @param log_task Receives the task.
+     * @return True if a task was popped.
+     */
+    bool tryPopIfUnlocked(std::function<void()>& log_task);
+
+    /**
+     * @brief Records that tasks taken from the queue have finished running.
+     *
+     * @param count The number of finished tasks.
+     */
+    void markDone(size_t count) { unfinished_.fetch_sub(count, std::memory_order_release); }
+
+    /**
+     * @brief Returns whether every pushed task has been taken and reported through markDone().
+     */
+    [[nodiscard]] bool isIdle() const { return unfinished_.load(std::memory_order_acquire) == 0; }
+
     /**
      * @brief Checks if the queue is empty.
      * @return True if the queue is empty, false otherwise.
@@ -56,10 +127,105 @@ class LogQueue {
      */
     std::vector<std::function<void()>> drain(size_t max_items = kDefaultDrainBatchSize);
 
+    /**
+     * @brief Drains up to max_items tasks from the queue into a caller-owned vector.
+     * @param batch Receives the tasks; it is cleared first and its capacity is reused.
+     * @param max_items Maximum number of items to drain (default: 32).
+     *
+     * Blocks until at least one task is available. Every waiting priority task (up to
+     * max_items) is taken, and the rest of the batch is filled from the normal lane;
+     * see LaneOrder for how the two are ordered. Unlike the returning overload this
+     * does not allocate once batch has reserved max_items elements.
+     */
+    void drain(std::vector<std::function<void()>>& batch, size_t max_items = kDefaultDrainBatchSize);
+
+    /**
+     * @brief Sets how drained batches order priority and normal tasks.
+     * @param order The lane order (default: LaneOrder::ePriorityFirst).
+     */
+    void setLaneOrder(LaneOrder order) { lane_order_.store(order, std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns how drained batches order priority and normal tasks.
+     */
+    [[nodiscard]] LaneOrder getLaneOrder() const { return lane_order_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the number of task slots currently allocated.
+     * @return The capacity of both lanes' ring buffers.
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Copies the queue counters into a snapshot.
+     * @param stats The snapshot whose enqueued, priority_enqueued, dequeued, current_depth and
+     *              high_water_depth fields are filled.
+     */
+    void snapshot(QueueStats& stats) const;
+
+    /**
+     * @brief Resets the queue counters; the high-water mark restarts from the current depth.
+     */
+    void resetStats();
+
+   private:
+    /**
+     * @brief A queued task and its position in the order of all pushes.
+     */
+    struct Slot {
+        std::function<void()> task;  //!< The log task.
+        uint64_t sequence = 0;       //!< Number of pushes onto either lane before this one.
+        bool is_record = true;       //!< False for a control task, which the statistics leave out.
+    };
+
+    /**
+     * @brief One FIFO lane of the queue.
+     */
+    struct Lane {
+        std::vector<Slot> ring;  //!< Ring buffer of queued tasks.
+        size_t head = 0;         //!< Index of the oldest task in ring.
+        size_t size = 0;         //!< Number of tasks in ring.
+    };
+
+    /**
+     * @brief Appends a task to a lane and wakes a waiting consumer. Must be called with mutex_ held.
+     */
+    void pushLane(Lane& lane, std::function<void()> log_task, bool is_record = true);
+
+    /**
+     * @brief Doubles a lane's ring buffer, keeping tasks in FIFO order. Must be called with mutex_ held.
+     */
+    static void grow(Lane& lane);
+
+    /**
+     * @brief Removes and returns a lane's oldest task. Must be called with mutex_ held and the lane non-empty.
+     */
+    std::function<void()> takeFront(Lane& lane);
+
+    /**
+     * @brief Removes and returns the next task, priority lane first. Must be called with mutex_ held and
+     *        the queue non-empty.
+     */
+    std::function<void()> takeNext();
+
+    /**
+     * @brief Returns the number of tasks in both lanes. Must be called with mutex_ held.
+     */
+    [[nodiscard]] size_t size() const { return normal_.size + priority_.size; }
+
    private:
-    std::queue<std::function<void()>> queue_;  //!< The queue of log tasks.
-    mutable std::mutex mutex_;                 //!< Mutex for synchronizing access to the queue.
-    std::condition_variable condition_;        //!< Condition variable for managing thread waiting.
+    Lane normal_;                                                   //!< Lane for push().
+    Lane priority_;                                                 //!< Lane for pushPriority().
+    mutable std::mutex mutex_;                                      //!< Mutex for synchronizing access to the queue.
+    std::condition_variable condition_;                             //!< Wakes consumers waiting for a task.
+    uint64_t next_sequence_ = 0;                                    //!< Sequence of the next push (guarded by mutex_).
+    uint64_t enqueued_ = 0;                                         //!< Records pushed so far (guarded by mutex_).
+    uint64_t priority_enqueued_ = 0;                                //!< Priority records pushed (guarded by mutex_).
+    uint64_t dequeued_ = 0;                                         //!< Records popped so far (guarded by mutex_).
+    uint64_t record_depth_ = 0;                                     //!< Records in the queue (guarded by mutex_).
+    uint64_t high_water_depth_ = 0;                                 //!< Largest record_depth_ seen (guarded by mutex_).
+    std::atomic<size_t> unfinished_{0};                             //!< Pushed tasks not yet reported by markDone().
+    std::atomic<LaneOrder> lane_order_{LaneOrder::ePriorityFirst};  //!< Order of drained batches.
 };
 
 }  // namespace vne::log
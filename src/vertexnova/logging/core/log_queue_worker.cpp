@@ -11,6 +11,8 @@
 
 #include "log_queue_worker.h"
 
+#include <chrono>
+
 namespace {
 
 constexpr size_t kBatchSize = 32;  //!< Number of messages to process per batch
@@ -35,23 +37,50 @@ void LogQueueWorker::start() {
 
 void LogQueueWorker::stop() {
     running_ = false;
-    queue_.push([]() {});  // Push a dummy task to wake up the worker thread
+    queue_.pushControl([]() {});  // Push a dummy task to wake up the worker thread
     if (worker_thread_.joinable()) {
         worker_thread_.join();
     }
 }
 
 void LogQueueWorker::flush() {
-    while (!queue_.empty()) {
-        auto log_task = queue_.pop();
-        log_task();
+    // tryPop() rather than empty() + pop(): the worker may take the last task in between
+    std::function<void()> log_task;
+    while (queue_.tryPop(log_task)) {
+        if (log_task) {
+            log_task();
+        }
+        queue_.markDone(1);
     }
 }
 
+void LogQueueWorker::snapshot(QueueStats& stats) const {
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    stats.worker_busy_ns = busy_ns_.load(std::memory_order_relaxed);
+    stats.worker_idle_ns = idle_ns_.load(std::memory_order_relaxed);
+}
+
+void LogQueueWorker::resetStats() {
+    batches_.store(0, std::memory_order_relaxed);
+    busy_ns_.store(0, std::memory_order_relaxed);
+    idle_ns_.store(0, std::memory_order_relaxed);
+}
+
 void LogQueueWorker::run() {
+    using Clock = std::chrono::steady_clock;
+    auto toNs = [](Clock::duration duration) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+
+    // Reused across iterations so that draining does not allocate
+    std::vector<std::function<void()>> batch;
+    batch.reserve(kBatchSize);
+
     while (running_) {
         // Drain multiple tasks at once to reduce lock contention
-        auto batch = queue_.drain(kBatchSize);
+        auto wait_start = Clock::now();
+        queue_.drain(batch, kBatchSize);
+        auto busy_start = Clock::now();
 
         // Execute all tasks in the batch
         for (auto& log_task : batch) {
@@ -59,6 +88,18 @@ void LogQueueWorker::run() {
                 log_task();
             }
         }
+
+        if (batch_end_hook_) {
+            batch_end_hook_();
+        }
+
+        // Release the executed tasks before waiting for the next batch
+        queue_.markDone(batch.size());
+        batch.clear();
+
+        idle_ns_.fetch_add(toNs(busy_start - wait_start), std::memory_order_relaxed);
+        busy_ns_.fetch_add(toNs(Clock::now() - busy_start), std::memory_order_relaxed);
+        batches_.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
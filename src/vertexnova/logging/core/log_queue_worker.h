@@ -14,6 +14,7 @@
 
 #include <thread>
 #include <atomic>
+#include <functional>
 
 /**
  * @file log_queue_worker.h
@@ -47,6 +48,16 @@ class LogQueueWorker {
      */
     ~LogQueueWorker();
 
+    /**
+     * @brief Sets a function the worker thread calls after each batch of tasks.
+     *
+     * It runs before the batch is reported done, so once the queue is idle the
+     * hook has seen every task. Must be called before start().
+     *
+     * @param hook The function to call.
+     */
+    void setBatchEndHook(std::function<void()> hook) { batch_end_hook_ = std::move(hook); }
+
     /**
      * @brief Starts the log queue worker thread.
      *
@@ -72,6 +83,23 @@ class LogQueueWorker {
      */
     void flush();
 
+    /**
+     * @brief Returns whether the calling thread is the worker thread.
+     */
+    [[nodiscard]] bool isWorkerThread() const { return worker_thread_.get_id() == std::this_thread::get_id(); }
+
+    /**
+     * @brief Copies the worker counters into a snapshot.
+     *
+     * @param stats The snapshot whose batches, worker_busy_ns and worker_idle_ns fields are filled.
+     */
+    void snapshot(QueueStats& stats) const;
+
+    /**
+     * @brief Resets the worker counters to zero.
+     */
+    void resetStats();
+
    private:
     /**
      * @brief Worker thread function.
@@ -88,9 +116,13 @@ class LogQueueWorker {
     LogQueueWorker& operator=(const LogQueueWorker&) = delete;
 
    private:
-    LogQueue& queue_;            //!< Reference to the log queue.
-    std::atomic<bool> running_;  //!< Flag indicating whether the worker is running.
-    std::thread worker_thread_;  //!< Worker thread.
+    LogQueue& queue_;                   //!< Reference to the log queue.
+    std::atomic<bool> running_;         //!< Flag indicating whether the worker is running.
+    std::thread worker_thread_;         //!< Worker thread.
+    std::atomic<uint64_t> batches_{0};  //!< Batches processed by the worker thread.
+    std::atomic<uint64_t> busy_ns_{0};  //!< Time spent running tasks.
+    std::atomic<uint64_t> idle_ns_{0};  //!< Time spent waiting for tasks.
+    std::function<void()> batch_end_hook_;  //!< Called after each batch, if set.
 };
 
 }  // namespace vne::log
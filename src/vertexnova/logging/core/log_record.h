@@ -0,0 +1,100 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_level.h"
+#include "time_stamp.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @file log_record.h
+ *
+ * @brief Non-owning and owning representations of a single log message.
+ *
+ * LogRecord is what the front end hands to a logger: every text field is a
+ * view into storage owned by the caller, so building one never allocates.
+ * LogRecordBuffer is the owning counterpart used wherever a record must
+ * outlive the call (the async queue) or be passed to sinks as std::string;
+ * it is meant to be reused so its strings keep their capacity.
+ */
+
+namespace vne::log {
+
+/**
+ * @struct LogRecord
+ * @brief A log message whose text fields refer to caller-owned storage.
+ */
+struct LogRecord {
+    std::string_view category;                              //!< Category name of the message.
+    LogLevel level = LogLevel::eInfo;                       //!< Severity of the message.
+    TimeStampType time_stamp_type = TimeStampType::eLocal;  //!< Local time or UTC.
+    std::string_view message;                               //!< Message text.
+    std::string_view file;                                  //!< Source file that generated the message.
+    std::string_view function;                              //!< Function that generated the message.
+    uint32_t line = 0;                                      //!< Source line that generated the message.
+    bool force = false;                                     //!< Skip the logger's level filter (enabled call site).
+};
+
+/**
+ * @struct LogRecordBuffer
+ * @brief Owning copy of a LogRecord with reusable string storage.
+ */
+struct LogRecordBuffer {
+    std::string category;                                   //!< Category name of the message.
+    LogLevel level = LogLevel::eInfo;                       //!< Severity of the message.
+    TimeStampType time_stamp_type = TimeStampType::eLocal;  //!< Local time or UTC.
+    std::string message;                                    //!< Message text.
+    std::string file;                                       //!< Source file that generated the message.
+    std::string function;                                   //!< Function that generated the message.
+    uint32_t line = 0;                                      //!< Source line that generated the message.
+
+    /**
+     * @brief Copies a record into this buffer.
+     *
+     * Allocates only when a field is longer than any value previously stored in it.
+     *
+     * @param record The record to copy.
+     */
+    void assign(const LogRecord& record) {
+        category.assign(record.category);
+        level = record.level;
+        time_stamp_type = record.time_stamp_type;
+        message.assign(record.message);
+        file.assign(record.file);
+        function.assign(record.function);
+        line = record.line;
+    }
+
+    /**
+     * @brief Reserves storage so that later assign() calls up to these sizes do not allocate.
+     *
+     * @param message_capacity Capacity for the message text.
+     * @param field_capacity Capacity for each of category, file and function.
+     */
+    void reserve(size_t message_capacity, size_t field_capacity) {
+        message.reserve(message_capacity);
+        category.reserve(field_capacity);
+        file.reserve(field_capacity);
+        function.reserve(field_capacity);
+    }
+
+    /**
+     * @brief Returns a view of this buffer as a LogRecord.
+     *
+     * @return A record referring to this buffer's strings.
+     */
+    [[nodiscard]] LogRecord view() const { return {category, level, time_stamp_type, message, file, function, line}; }
+};
+
+}  // namespace vne::log
@@ -11,9 +11,13 @@
  */
 
 #include "log_level.h"
+#include "log_stats.h"
 #include "time_stamp.h"
+#include "trace_event.h"
 
+#include <chrono>
 #include <string>
+#include <string_view>
 #include <memory>
 
 namespace vne::log {
@@ -93,6 +97,113 @@ class ILogSink {
      */
     [[nodiscard]] virtual std::unique_ptr<ILogSink> clone() const = 0;
 
+    /**
+     * @brief Returns a snapshot of the sink's runtime counters.
+     *
+     * Sinks that do not keep statistics report all-zero counters.
+     *
+     * @return The sink statistics.
+     */
+    [[nodiscard]] virtual SinkStats getStats() const { return {}; }
+
+    /**
+     * @brief Writes a trace span event.
+     *
+     * Only sinks that render timelines (such as ChromeTraceSink) handle trace
+     * events; the default implementation ignores them.
+     *
+     * @param event The span event.
+     */
+    virtual void logTraceEvent([[maybe_unused]] const TraceEvent& event) {}
+
+    /**
+     * @brief Resets the sink's runtime counters to zero.
+     */
+    virtual void resetStats() {}
+
+    /**
+     * @brief Closes and reopens the sink's output, e.g. after a rotation tool renamed its file.
+     *
+     * Sinks without a file ignore the request.
+     */
+    virtual void reopen() {}
+
+    /**
+     * @brief Tells the sink that no more messages are waiting for now.
+     *
+     * Called by an asynchronous logger's worker once its queue has run dry,
+     * on the thread that calls log(). Sinks that hold messages back to send
+     * them in batches send what they hold here, so that it does not wait for
+     * the next message. Synchronous loggers never call it.
+     */
+    virtual void onIdle() {}
+
+    /**
+     * @brief Formats a message into a buffer instead of writing it, for the pipelined backend.
+     *
+     * A sink that can separate formatting from output appends the message,
+     * exactly as log() would write it, to out and returns true; the text is
+     * later passed to writeFormatted(), together with the messages formatted
+     * after it and possibly on another thread. The default returns false, and
+     * the message is then passed to log() instead.
+     *
+     * @param out Receives the formatted message.
+     * @param name The category name for the log message.
+     * @param level The log level of the message.
+     * @param time_stamp_type The type of timestamp to generate.
+     * @param message The message content to log.
+     * @param file The file name where the log was generated.
+     * @param function The function name where the log was generated.
+     * @param line The line number where the log was generated.
+     * @return True if the message was appended to out.
+     */
+    virtual bool formatTo([[maybe_unused]] std::string& out,
+                          [[maybe_unused]] const std::string& name,
+                          [[maybe_unused]] LogLevel level,
+                          [[maybe_unused]] TimeStampType time_stamp_type,
+                          [[maybe_unused]] const std::string& message,
+                          [[maybe_unused]] const std::string& file,
+                          [[maybe_unused]] const std::string& function,
+                          [[maybe_unused]] uint32_t line) {
+        return false;
+    }
+
+    /**
+     * @brief Returns whether formatTo() appends messages rather than returning false.
+     *
+     * With parallel formatting, the pipelined backend calls formatTo() on
+     * formatter threads, where falling back to log() would break the order;
+     * it therefore asks up front. A sink returning true must accept
+     * concurrent formatTo() calls (for different buffers) and always return
+     * true from them.
+     *
+     * @return True if the sink formats through formatTo().
+     */
+    [[nodiscard]] virtual bool canFormatTo() const { return false; }
+
+    /**
+     * @brief Writes messages formatted by formatTo() to the output in one go.
+     *
+     * Never runs concurrently with formatTo() on the same text, nor with flush() or reopen().
+     *
+     * @param text One or more formatted messages.
+     * @param messages The number of messages in text.
+     */
+    virtual void writeFormatted([[maybe_unused]] std::string_view text, [[maybe_unused]] size_t messages) {}
+
+    /**
+     * @brief Flushes the sink while the process is crashing.
+     *
+     * Sinks that write on a thread of their own wait for it, but only until the deadline.
+     *
+     * @param deadline When to give up.
+     * @return True if the sink was flushed before the deadline.
+     */
+    virtual bool drainOnCrash([[maybe_unused]] std::chrono::steady_clock::time_point deadline) {
+        flush();
+        return true;
+    }
+
    protected:
     /**
      * @brief Default constructor.
@@ -0,0 +1,94 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_stats.h"
+
+#include <numeric>
+
+namespace {
+
+uint64_t sum(const vne::log::LevelCounts& counts) {
+    return std::accumulate(counts.begin(), counts.end(), uint64_t{0});
+}
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+size_t statsShardIndex() noexcept {
+    static std::atomic<size_t> next_shard{0};
+    thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % kStatsShardCount;
+    return shard;
+}
+
+uint64_t LoggerStats::totalAccepted() const {
+    return sum(accepted);
+}
+
+uint64_t LoggerStats::totalFiltered() const {
+    return sum(filtered);
+}
+
+uint64_t LoggerStats::totalDropped() const {
+    uint64_t total = sum(dropped);
+    for (const auto& sink : sinks) {
+        total += sink.dropped;
+    }
+    return total;
+}
+
+uint64_t LoggerStats::totalWriteErrors() const {
+    uint64_t total = 0;
+    for (const auto& sink : sinks) {
+        total += sink.write_errors;
+    }
+    return total;
+}
+
+uint64_t LoggingStats::totalDropped() const {
+    uint64_t total = 0;
+    for (const auto& logger : loggers) {
+        total += logger.totalDropped();
+    }
+    return total;
+}
+
+uint64_t LoggingStats::totalWriteErrors() const {
+    uint64_t total = 0;
+    for (const auto& logger : loggers) {
+        total += logger.totalWriteErrors();
+    }
+    return total;
+}
+
+void LoggerCounters::snapshot(LoggerStats& stats) const {
+    for (size_t level = 0; level < kLogLevelCount; ++level) {
+        stats.accepted[level] = counters_.load(kAcceptedBase + level);
+        stats.filtered[level] = counters_.load(kFilteredBase + level);
+        stats.dropped[level] = counters_.load(kDroppedBase + level);
+    }
+    stats.flush_count = counters_.load(kFlushCount);
+    stats.flush_time_ns = counters_.load(kFlushTimeNs);
+}
+
+SinkStats SinkCounters::snapshot() const {
+    SinkStats stats;
+    stats.messages_written = counters_.load(kMessagesWritten);
+    stats.bytes_formatted = counters_.load(kBytesFormatted);
+    stats.bytes_written = counters_.load(kBytesWritten);
+    stats.write_errors = counters_.load(kWriteErrors);
+    stats.flush_count = counters_.load(kFlushCount);
+    return stats;
+}
+
+}  // namespace log
+}  // namespace vne
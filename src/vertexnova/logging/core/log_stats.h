@@ -0,0 +1,325 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_level.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file log_stats.h
+ *
+ * @brief Runtime statistics for loggers, queues and sinks.
+ *
+ * Counters are kept in relaxed atomics spread over a small number of
+ * cache-line-sized shards. Each thread is assigned a shard on first use, so
+ * producers on different threads increment different cache lines and do not
+ * contend. Reading a counter sums all shards; snapshots are therefore
+ * consistent per counter but not across counters.
+ */
+
+namespace vne::log {
+
+inline constexpr size_t kLogLevelCount = 6;    //!< Number of LogLevel values (eTrace..eFatal).
+inline constexpr size_t kStatsShardCount = 8;  //!< Number of per-thread counter shards.
+inline constexpr size_t kStatsCacheLine = 64;  //!< Assumed cache line size for shard padding.
+
+/**
+ * @brief Per-level message counts, indexed by static_cast<size_t>(LogLevel).
+ */
+using LevelCounts = std::array<uint64_t, kLogLevelCount>;
+
+/**
+ * @struct SinkStats
+ * @brief Snapshot of the counters of a single log sink.
+ */
+struct SinkStats {
+    uint64_t messages_written = 0;  //!< Messages handed to the sink's output.
+    uint64_t bytes_formatted = 0;   //!< Bytes produced by the formatter.
+    uint64_t bytes_written = 0;     //!< Bytes successfully written to the output.
+    uint64_t write_errors = 0;      //!< Writes that failed (stream in a bad state).
+    uint64_t flush_count = 0;       //!< Number of flushes.
+    uint64_t dropped = 0;           //!< Messages discarded: the sink's buffer was full (isolated, shared-memory).
+};
+
+/**
+ * @struct QueueStats
+ * @brief Snapshot of an asynchronous logger's queue and worker thread.
+ */
+struct QueueStats {
+    uint64_t enqueued = 0;                 //!< Records pushed onto the queue; flushes and reopens are not counted.
+    uint64_t priority_enqueued = 0;        //!< Of those, pushed onto the priority lane.
+    uint64_t dequeued = 0;                 //!< Records removed from the queue.
+    uint64_t current_depth = 0;            //!< Records waiting in the queue at snapshot time.
+    uint64_t high_water_depth = 0;         //!< Largest depth observed since creation or the last reset.
+    uint64_t batches = 0;                  //!< Batches processed by the worker thread.
+    uint64_t worker_busy_ns = 0;           //!< Time the worker spent running tasks.
+    uint64_t worker_idle_ns = 0;           //!< Time the worker spent waiting for tasks.
+    uint64_t pipeline_buffers = 0;         //!< Buffers the worker handed to the pipeline (pipelined backend).
+    uint64_t pipeline_bytes = 0;           //!< Text in those buffers.
+    uint64_t pipeline_stalls = 0;          //!< Times the formatting stage waited for a free buffer.
+    uint64_t pipeline_io_busy_ns = 0;      //!< Time the I/O thread spent writing.
+    uint64_t pipeline_format_busy_ns = 0;  //!< Time the formatter threads spent formatting (parallel formatting).
+};
+
+/**
+ * @struct LoggerStats
+ * @brief Snapshot of a logger's counters, including its queue and sinks.
+ */
+struct LoggerStats {
+    std::string name;              //!< Name of the logger.
+    bool async = false;            //!< True if the logger dispatches through a queue.
+    bool hybrid = false;           //!< True if severe messages are written synchronously (async loggers only).
+    bool pipelined = false;        //!< True if formatting and writing run on separate threads (async loggers only).
+    LevelCounts accepted{};        //!< Messages at or above the current level, per level.
+    LevelCounts filtered{};        //!< Messages discarded by the level filter, per level.
+    LevelCounts dropped{};         //!< Accepted messages discarded before reaching the sinks (e.g. while crashing).
+    uint64_t flush_count = 0;      //!< Number of logger flushes (explicit and flush-level triggered).
+    uint64_t flush_time_ns = 0;    //!< Total time spent in those flushes.
+    QueueStats queue;              //!< Queue and worker counters (all zero for synchronous loggers).
+    std::vector<SinkStats> sinks;  //!< Per-sink counters, in the order returned by getLogSinks().
+
+    /**
+     * @brief Returns the number of accepted messages over all levels.
+     */
+    [[nodiscard]] uint64_t totalAccepted() const;
+
+    /**
+     * @brief Returns the number of filtered messages over all levels.
+     */
+    [[nodiscard]] uint64_t totalFiltered() const;
+
+    /**
+     * @brief Returns the number of messages dropped over all levels, plus those dropped by the sinks.
+     *
+     * A sink drops a message when its own buffer is full (SinkStats::dropped); the other sinks may
+     * still have written it, so those drops are not attributed to a level.
+     */
+    [[nodiscard]] uint64_t totalDropped() const;
+
+    /**
+     * @brief Returns the number of sink write errors over all sinks.
+     */
+    [[nodiscard]] uint64_t totalWriteErrors() const;
+};
+
+/**
+ * @struct LoggingStats
+ * @brief Snapshot of every logger managed by the logging system.
+ */
+struct LoggingStats {
+    std::vector<LoggerStats> loggers;  //!< One entry per logger, sorted by name.
+
+    /**
+     * @brief Returns the number of dropped messages over all loggers.
+     */
+    [[nodiscard]] uint64_t totalDropped() const;
+
+    /**
+     * @brief Returns the number of sink write errors over all loggers.
+     */
+    [[nodiscard]] uint64_t totalWriteErrors() const;
+};
+
+/**
+ * @brief Returns the counter shard assigned to the calling thread.
+ *
+ * Threads are assigned shards round-robin on their first call.
+ */
+size_t statsShardIndex() noexcept;
+
+/**
+ * @class ShardedCounters
+ * @brief A fixed set of relaxed atomic counters, sharded per thread.
+ *
+ * @tparam kCounterCount Number of counters in the set.
+ */
+template <size_t kCounterCount>
+class ShardedCounters {
+   public:
+    /**
+     * @brief Adds a value to a counter in the calling thread's shard.
+     *
+     * @param counter Index of the counter.
+     * @param value The amount to add.
+     */
+    void add(size_t counter, uint64_t value = 1) noexcept {
+        shards_[statsShardIndex()].values[counter].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the sum of a counter over all shards.
+     *
+     * @param counter Index of the counter.
+     */
+    [[nodiscard]] uint64_t load(size_t counter) const noexcept {
+        uint64_t total = 0;
+        for (const auto& shard : shards_) {
+            total += shard.values[counter].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Sets every counter in every shard to zero.
+     */
+    void reset() noexcept {
+        for (auto& shard : shards_) {
+            for (auto& value : shard.values) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+   private:
+    struct alignas(kStatsCacheLine) Shard {
+        std::array<std::atomic<uint64_t>, kCounterCount> values{};
+    };
+
+    std::array<Shard, kStatsShardCount> shards_{};  //!< One shard per thread group.
+};
+
+/**
+ * @class LoggerCounters
+ * @brief Live counters behind LoggerStats, owned by a logger.
+ */
+class LoggerCounters {
+   public:
+    /**
+     * @brief Counts a message that passed the level filter.
+     */
+    void countAccepted(LogLevel level) noexcept { counters_.add(kAcceptedBase + index(level)); }
+
+    /**
+     * @brief Counts a message discarded by the level filter.
+     */
+    void countFiltered(LogLevel level) noexcept { counters_.add(kFilteredBase + index(level)); }
+
+    /**
+     * @brief Counts an accepted message that was discarded before reaching the sinks.
+     */
+    void countDropped(LogLevel level) noexcept { counters_.add(kDroppedBase + index(level)); }
+
+    /**
+     * @brief Counts one flush that took the given time.
+     *
+     * @param duration_ns Duration of the flush in nanoseconds.
+     */
+    void countFlush(uint64_t duration_ns) noexcept {
+        counters_.add(kFlushCount);
+        counters_.add(kFlushTimeNs, duration_ns);
+    }
+
+    /**
+     * @brief Copies the counters into the matching fields of a snapshot.
+     *
+     * @param stats The snapshot to fill.
+     */
+    void snapshot(LoggerStats& stats) const;
+
+    /**
+     * @brief Sets every counter to zero.
+     */
+    void reset() noexcept { counters_.reset(); }
+
+   private:
+    static constexpr size_t kAcceptedBase = 0;
+    static constexpr size_t kFilteredBase = kAcceptedBase + kLogLevelCount;
+    static constexpr size_t kDroppedBase = kFilteredBase + kLogLevelCount;
+    static constexpr size_t kFlushCount = kDroppedBase + kLogLevelCount;
+    static constexpr size_t kFlushTimeNs = kFlushCount + 1;
+    static constexpr size_t kCounterCount = kFlushTimeNs + 1;
+
+    static constexpr size_t index(LogLevel level) noexcept {
+        auto value = static_cast<size_t>(level);
+        return value < kLogLevelCount ? value : kLogLevelCount - 1;
+    }
+
+    ShardedCounters<kCounterCount> counters_;  //!< The sharded counter storage.
+};
+
+/**
+ * @class SinkCounters
+ * @brief Live counters behind SinkStats, owned by a sink.
+ */
+class SinkCounters {
+   public:
+    /**
+     * @brief Counts one formatted message and the outcome of writing it.
+     *
+     * @param bytes_formatted Size of the formatted message.
+     * @param written True if the write succeeded.
+     */
+    void countWrite(size_t bytes_formatted, bool written) noexcept {
+        counters_.add(kBytesFormatted, bytes_formatted);
+        if (written) {
+            counters_.add(kMessagesWritten);
+            counters_.add(kBytesWritten, bytes_formatted);
+        } else {
+            counters_.add(kWriteErrors);
+        }
+    }
+
+    /**
+     * @brief Counts one message formatted into a buffer that is written later.
+     *
+     * @param bytes_formatted Size of the formatted message.
+     */
+    void countFormatted(size_t bytes_formatted) noexcept { counters_.add(kBytesFormatted, bytes_formatted); }
+
+    /**
+     * @brief Counts the outcome of writing a buffer of messages counted by countFormatted().
+     *
+     * @param messages Number of messages in the buffer.
+     * @param bytes Size of the buffer.
+     * @param written True if the write succeeded.
+     */
+    void countBufferWrite(size_t messages, size_t bytes, bool written) noexcept {
+        if (written) {
+            counters_.add(kMessagesWritten, messages);
+            counters_.add(kBytesWritten, bytes);
+        } else {
+            counters_.add(kWriteErrors);
+        }
+    }
+
+    /**
+     * @brief Counts one flush.
+     */
+    void countFlush() noexcept { counters_.add(kFlushCount); }
+
+    /**
+     * @brief Returns a snapshot of the counters.
+     */
+    [[nodiscard]] SinkStats snapshot() const;
+
+    /**
+     * @brief Sets every counter to zero.
+     */
+    void reset() noexcept { counters_.reset(); }
+
+   private:
+    static constexpr size_t kMessagesWritten = 0;
+    static constexpr size_t kBytesFormatted = 1;
+    static constexpr size_t kBytesWritten = 2;
+    static constexpr size_t kWriteErrors = 3;
+    static constexpr size_t kFlushCount = 4;
+    static constexpr size_t kCounterCount = 5;
+
+    ShardedCounters<kCounterCount> counters_;  //!< The sharded counter storage.
+};
+
+}  // namespace vne::log
@@ -12,33 +12,113 @@
 #include "log_stream.h"
 #include "logger_controller.h"
 
+#include <array>
 #include <utility>
 
+namespace {
+
+using vne::log::LogMessageBuffer;
+
+constexpr size_t kMaxNestedStreams = 4;  //!< Pooled buffers per thread (LogStreams alive at once).
+
+/**
+ * @brief Per-thread pool of message buffers, used as a stack.
+ */
+struct ThreadBufferPool {
+    std::array<std::unique_ptr<LogMessageBuffer>, kMaxNestedStreams> buffers;
+    size_t depth = 0;
+};
+
+thread_local ThreadBufferPool t_buffer_pool;
+
+LogMessageBuffer* acquirePooledBuffer() {
+    ThreadBufferPool& pool = t_buffer_pool;
+    if (pool.depth == kMaxNestedStreams) {
+        return nullptr;
+    }
+    auto& buffer = pool.buffers[pool.depth++];
+    if (!buffer) {
+        buffer = std::make_unique<LogMessageBuffer>();
+    }
+    buffer->reset();
+    return buffer.get();
+}
+
+void releasePooledBuffer() {
+    --t_buffer_pool.depth;
+}
+
+}  // namespace
+
 namespace vne {  // Outer namespace
 namespace log {  // Inner namespace
 
+LogMessageBuffer::LogMessageBuffer()
+    : stream_(this) {
+    text_.reserve(kInitialCapacity);
+}
+
+void LogMessageBuffer::reset() {
+    text_.clear();
+    stream_.clear();
+    stream_.flags(std::ios_base::dec | std::ios_base::skipws);
+    stream_.precision(6);
+    stream_.width(0);
+    stream_.fill(' ');
+}
+
+LogMessageBuffer::int_type LogMessageBuffer::overflow(int_type ch) {
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        text_.push_back(traits_type::to_char_type(ch));
+    }
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize LogMessageBuffer::xsputn(const char* data, std::streamsize count) {
+    text_.append(data, static_cast<size_t>(count));
+    return count;
+}
+
 LogStream::LogStream(const char* logger_name,
-                     std::string category,
+                     std::string_view category,
                      LogLevel level,
                      TimeStampType time_stamp_type,
-                     std::string file,
-                     std::string function,
-                     uint32_t line)
+                     std::string_view file,
+                     std::string_view function,
+                     uint32_t line,
+                     LogCallSite* call_site)
     : logger_name_(logger_name)
-    , category_(std::move(category))
+    , category_(category)
     , log_level_(level)
     , time_stamp_type_(time_stamp_type)
-    , file_(std::move(file))
-    , function_(std::move(function))
-    , line_(line) {}
+    , file_(file)
+    , function_(function)
+    , line_(line)
+    , call_site_(call_site)
+    , buffer_(acquirePooledBuffer()) {
+    if (!buffer_) {
+        owned_buffer_ = std::make_unique<LogMessageBuffer>();
+        buffer_ = owned_buffer_.get();
+    }
+}
 
 LogStream::~LogStream() {
     std::shared_ptr<ILogger> logger = LoggerController::getLogger(logger_name_);
     if (logger) {
-        if (log_level_ >= logger->getCurrentLogLevel()) {
-            logger->log(category_, log_level_, time_stamp_type_, msg_stream_.str(), file_, function_, line_);
+        const bool force = call_site_ && call_site_->isForceEnabled();
+        if (force || log_level_ >= logger->getCurrentLogLevel()) {
+            logger->log(
+                LogRecord{category_, log_level_, time_stamp_type_, buffer_->view(), file_, function_, line_, force});
+            if (call_site_ && LogCallSite::isProfilingEnabled()) {
+                call_site_->count(buffer_->view().size());
+            }
+        } else {
+            logger->countFiltered(log_level_);
         }
     }
+    if (!owned_buffer_) {
+        releasePooledBuffer();
+    }
 }
 
 }  // namespace log
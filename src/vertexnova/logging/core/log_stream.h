@@ -10,14 +10,60 @@
  * ----------------------------------------------------------------------
  */
 
+#include "log_call_site.h"
 #include "log_level.h"
 #include "time_stamp.h"
 
+#include <memory>
+#include <ostream>
+#include <streambuf>
 #include <string>
-#include <sstream>
+#include <string_view>
 
 namespace vne::log {
 
+/**
+ * @class LogMessageBuffer
+ * @brief Reusable std::ostream that formats a log message into a growable string.
+ *
+ * LogStream takes one of these from a small per-thread pool instead of
+ * constructing a std::stringstream per message. The string keeps its capacity
+ * between messages, so formatting does not allocate once it has grown to the
+ * longest message seen on the thread.
+ */
+class LogMessageBuffer : private std::streambuf {
+   public:
+    static constexpr size_t kInitialCapacity = 256;  //!< Bytes reserved on construction.
+
+    LogMessageBuffer();
+
+    LogMessageBuffer(const LogMessageBuffer&) = delete;
+    LogMessageBuffer& operator=(const LogMessageBuffer&) = delete;
+
+    /**
+     * @brief Returns the stream that appends to the buffer.
+     */
+    std::ostream& stream() { return stream_; }
+
+    /**
+     * @brief Returns the text formatted so far.
+     */
+    [[nodiscard]] std::string_view view() const { return text_; }
+
+    /**
+     * @brief Empties the buffer and restores the stream's default formatting state.
+     */
+    void reset();
+
+   private:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char* data, std::streamsize count) override;
+
+   private:
+    std::string text_;     //!< The formatted message.
+    std::ostream stream_;  //!< Formatting front end writing into text_.
+};
+
 /**
  * @class LogStream
  * @brief Provides a streaming interface for logging messages.
@@ -25,6 +71,11 @@ namespace vne::log {
  * The LogStream class allows logging messages to be streamed and formatted
  * before being sent to the logger. It captures log details such as message category,
  * severity level, file name, function name, and line number.
+ *
+ * The message is formatted into a thread-local LogMessageBuffer (nested
+ * LogStreams on one thread each get their own buffer) and handed to the
+ * logger as a LogRecord of views, so a LogStream does not allocate once the
+ * thread's buffer has warmed up.
  */
 class LogStream {
    public:
@@ -41,14 +92,23 @@ class LogStream {
      * @param file The name of the source file where the log was generated.
      * @param function The function from which the log is called.
      * @param line The line number in the source file where the log was generated.
+     * @param call_site The statement's static descriptor (optional). A force-enabled call site bypasses the
+     *                  logger's level; the message is counted against it while log profiling is enabled.
+     *
+     * @note The string arguments are not copied; they must outlive the LogStream. The
+     *       logging macros pass literals, and temporaries live until the end of the statement.
      */
     LogStream(const char* logger_name,
-              std::string category,
+              std::string_view category,
               LogLevel level,
               TimeStampType time_stamp_type,
-              std::string file,
-              std::string function,
-              uint32_t line);
+              std::string_view file,
+              std::string_view function,
+              uint32_t line,
+              LogCallSite* call_site = nullptr);
+
+    LogStream(const LogStream&) = delete;
+    LogStream& operator=(const LogStream&) = delete;
 
     /**
      * @brief Destructor for LogStream.
@@ -68,19 +128,21 @@ class LogStream {
      */
     template<typename T>
     LogStream& operator<<(const T& msg) {
-        msg_stream_ << msg;
+        buffer_->stream() << msg;
         return *this;
     }
 
    private:
-    const char* logger_name_;        //!< The name of the logger to use
-    std::string category_;           //!< Log message category name (metadata for the log message)
-    LogLevel log_level_;             //!< The severity level of the log message.
-    TimeStampType time_stamp_type_;  //!< The type of timestamp to generate.
-    std::string file_;               //!< The name of file where log is generated
-    std::string function_;           //!< The name of the function where the log is generated.
-    uint32_t line_;                  //!< The line number in the source code where the log is generated.
-    std::stringstream msg_stream_;   //!< Internal stream to accumulate the log message.
+    const char* logger_name_;                         //!< The name of the logger to use
+    std::string_view category_;                       //!< Log message category name (metadata for the log message)
+    LogLevel log_level_;                              //!< The severity level of the log message.
+    TimeStampType time_stamp_type_;                   //!< The type of timestamp to generate.
+    std::string_view file_;                           //!< The name of file where log is generated
+    std::string_view function_;                       //!< The name of the function where the log is generated.
+    uint32_t line_;                                   //!< The source line where the log is generated.
+    LogCallSite* call_site_;                          //!< Static descriptor of the statement, or null.
+    LogMessageBuffer* buffer_;                        //!< Buffer accumulating the log message.
+    std::unique_ptr<LogMessageBuffer> owned_buffer_;  //!< Fallback buffer when the thread's pool is exhausted.
 };
 
 }  // namespace vne::log
@@ -10,8 +10,11 @@
  * ----------------------------------------------------------------------
  */
 
+#include "log_record.h"
 #include "log_sink.h"
+#include "log_stats.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -78,11 +81,70 @@ class ILogger {
                      const std::string& function,
                      uint32_t line) = 0;
 
+    /**
+     * @brief Logs a message whose text fields are views into caller-owned storage.
+     *
+     * This is the entry point used by LogStream. The default implementation copies the
+     * fields into strings and forwards to the overload above; the built-in loggers
+     * override it so that no copies are made on the calling thread.
+     *
+     * @param record The message to log. Its views only need to stay valid for the duration of the call.
+     */
+    virtual void log(const LogRecord& record) {
+        log(std::string(record.category),
+            record.level,
+            record.time_stamp_type,
+            std::string(record.message),
+            std::string(record.file),
+            std::string(record.function),
+            record.line);
+    }
+
+    /**
+     * @brief Passes a trace span event to the sinks.
+     *
+     * Called by the VNE_TRACE_* front end only when isTracingEnabled() is true.
+     * Loggers without tracing support ignore the event.
+     *
+     * @param event The span event.
+     */
+    virtual void trace([[maybe_unused]] const TraceEvent& event) {}
+
+    /**
+     * @brief Enables or disables recording of trace spans for this logger.
+     *
+     * @param enabled True to record VNE_TRACE_* spans.
+     */
+    virtual void setTracingEnabled([[maybe_unused]] bool enabled) {}
+
+    /**
+     * @brief Returns whether trace spans are recorded for this logger.
+     *
+     * @return True if tracing is enabled; false by default.
+     */
+    [[nodiscard]] virtual bool isTracingEnabled() const { return false; }
+
     /**
      * @brief Flushes all loggers.
      */
     virtual void flush() = 0;
 
+    /**
+     * @brief Reopens the output of every sink (see ILogSink::reopen), after pending messages are written.
+     */
+    virtual void reopenSinks() {}
+
+    /**
+     * @brief Writes out pending messages and flushes the sinks while the process is crashing.
+     *
+     * Called by LogCrashHandler on the crashing thread, after the crash record is written. Must not
+     * wait past the deadline; a sink call that is already running is not interrupted, though.
+     *
+     * @param deadline When to give up.
+     * @return True if everything was written, false if the deadline passed first.
+     */
+    virtual bool drainOnCrash(std::chrono::steady_clock::time_point /*deadline*/) { return true; }
+
     /**
      * @brief Retrieves the name of the logger.
      *
@@ -112,6 +174,37 @@ class ILogger {
      */
     [[nodiscard]] virtual LogLevel getFlushLevel() const = 0;
 
+    /**
+     * @brief Records a message that was discarded by the level filter before reaching log().
+     *
+     * Callers that check the level themselves (such as LogStream) report the discarded
+     * message here so that it shows up in the statistics.
+     *
+     * @param level The log level of the discarded message.
+     */
+    virtual void countFiltered([[maybe_unused]] LogLevel level) {}
+
+    /**
+     * @brief Returns a snapshot of the logger's runtime counters, including its queue and sinks.
+     *
+     * Loggers that do not keep statistics report all-zero counters.
+     *
+     * @return The logger statistics.
+     */
+    [[nodiscard]] virtual LoggerStats getStats() const {
+        LoggerStats stats;
+        stats.name = getName();
+        for (const auto& sink : getLogSinks()) {
+            stats.sinks.push_back(sink->getStats());
+        }
+        return stats;
+    }
+
+    /**
+     * @brief Resets the logger's runtime counters, including its queue and sinks, to zero.
+     */
+    virtual void resetStats() {}
+
    protected:
     ILogger() = default;
     ILogger(const ILogger&) = delete;
@@ -16,8 +16,8 @@
 namespace vne {
 namespace log {
 
-std::vector<std::shared_ptr<ILogger>>& LoggerController::getRegistry() {
-    static std::vector<std::shared_ptr<ILogger>> s_registry;
+std::vector<LoggerController::RegistryEntry>& LoggerController::getRegistry() {
+    static std::vector<RegistryEntry> s_registry;
     return s_registry;
 }
 
@@ -29,15 +29,16 @@ std::mutex& LoggerController::getMutex() {
 void LoggerController::registerLogger(std::shared_ptr<ILogger> logger) {
     if (logger) {
         std::lock_guard<std::mutex> lock(getMutex());
-        getRegistry().push_back(std::move(logger));
+        std::string name = logger->getName();
+        getRegistry().push_back({std::move(name), std::move(logger)});
     }
 }
 
-void LoggerController::unregisterLogger(const std::string& logger_name) {
+void LoggerController::unregisterLogger(std::string_view logger_name) {
     std::lock_guard<std::mutex> lock(getMutex());
     auto& registry = getRegistry();
-    auto it = std::remove_if(registry.begin(), registry.end(), [&](const auto& logger) {
-        return logger->getName() == logger_name;
+    auto it = std::remove_if(registry.begin(), registry.end(), [&](const RegistryEntry& entry) {
+        return entry.name == logger_name;
     });
     registry.erase(it, registry.end());
 }
@@ -47,19 +48,19 @@ void LoggerController::unregisterAllLoggers() {
     getRegistry().clear();
 }
 
-std::shared_ptr<ILogger> LoggerController::getLogger(const std::string& logger_name) {
+std::shared_ptr<ILogger> LoggerController::getLogger(std::string_view logger_name) {
     std::lock_guard<std::mutex> lock(getMutex());
-    auto it = std::find_if(getRegistry().begin(), getRegistry().end(), [&](const auto& logger) {
-        return logger->getName() == logger_name;
+    auto it = std::find_if(getRegistry().begin(), getRegistry().end(), [&](const RegistryEntry& entry) {
+        return entry.name == logger_name;
     });
-    return (it != getRegistry().end()) ? *it : nullptr;
+    return (it != getRegistry().end()) ? it->logger : nullptr;
 }
 
 std::vector<std::string> LoggerController::getLoggerNames() {
     std::lock_guard<std::mutex> lock(getMutex());
     std::vector<std::string> names;
-    for (const auto& logger : getRegistry()) {
-        names.push_back(logger->getName());
+    for (const auto& entry : getRegistry()) {
+        names.push_back(entry.name);
     }
     return names;
 }
@@ -14,6 +14,7 @@
 #include <mutex>
 #include <vector>
 #include <string>
+#include <string_view>
 
 #include "logger.h"
 
@@ -49,7 +50,7 @@ class LoggerController {
      *
      * @param logger_name The name of the logger instance to unregister.
      */
-    static void unregisterLogger(const std::string& logger_name);
+    static void unregisterLogger(std::string_view logger_name);
 
     /**
      * @brief Unregisters all registered loggers.
@@ -61,8 +62,10 @@ class LoggerController {
      *
      * @param logger_name The name of the logger instance to retrieve.
      * @return A shared pointer to the logger instance, or nullptr if not found.
+     *
+     * Names are cached at registration, so a lookup neither allocates nor calls ILogger::getName().
      */
-    static std::shared_ptr<ILogger> getLogger(const std::string& logger_name);
+    static std::shared_ptr<ILogger> getLogger(std::string_view logger_name);
 
     /**
      * @brief Retrieves the names of all registered loggers.
@@ -72,6 +75,14 @@ class LoggerController {
     static std::vector<std::string> getLoggerNames();
 
    private:
+    /**
+     * @brief A registered logger together with its name, captured at registration.
+     */
+    struct RegistryEntry {
+        std::string name;                 //!< The logger's name.
+        std::shared_ptr<ILogger> logger;  //!< The logger instance.
+    };
+
     /**
      * @brief Deleted constructor to prevent instantiation of LoggerController objects.
      *
@@ -83,9 +94,9 @@ class LoggerController {
     /**
      * @brief Retrieves the registry of logger instances.
      *
-     * @return A reference to the vector holding shared pointers to logger instances.
+     * @return A reference to the vector holding the registered loggers and their names.
      */
-    static std::vector<std::shared_ptr<ILogger>>& getRegistry();
+    static std::vector<RegistryEntry>& getRegistry();
 
     /**
      * @brief Retrieves the static mutex for thread-safe operations.
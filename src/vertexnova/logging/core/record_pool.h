@@ -0,0 +1,69 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vne::log {
+
+/**
+ * @class RecordPool
+ * @brief Reusable queue entries, so that queuing a message does not allocate once the pool is warm.
+ *
+ * A task queued for a worker carries a pointer to a pooled record instead of
+ * a copy of the message. Records are created on demand with their
+ * LogRecordBuffer reserved, returned after the worker has written them and
+ * never freed before the pool; the pool therefore grows to the largest
+ * number of messages in flight at once.
+ *
+ * @tparam Record A struct with a LogRecordBuffer member named record.
+ */
+template <typename Record>
+class RecordPool {
+   public:
+    static constexpr size_t kMessageCapacity = 256;  //!< Message bytes reserved in each record.
+    static constexpr size_t kFieldCapacity = 128;    //!< Bytes reserved for category, file and function.
+
+    /**
+     * @brief Takes a record from the pool, creating one if the pool is empty.
+     */
+    Record* acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_records_.empty()) {
+            records_.push_back(std::make_unique<Record>());
+            records_.back()->record.reserve(kMessageCapacity, kFieldCapacity);
+            // Keep room for every record so that release() never allocates
+            free_records_.reserve(records_.size());
+            return records_.back().get();
+        }
+        Record* record = free_records_.back();
+        free_records_.pop_back();
+        return record;
+    }
+
+    /**
+     * @brief Returns a record to the pool.
+     */
+    void release(Record* record) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_records_.push_back(record);
+    }
+
+   private:
+    std::mutex mutex_;                              //!< Guards the pool.
+    std::vector<std::unique_ptr<Record>> records_;  //!< Every record ever created (owning).
+    std::vector<Record*> free_records_;             //!< Records available for reuse.
+};
+
+}  // namespace vne::log
@@ -0,0 +1,310 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "routing_log_sink.h"
+#include "file_log_sink.h"
+#include "log_call_site.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr const char* kCategoryPlaceholder = "{category}";      //!< Replaced by the category in file routes.
+constexpr const char* kDefaultFilePattern = "%x [%l] [%!] %v";  //!< FileLogSink's own default.
+constexpr size_t kFileTargetFds = 1;  //!< Descriptors of an open file target: its stream, no emergency descriptor.
+
+/**
+ * @brief Turns a category into a file name part, replacing path separators and other unsafe characters.
+ */
+std::string fileNamePart(const std::string& category) {
+    if (category.empty()) {
+        return "default";
+    }
+    std::string part = category;
+    for (char& c : part) {
+        const bool safe = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-'
+                          || c == '_' || c == '.';
+        if (!safe) {
+            c = '_';
+        }
+    }
+    if (part.find_first_not_of('.') == std::string::npos) {
+        // "." and ".." would name a directory
+        part.assign(part.size(), '_');
+    }
+    return part;
+}
+
+/**
+ * @brief Replaces every "{category}" in a file route's path.
+ */
+std::string expandPath(const std::string& path, const std::string& category) {
+    std::string expanded = path;
+    const std::string placeholder = kCategoryPlaceholder;
+    size_t position = expanded.find(placeholder);
+    if (position == std::string::npos) {
+        return expanded;
+    }
+    const std::string part = fileNamePart(category);
+    while (position != std::string::npos) {
+        expanded.replace(position, placeholder.size(), part);
+        position = expanded.find(placeholder, position + part.size());
+    }
+    return expanded;
+}
+
+void addStats(vne::log::SinkStats& total, const vne::log::SinkStats& stats) {
+    total.messages_written += stats.messages_written;
+    total.bytes_formatted += stats.bytes_formatted;
+    total.bytes_written += stats.bytes_written;
+    total.write_errors += stats.write_errors;
+    total.flush_count += stats.flush_count;
+    total.dropped += stats.dropped;
+}
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+RoutingLogSink::RoutingLogSink(size_t max_open_fds)
+    : max_open_fds_(max_open_fds)
+    , max_open_files_(std::max<size_t>(max_open_fds / kFileTargetFds, 1))
+    , pattern_(kDefaultFilePattern) {}
+
+RoutingLogSink::~RoutingLogSink() {
+    flush();
+}
+
+void RoutingLogSink::addRoute(const LogRoute& route) {
+    if (route.file.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    routes_.push_back({route, nullptr});
+    compiled_.clear();
+}
+
+void RoutingLogSink::addRoute(const LogRoute& route, std::unique_ptr<ILogSink> sink) {
+    if (!sink) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    targets_.push_back(std::make_unique<Target>());
+    targets_.back()->sink = std::move(sink);
+    routes_.push_back({route, targets_.back().get()});
+    routes_.back().route.file.clear();
+    compiled_.clear();
+}
+
+void RoutingLogSink::log(const std::string& name,
+                         LogLevel level,
+                         TimeStampType time_stamp_type,
+                         const std::string& message,
+                         const std::string& file,
+                         const std::string& function,
+                         uint32_t line) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = compiled_.find(name);
+    const CompiledRoutes& routes = it != compiled_.end() ? it->second : compile(name);
+    const auto index = static_cast<size_t>(level);
+    if (index >= kLogLevelCount) {
+        return;
+    }
+    for (Target* target : routes[index]) {
+        acquire(*target).log(name, level, time_stamp_type, message, file, function, line);
+    }
+}
+
+void RoutingLogSink::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& target : targets_) {
+        if (target->sink) {
+            target->sink->flush();
+        }
+    }
+}
+
+void RoutingLogSink::reopen() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!open_files_.empty()) {
+        close(*open_files_.back());
+    }
+    for (auto& target : targets_) {
+        if (target->sink) {
+            target->sink->reopen();
+        }
+    }
+}
+
+void RoutingLogSink::onIdle() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& target : targets_) {
+        if (target->sink) {
+            target->sink->onIdle();
+        }
+    }
+}
+
+bool RoutingLogSink::drainOnCrash(std::chrono::steady_clock::time_point deadline) {
+    // The crashing thread may be the one writing through this sink
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return false;
+    }
+    bool drained = true;
+    for (auto& target : targets_) {
+        if (target->sink) {
+            drained = target->sink->drainOnCrash(deadline) && drained;
+        }
+    }
+    return drained;
+}
+
+std::string RoutingLogSink::getPattern() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pattern_;
+}
+
+void RoutingLogSink::setPattern(const std::string& pattern) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pattern_ = pattern;
+    for (auto& target : targets_) {
+        if (target->sink) {
+            target->sink->setPattern(pattern);
+        }
+    }
+}
+
+std::unique_ptr<ILogSink> RoutingLogSink::clone() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto routing = std::make_unique<RoutingLogSink>(max_open_fds_);
+    routing->pattern_ = pattern_;
+    for (const Route& route : routes_) {
+        if (route.target) {
+            routing->addRoute(route.route, route.target->sink->clone());
+        } else {
+            routing->addRoute(route.route);
+        }
+    }
+    return routing;
+}
+
+SinkStats RoutingLogSink::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SinkStats stats = closed_stats_;
+    for (const auto& target : targets_) {
+        if (target->sink) {
+            addStats(stats, target->sink->getStats());
+        }
+    }
+    return stats;
+}
+
+void RoutingLogSink::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_stats_ = {};
+    for (auto& target : targets_) {
+        if (target->sink) {
+            target->sink->resetStats();
+        }
+    }
+}
+
+size_t RoutingLogSink::getOpenFileCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return open_files_.size();
+}
+
+size_t RoutingLogSink::getCompiledCategoryCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return compiled_.size();
+}
+
+RoutingLogSink::CompiledRoutes& RoutingLogSink::compile(const std::string& category) {
+    if (compiled_.size() >= kMaxCompiledCategories) {
+        forgetCategories();
+    }
+    CompiledRoutes& compiled = compiled_[category];
+    std::array<bool, kLogLevelCount> taken{};
+    for (const Route& route : routes_) {
+        if (!globMatch(route.route.category, category)) {
+            continue;
+        }
+        Target* target = route.target ? route.target : getFileTarget(expandPath(route.route.file, category));
+        const auto min_level = static_cast<size_t>(route.route.min_level);
+        const auto max_level = static_cast<size_t>(route.route.max_level);
+        for (size_t level = min_level; level <= max_level && level < kLogLevelCount; ++level) {
+            if (taken[level]) {
+                continue;
+            }
+            std::vector<Target*>& targets = compiled[level];
+            if (std::find(targets.begin(), targets.end(), target) == targets.end()) {
+                targets.push_back(target);
+            }
+            taken[level] = route.route.stop;
+        }
+    }
+    return compiled;
+}
+
+void RoutingLogSink::forgetCategories() {
+    compiled_.clear();
+    // Open files stay cached; a closed one keeps nothing but its path, which the next compile finds again
+    auto closed = [](const std::unique_ptr<Target>& target) { return !target->path.empty() && !target->sink; };
+    for (const auto& target : targets_) {
+        if (closed(target)) {
+            file_targets_.erase(target->path);
+        }
+    }
+    targets_.erase(std::remove_if(targets_.begin(), targets_.end(), closed), targets_.end());
+}
+
+RoutingLogSink::Target* RoutingLogSink::getFileTarget(const std::string& path) {
+    auto it = file_targets_.find(path);
+    if (it != file_targets_.end()) {
+        return it->second;
+    }
+    targets_.push_back(std::make_unique<Target>());
+    Target* target = targets_.back().get();
+    target->path = path;
+    file_targets_.emplace(path, target);
+    return target;
+}
+
+ILogSink& RoutingLogSink::acquire(Target& target) {
+    if (target.path.empty()) {
+        return *target.sink;
+    }
+    if (target.sink) {
+        open_files_.splice(open_files_.begin(), open_files_, target.lru_entry);
+        return *target.sink;
+    }
+    while (open_files_.size() >= max_open_files_) {
+        close(*open_files_.back());
+    }
+    // Files come and go here, so they stay out of the fixed emergency descriptor table
+    target.sink = std::make_unique<FileLogSink>(target.path, true, false);
+    target.sink->setPattern(pattern_);
+    open_files_.push_front(&target);
+    target.lru_entry = open_files_.begin();
+    return *target.sink;
+}
+
+void RoutingLogSink::close(Target& target) {
+    target.sink->flush();
+    addStats(closed_stats_, target.sink->getStats());
+    target.sink.reset();
+    open_files_.erase(target.lru_entry);
+}
+
+}  // namespace log
+}  // namespace vne
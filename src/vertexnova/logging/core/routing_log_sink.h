@@ -0,0 +1,234 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_sink.h"
+
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vne::log {
+
+/**
+ * @struct LogRoute
+ * @brief Which messages a route of a RoutingLogSink takes, and for file routes where they go.
+ */
+struct LogRoute {
+    std::string category = "*";             //!< Glob over the category: `*` any run, `?` any one character.
+    LogLevel min_level = LogLevel::eTrace;  //!< Lowest level taken.
+    LogLevel max_level = LogLevel::eFatal;  //!< Highest level taken.
+    std::string file;                       //!< Target file of a file route; "{category}" becomes the category.
+    bool stop = true;                       //!< Later routes do not see the messages this route took.
+};
+
+/**
+ * @class RoutingLogSink
+ * @brief Sends each message to the sinks or files its category and level are routed to.
+ *
+ * One logger with a routing sink replaces a logger per subsystem: routes
+ * select messages by a category glob ("net.*" for a prefix) and a level
+ * range, and hand them to a sink or to a file. A file route's path may
+ * contain "{category}", which gives every matching category a file of its
+ * own. Routes are tried in the order they were added; a route with stop set
+ * hides the messages it took from the routes after it, so "*" added last
+ * catches the rest. Messages no route takes are discarded.
+ *
+ * The routes are compiled per category: the first message of a category
+ * resolves its targets for every level, and later messages of that category
+ * cost one hash lookup. Once kMaxCompiledCategories categories are compiled,
+ * the next new one clears them, together with the closed file targets only
+ * they referred to, so categories made up at run time do not grow the sink
+ * without bound. File targets are FileLogSinks opened on first use
+ * and kept in a least-recently-used cache bounded by max_open_fds, the
+ * descriptors they may hold together; the least recently written file is
+ * closed to make room and opened again, for appending, when its next message
+ * arrives. Hundreds of targets therefore need no more descriptors than the
+ * budget. Routed files are opened without emergency output, so each holds
+ * one descriptor and none of the kMaxEmergencyFds emergency slots; route
+ * VNE_LOG_EMERGENCY lines to a file through a FileLogSink of its own.
+ *
+ * Add routes before the sink is attached to a logger. Messages are written
+ * under a mutex, so getStats() may be called from any thread.
+ */
+class RoutingLogSink : public ILogSink {
+   public:
+    /**
+     * @brief Number of categories whose compiled routes are kept before they are compiled again.
+     */
+    static constexpr size_t kMaxCompiledCategories = 1024;
+
+    /**
+     * @brief Creates a sink without routes.
+     *
+     * @param max_open_fds Descriptors the open file targets may hold together (at least one file is kept open).
+     */
+    explicit RoutingLogSink(size_t max_open_fds = 64);
+
+    /**
+     * @brief Flushes the targets.
+     */
+    ~RoutingLogSink() override;
+
+    /**
+     * @brief Adds a file route; route.file must not be empty.
+     *
+     * @param route The messages taken and the target file.
+     */
+    void addRoute(const LogRoute& route);
+
+    /**
+     * @brief Adds a route to a sink; route.file is ignored.
+     *
+     * @param route The messages taken.
+     * @param sink The target sink.
+     */
+    void addRoute(const LogRoute& route, std::unique_ptr<ILogSink> sink);
+
+    /**
+     * @brief Writes the message to every target its category and level are routed to.
+     */
+    void log(const std::string& name,
+             LogLevel level,
+             TimeStampType time_stamp_type,
+             const std::string& message,
+             const std::string& file,
+             const std::string& function,
+             uint32_t line) override;
+
+    /**
+     * @brief Flushes the sink targets and the open files.
+     */
+    void flush() override;
+
+    /**
+     * @brief Closes the open files, to be opened again on their next message, and reopens the sink targets.
+     */
+    void reopen() override;
+
+    /**
+     * @brief Passes the idle notification on to the sink targets.
+     */
+    void onIdle() override;
+
+    /**
+     * @brief Flushes the targets while the process is crashing, unless a message is being written.
+     */
+    bool drainOnCrash(std::chrono::steady_clock::time_point deadline) override;
+
+    /**
+     * @brief Gets the pattern of the file targets.
+     */
+    [[nodiscard]] std::string getPattern() const override;
+
+    /**
+     * @brief Sets the pattern of every target, including files opened later.
+     *
+     * @param pattern The new log pattern.
+     */
+    void setPattern(const std::string& pattern) override;
+
+    /**
+     * @brief Returns a routing sink with the same routes and clones of the sink targets.
+     */
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
+
+    /**
+     * @brief Returns the counters of all targets added up, including files closed since.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the counters of all targets.
+     */
+    void resetStats() override;
+
+    /**
+     * @brief Returns the number of file targets open now.
+     */
+    [[nodiscard]] size_t getOpenFileCount() const;
+
+    /**
+     * @brief Returns the number of file targets that may be open at the same time.
+     */
+    [[nodiscard]] size_t getMaxOpenFiles() const { return max_open_files_; }
+
+    /**
+     * @brief Returns the number of categories whose routes have been compiled.
+     */
+    [[nodiscard]] size_t getCompiledCategoryCount() const;
+
+   private:
+    /**
+     * @brief A sink, or a file opened on demand.
+     */
+    struct Target {
+        std::unique_ptr<ILogSink> sink;          //!< The sink; for a file, null while it is closed.
+        std::string path;                        //!< The file; empty for a sink target.
+        std::list<Target*>::iterator lru_entry;  //!< Position in open_files_ while the file is open.
+    };
+
+    /**
+     * @brief A route together with its sink target.
+     */
+    struct Route {
+        LogRoute route;            //!< The messages taken.
+        Target* target = nullptr;  //!< The sink target; null for a file route.
+    };
+
+    /**
+     * @brief The targets of one category, per level.
+     */
+    using CompiledRoutes = std::array<std::vector<Target*>, kLogLevelCount>;
+
+    /**
+     * @brief Resolves the targets of a category from the routes.
+     */
+    CompiledRoutes& compile(const std::string& category);
+
+    /**
+     * @brief Drops the compiled categories and the closed file targets that only they referred to.
+     */
+    void forgetCategories();
+
+    /**
+     * @brief Returns the file target for a path, creating it closed.
+     */
+    Target* getFileTarget(const std::string& path);
+
+    /**
+     * @brief Returns the target's sink, opening the file and evicting the least recently used one if needed.
+     */
+    ILogSink& acquire(Target& target);
+
+    /**
+     * @brief Flushes and closes an open file, keeping its counters.
+     */
+    void close(Target& target);
+
+   private:
+    size_t max_open_fds_;                                       //!< Descriptor budget of the file cache.
+    size_t max_open_files_;                                     //!< Capacity of the file cache.
+    std::string pattern_;                                       //!< Pattern of the file targets.
+    std::vector<Route> routes_;                                 //!< Routes in the order they were added.
+    std::vector<std::unique_ptr<Target>> targets_;              //!< Every target (owning).
+    std::unordered_map<std::string, Target*> file_targets_;     //!< File targets by path.
+    std::unordered_map<std::string, CompiledRoutes> compiled_;  //!< Targets per category and level.
+    std::list<Target*> open_files_;                             //!< Open files, most recently used first.
+    SinkStats closed_stats_;                                    //!< Counters of files when they were closed.
+    mutable std::mutex mutex_;                                  //!< Guards everything above.
+};
+
+}  // namespace vne::log
@@ -0,0 +1,339 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "shared_log_segment.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32) || defined(VNE_PLATFORM_WEB)
+#define VNE_LOG_SHM_UNSUPPORTED 1
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr uint32_t kMagic = 0x564E4C53;       //!< "VNLS": the segment is initialized.
+constexpr uint32_t kVersion = 1;              //!< Layout version.
+constexpr uint32_t kWrapMarker = UINT32_MAX;  //!< Length field of the padding before a wrap.
+constexpr size_t kHeaderBytes = 64;           //!< Space reserved for the segment header.
+constexpr int kOpenRetries = 100;             //!< Polls for a segment another process is initializing.
+constexpr auto kOpenRetryInterval = std::chrono::milliseconds(10);
+
+constexpr uint32_t kSlotFree = 0;      //!< Nobody writes the ring.
+constexpr uint32_t kSlotClaimed = 1;   //!< A producer owns the ring.
+constexpr uint32_t kSlotReleased = 2;  //!< The producer left; the ring is freed once read.
+
+/**
+ * @brief Prefix of every record in a ring.
+ */
+struct RecordHeader {
+    uint32_t length;  //!< Bytes of text, or kWrapMarker.
+    uint32_t reserved;
+    int64_t time_ns;  //!< Time stamp used to merge rings.
+};
+
+constexpr uint64_t align8(uint64_t value) {
+    return (value + 7) & ~uint64_t{7};
+}
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared rings need lock-free 64-bit atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared rings need lock-free 32-bit atomics");
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+/**
+ * @brief Start of the segment.
+ */
+struct SharedLogSegment::SegmentHeader {
+    std::atomic<uint32_t> magic;  //!< kMagic once the creator has initialized the segment.
+    uint32_t version;             //!< kVersion.
+    uint32_t slots;               //!< Number of rings.
+    uint32_t ring_bytes;          //!< Size of each ring.
+};
+
+/**
+ * @brief Per-slot state; the producer's and the collector's fields sit on separate cache lines.
+ */
+struct alignas(64) SharedLogSegment::RingHeader {
+    std::atomic<uint32_t> state;             //!< kSlotFree, kSlotClaimed or kSlotReleased.
+    std::atomic<int32_t> pid;                //!< Producer process, 0 while claiming.
+    alignas(64) std::atomic<uint64_t> head;  //!< Bytes ever written (producer).
+    std::atomic<uint64_t> dropped;           //!< Records that did not fit (producer).
+    alignas(64) std::atomic<uint64_t> tail;  //!< Bytes ever read and committed (collector).
+};
+
+SharedLogSegment::~SharedLogSegment() {
+    close();
+}
+
+bool SharedLogSegment::isSupported() {
+#ifdef VNE_LOG_SHM_UNSUPPORTED
+    return false;
+#else
+    return true;
+#endif
+}
+
+#ifdef VNE_LOG_SHM_UNSUPPORTED
+
+bool SharedLogSegment::open(const std::string&, const SharedLogSegmentOptions&) {
+    return false;
+}
+
+void SharedLogSegment::close() {}
+
+void SharedLogSegment::unlink(const std::string&) {}
+
+size_t SharedLogSegment::reclaimSlots() {
+    return 0;
+}
+
+#else
+
+bool SharedLogSegment::open(const std::string& name, const SharedLogSegmentOptions& options) {
+    close();
+    const uint32_t slots = static_cast<uint32_t>(options.slots == 0 ? 1 : options.slots);
+    const uint32_t ring_bytes = static_cast<uint32_t>(align8(std::max<size_t>(options.ring_bytes, 1024)));
+
+    int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    const bool created = fd >= 0;
+    if (!created) {
+        if (errno != EEXIST) {
+            return false;
+        }
+        fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            return false;
+        }
+    }
+
+    size_t bytes = 0;
+    if (created) {
+        bytes = kHeaderBytes + slots * sizeof(RingHeader) + static_cast<size_t>(slots) * ring_bytes;
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+    } else {
+        // The creator may still be sizing it
+        struct stat info {};
+        for (int i = 0; i < kOpenRetries && (::fstat(fd, &info) != 0 || info.st_size == 0); ++i) {
+            std::this_thread::sleep_for(kOpenRetryInterval);
+        }
+        bytes = static_cast<size_t>(info.st_size);
+        if (bytes < kHeaderBytes) {
+            ::close(fd);
+            return false;
+        }
+    }
+
+    void* mapping = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    header_ = static_cast<SegmentHeader*>(mapping);
+    mapped_bytes_ = bytes;
+
+    if (created) {
+        // ftruncate() zero-fills, which is every field's initial value; construct the atomics in place
+        header_->version = kVersion;
+        header_->slots = slots;
+        header_->ring_bytes = ring_bytes;
+        for (uint32_t i = 0; i < slots; ++i) {
+            new (&ring(i)) RingHeader{};
+        }
+        header_->magic.store(kMagic, std::memory_order_release);
+        return true;
+    }
+
+    for (int i = 0; i < kOpenRetries && header_->magic.load(std::memory_order_acquire) != kMagic; ++i) {
+        std::this_thread::sleep_for(kOpenRetryInterval);
+    }
+    const size_t expected = kHeaderBytes + header_->slots * sizeof(RingHeader)
+                            + static_cast<size_t>(header_->slots) * header_->ring_bytes;
+    if (header_->magic.load(std::memory_order_acquire) != kMagic || header_->version != kVersion
+        || expected != mapped_bytes_) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void SharedLogSegment::close() {
+    if (header_) {
+        ::munmap(header_, mapped_bytes_);
+        header_ = nullptr;
+        mapped_bytes_ = 0;
+    }
+}
+
+void SharedLogSegment::unlink(const std::string& name) {
+    ::shm_unlink(name.c_str());
+}
+
+size_t SharedLogSegment::reclaimSlots() {
+    size_t freed = 0;
+    for (uint32_t slot = 0; slot < getSlotCount(); ++slot) {
+        RingHeader& r = ring(slot);
+        uint32_t state = r.state.load(std::memory_order_acquire);
+        if (state == kSlotClaimed) {
+            pid_t pid = r.pid.load(std::memory_order_acquire);
+            bool alive = pid == 0 || ::kill(pid, 0) == 0 || errno == EPERM;
+            if (alive) {
+                continue;
+            }
+        } else if (state != kSlotReleased) {
+            continue;
+        }
+        if (r.tail.load(std::memory_order_relaxed) != r.head.load(std::memory_order_acquire)) {
+            continue;
+        }
+        r.pid.store(0, std::memory_order_relaxed);
+        if (r.state.compare_exchange_strong(state, kSlotFree, std::memory_order_acq_rel)) {
+            ++freed;
+        }
+    }
+    return freed;
+}
+
+#endif  // VNE_LOG_SHM_UNSUPPORTED
+
+uint32_t SharedLogSegment::getSlotCount() const {
+    return header_ ? header_->slots : 0;
+}
+
+uint32_t SharedLogSegment::claimSlot() {
+#ifdef VNE_LOG_SHM_UNSUPPORTED
+    return kNoSlot;
+#else
+    for (uint32_t slot = 0; slot < getSlotCount(); ++slot) {
+        RingHeader& r = ring(slot);
+        uint32_t expected = kSlotFree;
+        if (r.state.compare_exchange_strong(expected, kSlotClaimed, std::memory_order_acq_rel)) {
+            r.dropped.store(0, std::memory_order_relaxed);
+            r.pid.store(static_cast<int32_t>(::getpid()), std::memory_order_release);
+            return slot;
+        }
+    }
+    return kNoSlot;
+#endif
+}
+
+void SharedLogSegment::releaseSlot(uint32_t slot) {
+    if (slot < getSlotCount()) {
+        ring(slot).state.store(kSlotReleased, std::memory_order_release);
+    }
+}
+
+bool SharedLogSegment::write(uint32_t slot, int64_t time_ns, std::string_view text) {
+    RingHeader& r = ring(slot);
+    const uint64_t ring_bytes = header_->ring_bytes;
+    const uint64_t needed = align8(sizeof(RecordHeader) + text.size());
+    const uint64_t head = r.head.load(std::memory_order_relaxed);
+    const uint64_t offset = head % ring_bytes;
+    const uint64_t contiguous = ring_bytes - offset;
+    // A record that does not fit before the end is preceded by padding up to the end
+    const uint64_t padding = contiguous < needed ? contiguous : 0;
+    if (needed > ring_bytes || head + padding + needed - r.tail.load(std::memory_order_acquire) > ring_bytes) {
+        r.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    char* data = ringData(slot);
+    uint64_t position = head;
+    if (padding > 0) {
+        std::memcpy(data + offset, &kWrapMarker, sizeof(kWrapMarker));
+        position += padding;
+    }
+    RecordHeader record_header{static_cast<uint32_t>(text.size()), 0, time_ns};
+    char* target = data + position % ring_bytes;
+    std::memcpy(target, &record_header, sizeof(record_header));
+    std::memcpy(target + sizeof(record_header), text.data(), text.size());
+    r.head.store(position + needed, std::memory_order_release);
+    return true;
+}
+
+bool SharedLogSegment::read(uint32_t slot, uint64_t position, Record& record) const {
+    const RingHeader& r = ring(slot);
+    const uint64_t ring_bytes = header_->ring_bytes;
+    const uint64_t head = r.head.load(std::memory_order_acquire);
+    if (position >= head) {
+        return false;
+    }
+    const char* data = ringData(slot);
+    uint64_t offset = position % ring_bytes;
+    uint32_t length = 0;
+    std::memcpy(&length, data + offset, sizeof(length));
+    if (length == kWrapMarker) {
+        position += ring_bytes - offset;
+        if (position >= head) {
+            return false;
+        }
+        offset = 0;
+    }
+    RecordHeader record_header{};
+    std::memcpy(&record_header, data + offset, sizeof(record_header));
+    if (record_header.length > ring_bytes - sizeof(RecordHeader)) {
+        // Not a record we wrote; skip to what the producer has published
+        record.time_ns = 0;
+        record.text = {};
+        record.end = head;
+        return true;
+    }
+    record.time_ns = record_header.time_ns;
+    record.text = std::string_view(data + offset + sizeof(RecordHeader), record_header.length);
+    record.end = position + align8(sizeof(RecordHeader) + record_header.length);
+    return true;
+}
+
+uint64_t SharedLogSegment::getReadPosition(uint32_t slot) const {
+    return ring(slot).tail.load(std::memory_order_relaxed);
+}
+
+void SharedLogSegment::commitRead(uint32_t slot, uint64_t position) {
+    ring(slot).tail.store(position, std::memory_order_release);
+}
+
+uint64_t SharedLogSegment::getDropped(uint32_t slot) const {
+    return ring(slot).dropped.load(std::memory_order_relaxed);
+}
+
+bool SharedLogSegment::isClaimed(uint32_t slot) const {
+    return ring(slot).state.load(std::memory_order_acquire) != kSlotFree;
+}
+
+SharedLogSegment::RingHeader& SharedLogSegment::ring(uint32_t slot) const {
+    char* base = reinterpret_cast<char*>(header_) + kHeaderBytes;
+    return reinterpret_cast<RingHeader*>(base)[slot];
+}
+
+char* SharedLogSegment::ringData(uint32_t slot) const {
+    char* base = reinterpret_cast<char*>(header_) + kHeaderBytes + header_->slots * sizeof(RingHeader);
+    return base + static_cast<size_t>(slot) * header_->ring_bytes;
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,189 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @file shared_log_segment.h
+ *
+ * @brief Shared-memory segment of per-process rings, written by SharedMemoryLogSink and read by SharedLogCollector.
+ *
+ * The segment is a POSIX shared-memory object laid out as a SegmentHeader,
+ * an array of RingHeader (one per slot) and the ring buffers. Each producer
+ * (a SharedMemoryLogSink, normally one per process) claims a free slot and is
+ * that ring's only writer; the collector is its only reader, so every ring is
+ * single-producer, single-consumer and needs no lock across processes.
+ *
+ * A ring carries records: a RecordHeader (length and time stamp) followed by
+ * the formatted line, padded to 8 bytes. A record never wraps; when it does not
+ * fit before the end of the buffer, the producer writes a wrap marker and
+ * continues at the start. The read position lives in the segment, so a
+ * collector that restarts continues where the previous one stopped. Slots of
+ * processes that died are released by the collector once their ring is empty.
+ *
+ * Only POSIX platforms are supported; elsewhere open() returns false.
+ */
+
+namespace vne::log {
+
+/**
+ * @struct SharedLogSegmentOptions
+ * @brief Geometry of a segment; only used by the process that creates it.
+ */
+struct SharedLogSegmentOptions {
+    size_t slots = 32;               //!< Rings, i.e. producers that can be attached at the same time.
+    size_t ring_bytes = 256 * 1024;  //!< Size of each ring; rounded up to a multiple of 8.
+};
+
+class SharedLogSegment {
+   public:
+    /// Slot value returned when no slot is free.
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+    /// Segment name used when none is given.
+    static constexpr const char* kDefaultName = "/vnelog";
+
+    SharedLogSegment() = default;
+
+    /**
+     * @brief Unmaps the segment; the shared-memory object itself is left for other processes.
+     */
+    ~SharedLogSegment();
+
+    SharedLogSegment(const SharedLogSegment&) = delete;
+    SharedLogSegment& operator=(const SharedLogSegment&) = delete;
+
+    /**
+     * @brief Opens the named segment, creating and initializing it if it does not exist.
+     *
+     * @param name POSIX shared-memory name, starting with '/'.
+     * @param options Geometry used if the segment is created here.
+     * @return True if the segment is mapped and initialized.
+     */
+    bool open(const std::string& name, const SharedLogSegmentOptions& options = {});
+
+    /**
+     * @brief Unmaps the segment.
+     */
+    void close();
+
+    /**
+     * @brief Removes the shared-memory object; processes that have it mapped keep using it.
+     *
+     * @param name POSIX shared-memory name.
+     */
+    static void unlink(const std::string& name);
+
+    /**
+     * @brief Returns whether this platform has POSIX shared memory.
+     */
+    static bool isSupported();
+
+    /**
+     * @brief Returns whether the segment is mapped.
+     */
+    [[nodiscard]] bool isOpen() const { return header_ != nullptr; }
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    [[nodiscard]] uint32_t getSlotCount() const;
+
+    /**
+     * @brief Claims a free slot for the calling process.
+     *
+     * @return The slot, or kNoSlot if every slot is in use.
+     */
+    uint32_t claimSlot();
+
+    /**
+     * @brief Gives a slot back; the collector frees it once its ring has been read.
+     *
+     * @param slot A slot returned by claimSlot().
+     */
+    void releaseSlot(uint32_t slot);
+
+    /**
+     * @brief Appends a record to a slot's ring; called by the slot's producer only.
+     *
+     * Makes no system call. A record that does not fit is counted as dropped.
+     *
+     * @param slot The producer's slot.
+     * @param time_ns Time stamp used to merge the rings, in nanoseconds since the epoch.
+     * @param text The formatted line, without a trailing newline.
+     * @return True if the record was written.
+     */
+    bool write(uint32_t slot, int64_t time_ns, std::string_view text);
+
+    /**
+     * @brief A record read from a ring.
+     */
+    struct Record {
+        int64_t time_ns = 0;    //!< The record's time stamp.
+        std::string_view text;  //!< The line; valid until the slot's read position is committed.
+        uint64_t end = 0;       //!< Read position after this record, for commitRead().
+    };
+
+    /**
+     * @brief Reads the record at a position of a slot's ring; called by the collector only.
+     *
+     * @param slot The slot to read.
+     * @param position Where to read; start with getReadPosition(), then use Record::end.
+     * @param record Receives the record.
+     * @return False if there is no complete record at position.
+     */
+    bool read(uint32_t slot, uint64_t position, Record& record) const;
+
+    /**
+     * @brief Returns the committed read position of a slot.
+     */
+    [[nodiscard]] uint64_t getReadPosition(uint32_t slot) const;
+
+    /**
+     * @brief Frees ring space up to a position; records before it are not read again, even after a restart.
+     */
+    void commitRead(uint32_t slot, uint64_t position);
+
+    /**
+     * @brief Returns the number of records a slot's producer dropped because its ring was full.
+     */
+    [[nodiscard]] uint64_t getDropped(uint32_t slot) const;
+
+    /**
+     * @brief Returns whether a slot is claimed by a producer (or released but not yet read to the end).
+     */
+    [[nodiscard]] bool isClaimed(uint32_t slot) const;
+
+    /**
+     * @brief Frees slots whose producer released them or died, once their ring has been read.
+     *
+     * @return The number of slots freed.
+     */
+    size_t reclaimSlots();
+
+   private:
+    struct SegmentHeader;
+    struct RingHeader;
+
+    RingHeader& ring(uint32_t slot) const;
+    char* ringData(uint32_t slot) const;
+
+   private:
+    SegmentHeader* header_ = nullptr;  //!< Start of the mapping.
+    size_t mapped_bytes_ = 0;          //!< Size of the mapping.
+};
+
+}  // namespace vne::log
@@ -0,0 +1,99 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "shared_memory_log_sink.h"
+#include "log_formatter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+SharedMemoryLogSink::SharedMemoryLogSink(const std::string& segment_name, const SharedLogSegmentOptions& options)
+    : segment_name_(segment_name)
+    , options_(options)
+    , pattern_("%x [%l] [%!] %v") {
+    if (!segment_.open(segment_name_, options_)) {
+        std::cerr << "[ERROR] : Couldn't open shared log segment " << segment_name_ << std::endl;
+        return;
+    }
+    slot_ = segment_.claimSlot();
+    if (slot_ == SharedLogSegment::kNoSlot) {
+        std::cerr << "[ERROR] : No free slot in shared log segment " << segment_name_ << std::endl;
+    }
+}
+
+SharedMemoryLogSink::~SharedMemoryLogSink() {
+    if (isAttached()) {
+        segment_.releaseSlot(slot_);
+    }
+}
+
+void SharedMemoryLogSink::log(const std::string& name,
+                              LogLevel level,
+                              TimeStampType time_stamp_type,
+                              const std::string& message,
+                              const std::string& file,
+                              const std::string& function,
+                              uint32_t line) {
+    std::string formatted_log =
+        LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_);
+    bool written = false;
+    if (isAttached()) {
+        int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        // The collector merges rings assuming each one is in time order
+        last_time_ns_ = std::max(last_time_ns_, now_ns);
+        written = segment_.write(slot_, last_time_ns_, formatted_log);
+    }
+    if (written) {
+        counters_.countWrite(formatted_log.size() + 1, true);
+    } else {
+        counters_.countFormatted(formatted_log.size() + 1);
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SharedMemoryLogSink::flush() {
+    counters_.countFlush();
+}
+
+std::string SharedMemoryLogSink::getPattern() const {
+    return pattern_;
+}
+
+void SharedMemoryLogSink::setPattern(const std::string& pattern) {
+    pattern_ = pattern;
+}
+
+std::unique_ptr<ILogSink> SharedMemoryLogSink::clone() const {
+    auto sink = std::make_unique<SharedMemoryLogSink>(segment_name_, options_);
+    sink->setPattern(pattern_);
+    return sink;
+}
+
+SinkStats SharedMemoryLogSink::getStats() const {
+    SinkStats stats = counters_.snapshot();
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SharedMemoryLogSink::resetStats() {
+    counters_.reset();
+    dropped_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,128 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_sink.h"
+#include "shared_log_segment.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace vne::log {
+
+/**
+ * @class SharedMemoryLogSink
+ * @brief Writes formatted messages into a ring of a shared-memory segment, for a collector process to merge.
+ *
+ * Several processes that log to the same place would otherwise each open the
+ * output file and interleave their writes, paying a write() per message. With
+ * this sink every process appends its lines to its own ring in a shared
+ * segment (see SharedLogSegment) without any system call, and a single
+ * collector (SharedLogCollector, run by the vnelog-collectord daemon) merges
+ * the rings by time stamp into one rotated file.
+ *
+ * The sink claims a slot when it is constructed and releases it when it is
+ * destroyed. When the ring is full, because the collector is slow or not
+ * running, messages are discarded and counted in SinkStats::dropped; log()
+ * never waits. The collector may be restarted at any time: the rings and
+ * their read positions live in the segment, not in the collector.
+ *
+ * Only POSIX platforms are supported; elsewhere every message is dropped.
+ */
+class SharedMemoryLogSink : public ILogSink {
+   public:
+    /**
+     * @brief Opens (or creates) the segment and claims a slot in it.
+     *
+     * @param segment_name POSIX shared-memory name, starting with '/'.
+     * @param options Geometry used if the segment does not exist yet.
+     */
+    explicit SharedMemoryLogSink(const std::string& segment_name = SharedLogSegment::kDefaultName,
+                                 const SharedLogSegmentOptions& options = {});
+
+    /**
+     * @brief Releases the slot; the collector frees it once it has read the ring.
+     */
+    ~SharedMemoryLogSink() override;
+
+    /**
+     * @brief Formats the message and appends it to the ring.
+     */
+    void log(const std::string& name,
+             LogLevel level,
+             TimeStampType time_stamp_type,
+             const std::string& message,
+             const std::string& file,
+             const std::string& function,
+             uint32_t line) override;
+
+    /**
+     * @brief Does nothing beyond counting: a message is visible to the collector once log() returns.
+     */
+    void flush() override;
+
+    /**
+     * @brief Gets the current log pattern.
+     */
+    [[nodiscard]] std::string getPattern() const override;
+
+    /**
+     * @brief Sets a new log pattern.
+     *
+     * @param pattern The new log pattern.
+     */
+    void setPattern(const std::string& pattern) override;
+
+    /**
+     * @brief Returns a sink on the same segment with its own slot.
+     */
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
+
+    /**
+     * @brief Returns the sink's counters; dropped counts the messages that did not fit in the ring.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the sink's counters.
+     */
+    void resetStats() override;
+
+    /**
+     * @brief Returns the name of the shared-memory segment.
+     */
+    [[nodiscard]] const std::string& getSegmentName() const { return segment_name_; }
+
+    /**
+     * @brief Returns whether the sink has a slot to write to.
+     */
+    [[nodiscard]] bool isAttached() const { return slot_ != SharedLogSegment::kNoSlot; }
+
+   private:
+    // Deleted copy constructor and assignment operator
+    SharedMemoryLogSink(const SharedMemoryLogSink&) = delete;
+    SharedMemoryLogSink& operator=(const SharedMemoryLogSink&) = delete;
+
+   private:
+    std::string segment_name_;                   //!< Name of the shared-memory segment.
+    SharedLogSegmentOptions options_;            //!< Geometry passed on to clones.
+    SharedLogSegment segment_;                   //!< The mapped segment.
+    uint32_t slot_ = SharedLogSegment::kNoSlot;  //!< The ring this sink writes.
+    std::string pattern_;                        //!< The log pattern.
+    std::mutex write_mutex_;                     //!< The ring has one writer; serializes the process's threads.
+    int64_t last_time_ns_ = 0;                   //!< Keeps the ring's time stamps non-decreasing.
+    SinkCounters counters_;                      //!< Runtime statistics.
+    std::atomic<uint64_t> dropped_{0};           //!< Messages that did not fit in the ring.
+};
+
+}  // namespace vne::log
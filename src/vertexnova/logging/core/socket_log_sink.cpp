@@ -0,0 +1,407 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "socket_log_sink.h"
+#include "log_formatter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32) || defined(VNE_PLATFORM_WEB)
+#define VNE_LOG_SOCKET_UNSUPPORTED 1
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t kFrameHeaderBytes = 4;  //!< Big-endian length before each line.
+constexpr int kMaxIovecs = 64;           //!< Chunks handed to one gather write.
+constexpr auto kCrashPollInterval = std::chrono::milliseconds(10);
+
+#ifndef VNE_LOG_SOCKET_UNSUPPORTED
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;  //!< A closed peer must not raise SIGPIPE.
+#else
+constexpr int kSendFlags = 0;  //!< SO_NOSIGPIPE is set on the socket instead.
+#endif
+#endif
+
+uint32_t frameLength(const std::string& data, size_t offset) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(data.data() + offset);
+    return (uint32_t{bytes[0]} << 24) | (uint32_t{bytes[1]} << 16) | (uint32_t{bytes[2]} << 8) | uint32_t{bytes[3]};
+}
+
+void appendFrame(std::string& data, const std::string& line) {
+    const auto length = static_cast<uint32_t>(line.size());
+    data.push_back(static_cast<char>((length >> 24) & 0xFF));
+    data.push_back(static_cast<char>((length >> 16) & 0xFF));
+    data.push_back(static_cast<char>((length >> 8) & 0xFF));
+    data.push_back(static_cast<char>(length & 0xFF));
+    data.append(line);
+}
+
+/**
+ * @brief Creates a non-blocking socket and starts connecting it to the endpoint.
+ *
+ * @param in_progress Set if a TCP connect has not completed yet.
+ * @return The socket, or -1 if the endpoint is invalid or refused the connection.
+ */
+int connectEndpoint(const std::string& endpoint, bool& in_progress) {
+    in_progress = false;
+#ifdef VNE_LOG_SOCKET_UNSUPPORTED
+    (void)endpoint;
+    return -1;
+#else
+    sockaddr_storage address{};
+    socklen_t address_length = 0;
+    const bool is_tcp = endpoint.rfind("tcp:", 0) == 0;
+    if (endpoint.rfind("unix:", 0) == 0) {
+        const std::string path = endpoint.substr(5);
+        auto* unix_address = reinterpret_cast<sockaddr_un*>(&address);
+        if (path.empty() || path.size() >= sizeof(unix_address->sun_path)) {
+            return -1;
+        }
+        unix_address->sun_family = AF_UNIX;
+        std::memcpy(unix_address->sun_path, path.c_str(), path.size() + 1);
+        address_length = sizeof(sockaddr_un);
+    } else if (is_tcp) {
+        const size_t colon = endpoint.rfind(':');
+        std::string host = endpoint.substr(4, colon - 4);
+        const int port = std::atoi(endpoint.c_str() + colon + 1);
+        if (host == "localhost") {
+            host = "127.0.0.1";
+        }
+        auto* inet_address = reinterpret_cast<sockaddr_in*>(&address);
+        inet_address->sin_family = AF_INET;
+        inet_address->sin_port = htons(static_cast<uint16_t>(port));
+        if (colon <= 4 || port <= 0 || port > 65535
+            || ::inet_pton(AF_INET, host.c_str(), &inet_address->sin_addr) != 1) {
+            return -1;
+        }
+        address_length = sizeof(sockaddr_in);
+    } else {
+        return -1;
+    }
+
+    const int fd = ::socket(address.ss_family, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+    int no_sigpipe = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+    if (is_tcp) {
+        // Batches are formed here; Nagle would only add latency
+        int no_delay = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+    }
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), address_length) == 0) {
+        return fd;
+    }
+    if (errno == EINPROGRESS) {
+        in_progress = true;
+        return fd;
+    }
+    ::close(fd);
+    return -1;
+#endif
+}
+
+/**
+ * @brief Returns 1 if a pending connect completed, 0 if it is still in progress and -1 if it failed.
+ */
+int pollConnect(int fd) {
+#ifdef VNE_LOG_SOCKET_UNSUPPORTED
+    (void)fd;
+    return -1;
+#else
+    pollfd descriptor{fd, POLLOUT, 0};
+    const int ready = ::poll(&descriptor, 1, 0);
+    if (ready == 0) {
+        return 0;
+    }
+    int error = 0;
+    socklen_t error_length = sizeof(error);
+    if (ready < 0 || ::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &error_length) != 0 || error != 0) {
+        return -1;
+    }
+    return 1;
+#endif
+}
+
+void closeSocket(int fd) {
+#ifndef VNE_LOG_SOCKET_UNSUPPORTED
+    ::close(fd);
+#else
+    (void)fd;
+#endif
+}
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+SocketLogSink::SocketLogSink(const std::string& endpoint, const SocketSinkOptions& options)
+    : endpoint_(endpoint)
+    , options_(options)
+    , pattern_("%x [%l] [%!] %v")
+    , backoff_(options.reconnect_min)
+    , next_attempt_(std::chrono::steady_clock::now()) {
+    if (options_.batch_bytes == 0) {
+        options_.batch_bytes = 1;
+    }
+    ensureConnected();
+}
+
+SocketLogSink::~SocketLogSink() {
+    sendSpool();
+    if (fd_ >= 0) {
+        closeSocket(fd_);
+    }
+}
+
+void SocketLogSink::log(const std::string& name,
+                        LogLevel level,
+                        TimeStampType time_stamp_type,
+                        const std::string& message,
+                        const std::string& file,
+                        const std::string& function,
+                        uint32_t line) {
+    std::string formatted_log =
+        LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_);
+    counters_.countFormatted(formatted_log.size());
+    const size_t frame_bytes = kFrameHeaderBytes + formatted_log.size();
+    const auto now = std::chrono::steady_clock::now();
+
+    size_t spooled = spooled_bytes_.load(std::memory_order_relaxed);
+    if (spooled + frame_bytes > options_.spool_bytes && now - batch_start_ >= options_.batch_delay) {
+        // Make room if the aggregator is back
+        sendSpool();
+        batch_start_ = now;
+        spooled = spooled_bytes_.load(std::memory_order_relaxed);
+    }
+    if (spooled + frame_bytes > options_.spool_bytes) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (spooled == 0) {
+        batch_start_ = now;
+    }
+    if (spool_.empty()
+        || (spool_.back().messages > 0 && spool_.back().data.size() + frame_bytes > options_.batch_bytes)) {
+        if (free_chunks_.empty()) {
+            spool_.emplace_back();
+            spool_.back().data.reserve(options_.batch_bytes);
+        } else {
+            spool_.push_back(std::move(free_chunks_.back()));
+            free_chunks_.pop_back();
+        }
+    }
+    appendFrame(spool_.back().data, formatted_log);
+    ++spool_.back().messages;
+    spooled_bytes_.store(spooled + frame_bytes, std::memory_order_relaxed);
+
+    // Above batch_bytes the peer is slow or away; then retry once per batch_delay rather than on every message
+    const bool batch_full = spooled < options_.batch_bytes && spooled + frame_bytes >= options_.batch_bytes;
+    if (batch_full || now - batch_start_ >= options_.batch_delay) {
+        sendSpool();
+        batch_start_ = now;
+    }
+}
+
+void SocketLogSink::flush() {
+    sendSpool();
+    counters_.countFlush();
+}
+
+void SocketLogSink::reopen() {
+    disconnect(false);
+    backoff_ = options_.reconnect_min;
+    sendSpool();
+}
+
+void SocketLogSink::onIdle() {
+    if (spooled_bytes_.load(std::memory_order_relaxed) > 0) {
+        sendSpool();
+        batch_start_ = std::chrono::steady_clock::now();
+    }
+}
+
+bool SocketLogSink::drainOnCrash(std::chrono::steady_clock::time_point deadline) {
+    while (true) {
+        sendSpool();
+        if (spooled_bytes_.load(std::memory_order_relaxed) == 0) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(kCrashPollInterval);
+    }
+}
+
+std::string SocketLogSink::getPattern() const {
+    return pattern_;
+}
+
+void SocketLogSink::setPattern(const std::string& pattern) {
+    pattern_ = pattern;
+}
+
+std::unique_ptr<ILogSink> SocketLogSink::clone() const {
+    auto sink = std::make_unique<SocketLogSink>(endpoint_, options_);
+    sink->setPattern(pattern_);
+    return sink;
+}
+
+SinkStats SocketLogSink::getStats() const {
+    SinkStats stats = counters_.snapshot();
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SocketLogSink::resetStats() {
+    counters_.reset();
+    dropped_.store(0, std::memory_order_relaxed);
+}
+
+bool SocketLogSink::ensureConnected() {
+    if (connected_.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (connecting_) {
+        const int state = pollConnect(fd_);
+        if (state < 0 || (state == 0 && now >= next_attempt_)) {
+            disconnect(true);
+            return false;
+        }
+        if (state == 0) {
+            return false;
+        }
+        connecting_ = false;
+    } else {
+        if (now < next_attempt_) {
+            return false;
+        }
+        fd_ = connectEndpoint(endpoint_, connecting_);
+        if (fd_ < 0) {
+            disconnect(true);
+            return false;
+        }
+        if (connecting_) {
+            // Give up on the connect after one backoff delay
+            next_attempt_ = now + backoff_;
+            return false;
+        }
+    }
+    connected_.store(true, std::memory_order_relaxed);
+    connects_.fetch_add(1, std::memory_order_relaxed);
+    backoff_ = options_.reconnect_min;
+    return true;
+}
+
+void SocketLogSink::sendSpool() {
+#ifndef VNE_LOG_SOCKET_UNSUPPORTED
+    while (!spool_.empty() && ensureConnected()) {
+        iovec vectors[kMaxIovecs];
+        int count = 0;
+        for (size_t i = 0; i < spool_.size() && count < kMaxIovecs; ++i) {
+            const size_t offset = i == 0 ? sent_offset_ : 0;
+            vectors[count].iov_base = spool_[i].data.data() + offset;
+            vectors[count].iov_len = spool_[i].data.size() - offset;
+            ++count;
+        }
+        msghdr message{};
+        message.msg_iov = vectors;
+        message.msg_iovlen = count;
+        const ssize_t sent = ::sendmsg(fd_, &message, kSendFlags);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            bool would_block = errno == EAGAIN;
+#if EAGAIN != EWOULDBLOCK
+            would_block = would_block || errno == EWOULDBLOCK;
+#endif
+            if (!would_block) {
+                counters_.countBufferWrite(0, 0, false);
+                disconnect(true);
+            }
+            return;
+        }
+
+        spooled_bytes_.fetch_sub(static_cast<size_t>(sent), std::memory_order_relaxed);
+        size_t remaining = static_cast<size_t>(sent);
+        while (remaining > 0) {
+            Chunk& front = spool_.front();
+            const size_t unsent = front.data.size() - sent_offset_;
+            if (remaining < unsent) {
+                sent_offset_ += remaining;
+                break;
+            }
+            remaining -= unsent;
+            counters_.countBufferWrite(front.messages, front.data.size(), true);
+            front.data.clear();
+            front.messages = 0;
+            free_chunks_.push_back(std::move(front));
+            spool_.pop_front();
+            sent_offset_ = 0;
+        }
+    }
+#endif
+}
+
+void SocketLogSink::disconnect(bool failed) {
+    if (fd_ >= 0) {
+        closeSocket(fd_);
+        fd_ = -1;
+    }
+    connecting_ = false;
+    connected_.store(false, std::memory_order_relaxed);
+    const auto now = std::chrono::steady_clock::now();
+    if (failed) {
+        next_attempt_ = now + backoff_;
+        backoff_ = std::min(backoff_ * 2, options_.reconnect_max);
+    } else {
+        next_attempt_ = now;
+    }
+
+    // The peer may have received part of the front frame; send that frame again whole
+    if (!spool_.empty() && sent_offset_ > 0) {
+        const std::string& data = spool_.front().data;
+        size_t frame_start = 0;
+        while (frame_start + kFrameHeaderBytes + frameLength(data, frame_start) <= sent_offset_) {
+            frame_start += kFrameHeaderBytes + frameLength(data, frame_start);
+        }
+        spooled_bytes_.fetch_add(sent_offset_ - frame_start, std::memory_order_relaxed);
+        sent_offset_ = frame_start;
+    }
+}
+
+}  // namespace log
+}  // namespace vne
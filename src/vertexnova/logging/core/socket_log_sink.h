@@ -0,0 +1,206 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_sink.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace vne::log {
+
+/**
+ * @struct SocketSinkOptions
+ * @brief Batching, spooling and reconnect settings of a SocketLogSink.
+ */
+struct SocketSinkOptions {
+    size_t batch_bytes = 16 * 1024;                   //!< Send once this many bytes are waiting.
+    std::chrono::milliseconds batch_delay{100};       //!< Send a smaller batch once its oldest record is this old.
+    size_t spool_bytes = 4 * 1024 * 1024;             //!< Bytes held while disconnected; beyond that, drop.
+    std::chrono::milliseconds reconnect_min{100};     //!< First delay before reconnecting.
+    std::chrono::milliseconds reconnect_max{10'000};  //!< The delay doubles after each failure up to this.
+};
+
+/**
+ * @class SocketLogSink
+ * @brief Streams formatted messages to a local aggregator over a Unix domain socket or loopback TCP.
+ *
+ * The endpoint is "unix:<path>" or "tcp:<host>:<port>", where host is a
+ * numeric IPv4 address or "localhost". Each message is sent as one frame: a
+ * 4-byte big-endian length followed by the formatted line (no newline).
+ *
+ * Frames are collected in a spool of batch-sized chunks. A batch is sent with
+ * a single gather write of every waiting chunk once batch_bytes are waiting,
+ * once the oldest waiting frame is batch_delay old, or on flush(). The age is
+ * checked when a message arrives, so an AsyncLogger also has the spool sent
+ * through onIdle() once its queue runs dry; under a synchronous logger a quiet
+ * spool waits for the next message or flush. The socket
+ * is non-blocking: whatever the peer does not accept stays in the spool, so
+ * log() and flush() never wait for the aggregator. Run inside an AsyncLogger,
+ * the sink therefore never holds up the worker, let alone the producers.
+ *
+ * While the aggregator is unreachable the spool keeps up to spool_bytes;
+ * messages beyond that are discarded and counted in SinkStats::dropped. The
+ * sink reconnects on a later call once the backoff delay has passed, doubling
+ * the delay from reconnect_min to reconnect_max after each failure. A frame
+ * cut off by a lost connection is sent again whole on the next one; frames the
+ * old connection had accepted are not.
+ *
+ * Only POSIX platforms are supported; elsewhere every message is dropped.
+ */
+class SocketLogSink : public ILogSink {
+   public:
+    /**
+     * @brief Creates the sink and tries to connect once.
+     *
+     * @param endpoint "unix:<path>" or "tcp:<host>:<port>".
+     * @param options Batching, spooling and reconnect settings.
+     */
+    explicit SocketLogSink(const std::string& endpoint, const SocketSinkOptions& options = {});
+
+    /**
+     * @brief Sends what the socket accepts without waiting, then closes it.
+     */
+    ~SocketLogSink() override;
+
+    /**
+     * @brief Formats the message into the spool and sends a batch if one is due.
+     */
+    void log(const std::string& name,
+             LogLevel level,
+             TimeStampType time_stamp_type,
+             const std::string& message,
+             const std::string& file,
+             const std::string& function,
+             uint32_t line) override;
+
+    /**
+     * @brief Sends as much of the spool as the socket accepts now, reconnecting if the backoff has passed.
+     */
+    void flush() override;
+
+    /**
+     * @brief Drops the connection and connects again at once, keeping the spool.
+     */
+    void reopen() override;
+
+    /**
+     * @brief Sends the spool without waiting for batch_delay, as no more messages are queued.
+     */
+    void onIdle() override;
+
+    /**
+     * @brief Keeps sending the spool until it is empty or the deadline passes.
+     *
+     * @param deadline When to give up.
+     * @return True if the spool was sent.
+     */
+    bool drainOnCrash(std::chrono::steady_clock::time_point deadline) override;
+
+    /**
+     * @brief Gets the current log pattern.
+     */
+    [[nodiscard]] std::string getPattern() const override;
+
+    /**
+     * @brief Sets a new log pattern.
+     *
+     * @param pattern The new log pattern.
+     */
+    void setPattern(const std::string& pattern) override;
+
+    /**
+     * @brief Returns a sink for the same endpoint and options, with its own connection.
+     */
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
+
+    /**
+     * @brief Returns the sink's counters; dropped counts the messages that did not fit in the spool.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the sink's counters.
+     */
+    void resetStats() override;
+
+    /**
+     * @brief Returns the endpoint.
+     */
+    [[nodiscard]] const std::string& getEndpoint() const { return endpoint_; }
+
+    /**
+     * @brief Returns whether the sink is connected to the aggregator.
+     */
+    [[nodiscard]] bool isConnected() const { return connected_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the bytes waiting in the spool.
+     */
+    [[nodiscard]] size_t getSpooledBytes() const { return spooled_bytes_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the number of connections established, including the first.
+     */
+    [[nodiscard]] uint64_t getConnectCount() const { return connects_.load(std::memory_order_relaxed); }
+
+   private:
+    /**
+     * @brief A batch-sized run of whole frames.
+     */
+    struct Chunk {
+        std::string data;     //!< Frames, each a length and a line.
+        size_t messages = 0;  //!< Frames in data.
+    };
+
+    /**
+     * @brief Connects if disconnected and the backoff has passed, or completes a pending TCP connect.
+     *
+     * @return True if connected.
+     */
+    bool ensureConnected();
+
+    /**
+     * @brief Writes as many waiting chunks as the socket accepts in one gather write per round.
+     */
+    void sendSpool();
+
+    /**
+     * @brief Closes the socket and schedules the next attempt.
+     *
+     * @param failed True to double the backoff delay.
+     */
+    void disconnect(bool failed);
+
+   private:
+    std::string endpoint_;                                //!< "unix:<path>" or "tcp:<host>:<port>".
+    SocketSinkOptions options_;                           //!< Batching, spooling and reconnect settings.
+    std::string pattern_;                                 //!< The log pattern.
+    int fd_ = -1;                                         //!< The socket, or -1.
+    bool connecting_ = false;                             //!< A non-blocking TCP connect is in progress.
+    std::chrono::milliseconds backoff_;                   //!< Delay before the next attempt after a failure.
+    std::chrono::steady_clock::time_point next_attempt_;  //!< No connect before this.
+    std::chrono::steady_clock::time_point batch_start_;   //!< When the oldest unsent frame was spooled.
+    std::deque<Chunk> spool_;                             //!< Chunks waiting to be sent, oldest first.
+    std::vector<Chunk> free_chunks_;                      //!< Sent chunks kept for reuse.
+    size_t sent_offset_ = 0;                              //!< Bytes of spool_.front() already sent.
+    std::atomic<size_t> spooled_bytes_{0};                //!< Bytes waiting in spool_.
+    std::atomic<bool> connected_{false};                  //!< Whether fd_ is a connected socket.
+    std::atomic<uint64_t> connects_{0};                   //!< Connections established.
+    std::atomic<uint64_t> dropped_{0};                    //!< Messages that did not fit in the spool.
+    SinkCounters counters_;                               //!< Runtime statistics.
+};
+
+}  // namespace vne::log
@@ -10,6 +10,19 @@
  */
 
 #include "sync_logger.h"
+#include "log_crash_handler.h"
+
+#include <chrono>
+#include <thread>
+
+namespace {
+
+uint64_t elapsedNs(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+}  // namespace
 
 namespace vne {  // Outer namespace
 namespace log {  // Inner namespace
@@ -17,9 +30,13 @@ namespace log {  // Inner namespace
 SyncLogger::SyncLogger(std::string logger_name)
     : logger_name_(std::move(logger_name))
     , current_log_level_(LogLevel::eInfo)
-    , flush_level_(LogLevel::eError) {}
+    , flush_level_(LogLevel::eError) {
+    LogCrashHandler::registerLogger(this);
+}
 
-SyncLogger::~SyncLogger() {}
+SyncLogger::~SyncLogger() {
+    LogCrashHandler::unregisterLogger(this);
+}
 
 void SyncLogger::addLogSink(std::unique_ptr<ILogSink> log_sink) {
     log_sinks_.push_back(std::move(log_sink));
@@ -30,19 +47,19 @@ const std::vector<std::unique_ptr<ILogSink>>& SyncLogger::getLogSinks() const {
 }
 
 void SyncLogger::setCurrentLogLevel(LogLevel level) {
-    current_log_level_ = level;
+    current_log_level_.store(level, std::memory_order_relaxed);
 }
 
 LogLevel SyncLogger::getCurrentLogLevel() const {
-    return current_log_level_;
+    return current_log_level_.load(std::memory_order_relaxed);
 }
 
 void SyncLogger::setFlushLevel(LogLevel level) {
-    flush_level_ = level;
+    flush_level_.store(level, std::memory_order_relaxed);
 }
 
 LogLevel SyncLogger::getFlushLevel() const {
-    return flush_level_;
+    return flush_level_.load(std::memory_order_relaxed);
 }
 
 void SyncLogger::log(const std::string& category_name,
@@ -52,24 +69,123 @@ void SyncLogger::log(const std::string& category_name,
                      const std::string& file,
                      const std::string& function,
                      uint32_t line) {
-    if (level >= current_log_level_) {
-        std::lock_guard<std::mutex> lock(mutex_);
+    if (level >= current_log_level_.load(std::memory_order_relaxed)) {
+        counters_.countAccepted(level);
+        OwnerLock lock(*this);
+        writeToSinks(category_name, level, time_stamp_type, message, file, function, line);
+    } else {
+        counters_.countFiltered(level);
+    }
+}
+
+void SyncLogger::log(const LogRecord& record) {
+    if (record.force || record.level >= current_log_level_.load(std::memory_order_relaxed)) {
+        counters_.countAccepted(record.level);
+        OwnerLock lock(*this);
+        record_buffer_.assign(record);
+        writeToSinks(record_buffer_.category,
+                     record_buffer_.level,
+                     record_buffer_.time_stamp_type,
+                     record_buffer_.message,
+                     record_buffer_.file,
+                     record_buffer_.function,
+                     record_buffer_.line);
+    } else {
+        counters_.countFiltered(record.level);
+    }
+}
+
+void SyncLogger::writeToSinks(const std::string& category_name,
+                              LogLevel level,
+                              TimeStampType time_stamp_type,
+                              const std::string& message,
+                              const std::string& file,
+                              const std::string& function,
+                              uint32_t line) {
+    for (auto& sink : log_sinks_) {
+        sink->log(category_name, level, time_stamp_type, message, file, function, line);
+    }
+    if (level >= flush_level_.load(std::memory_order_relaxed)) {
+        auto start = std::chrono::steady_clock::now();
         for (auto& sink : log_sinks_) {
-            sink->log(category_name, level, time_stamp_type, message, file, function, line);
-        }
-        if (level >= flush_level_) {
-            for (auto& sink : log_sinks_) {
-                sink->flush();
-            }
+            sink->flush();
         }
+        counters_.countFlush(elapsedNs(start));
     }
 }
 
+void SyncLogger::trace(const TraceEvent& event) {
+    OwnerLock lock(*this);
+    for (auto& sink : log_sinks_) {
+        sink->logTraceEvent(event);
+    }
+}
+
+void SyncLogger::setTracingEnabled(bool enabled) {
+    tracing_enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool SyncLogger::isTracingEnabled() const {
+    return tracing_enabled_.load(std::memory_order_relaxed);
+}
+
 void SyncLogger::flush() {
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto start = std::chrono::steady_clock::now();
+    OwnerLock lock(*this);
     for (auto& sink : log_sinks_) {
         sink->flush();
     }
+    counters_.countFlush(elapsedNs(start));
+}
+
+void SyncLogger::reopenSinks() {
+    OwnerLock lock(*this);
+    for (auto& sink : log_sinks_) {
+        sink->reopen();
+    }
+}
+
+bool SyncLogger::drainOnCrash(std::chrono::steady_clock::time_point deadline) {
+    // The handler runs on the crashed thread; if it crashed inside a write, it holds the mutex already
+    // and locking it again is undefined
+    if (owner_.load(std::memory_order_relaxed) == std::this_thread::get_id()) {
+        return false;
+    }
+    // Another thread may hold the mutex; only wait until the deadline for it
+    while (!mutex_.try_lock()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::lock_guard<std::mutex> lock(mutex_, std::adopt_lock);
+    bool drained = true;
+    for (auto& sink : log_sinks_) {
+        drained = sink->drainOnCrash(deadline) && drained;
+    }
+    return drained;
+}
+
+void SyncLogger::countFiltered(LogLevel level) {
+    counters_.countFiltered(level);
+}
+
+LoggerStats SyncLogger::getStats() const {
+    LoggerStats stats;
+    stats.name = logger_name_;
+    stats.async = false;
+    counters_.snapshot(stats);
+    for (const auto& sink : log_sinks_) {
+        stats.sinks.push_back(sink->getStats());
+    }
+    return stats;
+}
+
+void SyncLogger::resetStats() {
+    counters_.reset();
+    for (auto& sink : log_sinks_) {
+        sink->resetStats();
+    }
 }
 
 std::string SyncLogger::getName() const {
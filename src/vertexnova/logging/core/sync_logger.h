@@ -12,7 +12,9 @@
 
 #include "logger.h"
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace vne::log {
@@ -87,11 +89,55 @@ class SyncLogger : public ILogger {
              const std::string& function,
              uint32_t line) override;
 
+    /**
+     * @brief Logs a message whose text fields are views into caller-owned storage.
+     *
+     * The fields are copied into a reusable buffer under the logger's mutex before the
+     * sinks are called, so steady-state logging does not allocate in the logger itself.
+     *
+     * @param record The message to log.
+     */
+    void log(const LogRecord& record) override;
+
+    /**
+     * @brief Passes a trace span event to every sink.
+     *
+     * @param event The span event.
+     */
+    void trace(const TraceEvent& event) override;
+
+    /**
+     * @brief Enables or disables recording of trace spans.
+     *
+     * @param enabled True to record VNE_TRACE_* spans.
+     */
+    void setTracingEnabled(bool enabled) override;
+
+    /**
+     * @brief Returns whether trace spans are recorded.
+     *
+     * @return True if tracing is enabled.
+     */
+    [[nodiscard]] bool isTracingEnabled() const override;
+
     /**
      * @brief Flushes all loggers.
      */
     void flush() override;
 
+    /**
+     * @brief Reopens the output of every sink once the messages logged before the call are written.
+     */
+    void reopenSinks() override;
+
+    /**
+     * @brief Writes out pending messages and flushes the sinks while the process is crashing.
+     *
+     * @param deadline When to give up.
+     * @return True if everything was written before the deadline.
+     */
+    bool drainOnCrash(std::chrono::steady_clock::time_point deadline) override;
+
     /**
      * @brief Retrieves the name of the logger.
      *
@@ -124,12 +170,72 @@ class SyncLogger : public ILogger {
      */
     [[nodiscard]] LogLevel getFlushLevel() const override;
 
+    /**
+     * @brief Records a message that was discarded by the level filter before reaching log().
+     *
+     * @param level The log level of the discarded message.
+     */
+    void countFiltered(LogLevel level) override;
+
+    /**
+     * @brief Returns a snapshot of the logger's runtime counters and those of its sinks.
+     *
+     * @return The logger statistics.
+     */
+    [[nodiscard]] LoggerStats getStats() const override;
+
+    /**
+     * @brief Resets the logger's runtime counters and those of its sinks to zero.
+     */
+    void resetStats() override;
+
+   private:
+    /**
+     * @brief Holds mutex_ and records the holding thread in owner_, for drainOnCrash().
+     */
+    class OwnerLock {
+       public:
+        explicit OwnerLock(SyncLogger& logger)
+            : logger_(logger) {
+            logger_.mutex_.lock();
+            logger_.owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        }
+
+        ~OwnerLock() {
+            logger_.owner_.store(std::thread::id(), std::memory_order_relaxed);
+            logger_.mutex_.unlock();
+        }
+
+        OwnerLock(const OwnerLock&) = delete;
+        OwnerLock& operator=(const OwnerLock&) = delete;
+
+       private:
+        SyncLogger& logger_;
+    };
+
+    /**
+     * @brief Passes a message to every sink and flushes them if it reaches the flush level.
+     *
+     * Must be called with mutex_ held.
+     */
+    void writeToSinks(const std::string& category_name,
+                      LogLevel level,
+                      TimeStampType time_stamp_type,
+                      const std::string& message,
+                      const std::string& file,
+                      const std::string& function,
+                      uint32_t line);
+
    private:
     std::string logger_name_;                           //!< Name of the logger.
-    LogLevel current_log_level_;                        //!< Current log level.
-    LogLevel flush_level_ = LogLevel::eError;           //!< Flush level (default: ERROR).
+    std::atomic<LogLevel> current_log_level_;           //!< Current log level (changed at runtime without locks).
+    std::atomic<LogLevel> flush_level_;                 //!< Flush level (default: ERROR).
+    std::atomic<bool> tracing_enabled_{false};          //!< Whether trace spans are recorded.
     std::vector<std::unique_ptr<ILogSink>> log_sinks_;  //!< Collection of sinks.
     std::mutex mutex_;                                  //!< Mutex for thread safety.
+    std::atomic<std::thread::id> owner_;                //!< Thread holding mutex_ through OwnerLock, if any.
+    LogRecordBuffer record_buffer_;                     //!< Reusable copy of the current record (guarded by mutex_).
+    LoggerCounters counters_;                           //!< Runtime statistics.
 };
 
 }  // namespace vne::log
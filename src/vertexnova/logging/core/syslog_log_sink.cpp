@@ -0,0 +1,387 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "syslog_log_sink.h"
+#include "log_formatter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32) || defined(VNE_PLATFORM_WEB)
+#define VNE_LOG_SYSLOG_UNSUPPORTED 1
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr const char* kSyslogSocket = "/dev/log";
+constexpr const char* kJournalSocket = "/run/systemd/journal/socket";
+constexpr const char* kStructuredDataId = "vne@32473";  //!< SD-ID; 32473 is the documentation enterprise number.
+constexpr size_t kMaxAppName = 48;                       //!< RFC 5424 APP-NAME limit.
+constexpr size_t kMaxBatch = 64;                         //!< Datagrams handed to one sendmmsg().
+constexpr size_t kDatagramCapacity = 512;                //!< Bytes reserved in each pooled datagram.
+
+/**
+ * @brief Returns the short name of the running program, or "vnelogging".
+ */
+std::string programName() {
+#if defined(__linux__)
+    std::ifstream comm("/proc/self/comm");
+    std::string name;
+    if (std::getline(comm, name) && !name.empty()) {
+        return name;
+    }
+#endif
+    return "vnelogging";
+}
+
+/**
+ * @brief Appends a PARAM-VALUE, escaping '"', '\' and ']' as RFC 5424 requires.
+ */
+void appendParamValue(std::string& out, const std::string& value) {
+    for (char c : value) {
+        if (c == '"' || c == '\\' || c == ']') {
+            out.push_back('\\');
+        }
+        out.push_back(c);
+    }
+}
+
+/**
+ * @brief Appends a journal field; values with a newline use the binary length-prefixed form.
+ */
+void appendJournalField(std::string& out, const char* field, const std::string& value) {
+    out.append(field);
+    if (value.find('\n') == std::string::npos) {
+        out.push_back('=');
+        out.append(value);
+    } else {
+        out.push_back('\n');
+        uint64_t length = value.size();
+        for (int i = 0; i < 8; ++i) {
+            out.push_back(static_cast<char>((length >> (8 * i)) & 0xFF));
+        }
+        out.append(value);
+    }
+    out.push_back('\n');
+}
+
+}  // namespace
+
+#if !defined(VNE_LOG_SYSLOG_UNSUPPORTED) && defined(__linux__)
+#define VNE_LOG_HAS_SENDMMSG 1
+#endif
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+SyslogLogSink::SyslogLogSink(const SyslogSinkOptions& options)
+    : options_(options)
+    , pattern_("%v") {
+    if (options_.socket_path.empty()) {
+        options_.socket_path = options_.protocol == SyslogProtocol::eJournal ? kJournalSocket : kSyslogSocket;
+    }
+    if (options_.identifier.empty()) {
+        options_.identifier = programName();
+    }
+    std::replace(options_.identifier.begin(), options_.identifier.end(), ' ', '_');
+    if (options_.batch_messages == 0) {
+        options_.batch_messages = 1;
+    }
+#ifndef VNE_LOG_SYSLOG_UNSUPPORTED
+    char hostname[256] = {};
+    hostname_ = ::gethostname(hostname, sizeof(hostname) - 1) == 0 && hostname[0] != '\0' ? hostname : "-";
+    pid_ = std::to_string(::getpid());
+#endif
+    connectSocket();
+}
+
+SyslogLogSink::~SyslogLogSink() {
+    sendPending();
+#ifndef VNE_LOG_SYSLOG_UNSUPPORTED
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+#endif
+}
+
+void SyslogLogSink::log(const std::string& name,
+                        LogLevel level,
+                        TimeStampType time_stamp_type,
+                        const std::string& message,
+                        const std::string& file,
+                        const std::string& function,
+                        uint32_t line) {
+    std::string text = LogFormatter::format(name, level, time_stamp_type, message, file, function, line, pattern_);
+    if (pending_count_ - sent_count_ >= options_.max_pending) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (pending_count_ == sent_count_) {
+        pending_count_ = 0;
+        sent_count_ = 0;
+        batch_start_ = now;
+    } else if (pending_count_ == pending_.size() && sent_count_ > 0) {
+        // Reuse the datagrams already sent instead of growing
+        std::rotate(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(sent_count_), pending_.end());
+        pending_count_ -= sent_count_;
+        sent_count_ = 0;
+    }
+    if (pending_count_ == pending_.size()) {
+        pending_.emplace_back();
+        pending_.back().reserve(kDatagramCapacity);
+    }
+    std::string& datagram = pending_[pending_count_++];
+    datagram.clear();
+    if (options_.protocol == SyslogProtocol::eJournal) {
+        formatJournal(datagram, name, level, text, file, function, line);
+    } else {
+        formatSyslog(datagram, name, level, text, file, function, line);
+    }
+    counters_.countFormatted(datagram.size());
+
+    if (pending_count_ - sent_count_ >= options_.batch_messages || now - batch_start_ >= options_.batch_delay) {
+        sendPending();
+        batch_start_ = now;
+    }
+}
+
+void SyslogLogSink::flush() {
+    sendPending();
+    counters_.countFlush();
+}
+
+void SyslogLogSink::reopen() {
+#ifndef VNE_LOG_SYSLOG_UNSUPPORTED
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+#endif
+    connectSocket();
+    sendPending();
+}
+
+void SyslogLogSink::onIdle() {
+    if (pending_count_ > sent_count_) {
+        sendPending();
+        batch_start_ = std::chrono::steady_clock::now();
+    }
+}
+
+std::string SyslogLogSink::getPattern() const {
+    return pattern_;
+}
+
+void SyslogLogSink::setPattern(const std::string& pattern) {
+    pattern_ = pattern;
+}
+
+std::unique_ptr<ILogSink> SyslogLogSink::clone() const {
+    auto sink = std::make_unique<SyslogLogSink>(options_);
+    sink->setPattern(pattern_);
+    return sink;
+}
+
+SinkStats SyslogLogSink::getStats() const {
+    SinkStats stats = counters_.snapshot();
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SyslogLogSink::resetStats() {
+    counters_.reset();
+    dropped_.store(0, std::memory_order_relaxed);
+}
+
+int SyslogLogSink::toSeverity(LogLevel level) {
+    switch (level) {
+        case LogLevel::eTrace:
+        case LogLevel::eDebug:
+            return 7;
+        case LogLevel::eInfo:
+            return 6;
+        case LogLevel::eWarn:
+            return 4;
+        case LogLevel::eError:
+            return 3;
+        case LogLevel::eFatal:
+            return 2;
+        default:
+            return 6;
+    }
+}
+
+bool SyslogLogSink::connectSocket() {
+#ifdef VNE_LOG_SYSLOG_UNSUPPORTED
+    return false;
+#else
+    sockaddr_un address{};
+    if (options_.socket_path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+    if (fd_ < 0) {
+        fd_ = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        ::fcntl(fd_, F_SETFD, FD_CLOEXEC);
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, options_.socket_path.c_str(), options_.socket_path.size() + 1);
+    return ::connect(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+#endif
+}
+
+void SyslogLogSink::formatSyslog(std::string& out,
+                                 const std::string& name,
+                                 LogLevel level,
+                                 const std::string& text,
+                                 const std::string& file,
+                                 const std::string& function,
+                                 uint32_t line) const {
+    const auto now = std::chrono::system_clock::now();
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+    const auto micros =
+        std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count() % 1'000'000;
+    std::tm utc{};
+#ifndef VNE_LOG_SYSLOG_UNSUPPORTED
+    ::gmtime_r(&seconds, &utc);
+#endif
+    char header[96];
+    const int priority = options_.facility * 8 + toSeverity(level);
+    std::snprintf(header,
+                  sizeof(header),
+                  "<%d>1 %04d-%02d-%02dT%02d:%02d:%02d.%06dZ ",
+                  priority,
+                  utc.tm_year + 1900,
+                  utc.tm_mon + 1,
+                  utc.tm_mday,
+                  utc.tm_hour,
+                  utc.tm_min,
+                  utc.tm_sec,
+                  static_cast<int>(micros));
+    out.append(header);
+    out.append(hostname_).push_back(' ');
+    out.append(options_.identifier, 0, kMaxAppName).push_back(' ');
+    out.append(pid_).append(" - [").append(kStructuredDataId);
+    out.append(" category=\"");
+    appendParamValue(out, name);
+    out.append("\" file=\"");
+    appendParamValue(out, file);
+    out.append("\" line=\"").append(std::to_string(line));
+    out.append("\" function=\"");
+    appendParamValue(out, function);
+    out.append("\"] ");
+    out.append(text);
+}
+
+void SyslogLogSink::formatJournal(std::string& out,
+                                  const std::string& name,
+                                  LogLevel level,
+                                  const std::string& text,
+                                  const std::string& file,
+                                  const std::string& function,
+                                  uint32_t line) const {
+    appendJournalField(out, "MESSAGE", text);
+    appendJournalField(out, "PRIORITY", std::to_string(toSeverity(level)));
+    appendJournalField(out, "SYSLOG_FACILITY", std::to_string(options_.facility));
+    appendJournalField(out, "SYSLOG_IDENTIFIER", options_.identifier);
+    appendJournalField(out, "CODE_FILE", file);
+    appendJournalField(out, "CODE_LINE", std::to_string(line));
+    appendJournalField(out, "CODE_FUNC", function);
+    appendJournalField(out, "VNE_CATEGORY", name);
+}
+
+void SyslogLogSink::sendPending() {
+#ifndef VNE_LOG_SYSLOG_UNSUPPORTED
+    bool reconnected = false;
+    while (sent_count_ < pending_count_) {
+        const size_t count = std::min(pending_count_ - sent_count_, kMaxBatch);
+        int sent = 0;
+#ifdef VNE_LOG_HAS_SENDMMSG
+        iovec vectors[kMaxBatch];
+        mmsghdr messages[kMaxBatch] = {};
+        for (size_t i = 0; i < count; ++i) {
+            std::string& datagram = pending_[sent_count_ + i];
+            vectors[i].iov_base = datagram.data();
+            vectors[i].iov_len = datagram.size();
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+        sent = ::sendmmsg(fd_, messages, static_cast<unsigned int>(count), MSG_DONTWAIT | MSG_NOSIGNAL);
+#else
+        for (; static_cast<size_t>(sent) < count; ++sent) {
+            const std::string& datagram = pending_[sent_count_ + sent];
+            if (::send(fd_, datagram.data(), datagram.size(), MSG_DONTWAIT) < 0) {
+                break;
+            }
+        }
+        if (sent == 0) {
+            sent = -1;
+        }
+#endif
+        if (sent > 0) {
+            size_t bytes = 0;
+            for (int i = 0; i < sent; ++i) {
+                bytes += pending_[sent_count_ + static_cast<size_t>(i)].size();
+            }
+            counters_.countBufferWrite(static_cast<size_t>(sent), bytes, true);
+            sent_count_ += static_cast<size_t>(sent);
+            continue;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        bool would_block = errno == EAGAIN || errno == ENOBUFS;
+#if EAGAIN != EWOULDBLOCK
+        would_block = would_block || errno == EWOULDBLOCK;
+#endif
+        if (would_block) {
+            // The daemon's queue is full; the datagrams wait for the next batch
+            return;
+        }
+        if (errno == EMSGSIZE) {
+            // Too large for a datagram; no later attempt will do better
+            counters_.countBufferWrite(0, 0, false);
+            ++sent_count_;
+            continue;
+        }
+        if (!reconnected) {
+            // The daemon may have been restarted and bound a new socket at the same path
+            reconnected = true;
+            if (connectSocket()) {
+                continue;
+            }
+        }
+        // No daemon: discard the batch rather than hold it
+        for (; sent_count_ < pending_count_; ++sent_count_) {
+            counters_.countBufferWrite(0, 0, false);
+        }
+    }
+#else
+    for (; sent_count_ < pending_count_; ++sent_count_) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+#endif
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,198 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_sink.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vne::log {
+
+/**
+ * @enum SyslogProtocol
+ * @brief Which local daemon a SyslogLogSink talks to, and how.
+ */
+enum class SyslogProtocol : uint8_t {
+    eSyslog = 0,  //!< RFC 5424 messages on the syslog socket (/dev/log).
+    eJournal = 1  //!< systemd-journald's native protocol on /run/systemd/journal/socket.
+};
+
+/**
+ * @struct SyslogSinkOptions
+ * @brief Protocol, identity and batching of a SyslogLogSink.
+ */
+struct SyslogSinkOptions {
+    SyslogProtocol protocol = SyslogProtocol::eSyslog;  //!< Message format and default socket.
+    std::string socket_path;                            //!< Datagram socket; empty for the protocol's default.
+    std::string identifier;                             //!< APP-NAME / SYSLOG_IDENTIFIER; empty for the program name.
+    int facility = 1;                                   //!< Syslog facility code; 1 is user, 16..23 are local0..7.
+    size_t batch_messages = 32;                         //!< Send once this many messages are waiting.
+    std::chrono::milliseconds batch_delay{50};          //!< Send a smaller batch once its oldest message is this old.
+    size_t max_pending = 1024;                          //!< Messages held while the daemon is busy; beyond, drop.
+};
+
+/**
+ * @class SyslogLogSink
+ * @brief Writes to the local syslog daemon or to journald over their sockets, without syslog(3).
+ *
+ * syslog(3) makes one system call per message and flattens everything into a
+ * single string. This sink formats the datagrams itself and keeps the
+ * message's category, file, function and line as separate fields:
+ *
+ * - eSyslog sends RFC 5424 messages,
+ *   `<PRI>1 TIMESTAMP HOST APP PID - [vne@32473 category="..." file="..." line="..." function="..."] MSG`.
+ * - eJournal sends journald's native format, with the fields MESSAGE, PRIORITY,
+ *   SYSLOG_FACILITY, SYSLOG_IDENTIFIER, CODE_FILE, CODE_LINE, CODE_FUNC and
+ *   VNE_CATEGORY.
+ *
+ * The message itself is formatted with the sink's pattern, "%v" by default,
+ * since the daemon records the time and the level on its own. Datagrams are
+ * collected and sent with one sendmmsg() per batch on Linux, or one send()
+ * each elsewhere. Under an AsyncLogger a batch also goes out once the queue
+ * runs dry (onIdle()), since batch_delay is only checked when a message
+ * arrives. Sends do not block: while the daemon's queue is full, up to
+ * max_pending messages wait and the rest are dropped and counted in
+ * SinkStats::dropped. If the daemon restarts, the socket is reconnected on the
+ * next batch; a batch that cannot be sent at all counts as write errors.
+ *
+ * Levels map to syslog severities: trace and debug to debug (7), info to
+ * informational (6), warn to warning (4), error to err (3) and fatal to crit (2).
+ * Only POSIX platforms are supported; elsewhere every message is dropped.
+ */
+class SyslogLogSink : public ILogSink {
+   public:
+    /**
+     * @brief Creates the sink and connects to the daemon's socket.
+     *
+     * @param options Protocol, identity and batching.
+     */
+    explicit SyslogLogSink(const SyslogSinkOptions& options = {});
+
+    /**
+     * @brief Sends what is waiting and closes the socket.
+     */
+    ~SyslogLogSink() override;
+
+    /**
+     * @brief Formats the message into a datagram and sends the batch if it is due.
+     */
+    void log(const std::string& name,
+             LogLevel level,
+             TimeStampType time_stamp_type,
+             const std::string& message,
+             const std::string& file,
+             const std::string& function,
+             uint32_t line) override;
+
+    /**
+     * @brief Sends the waiting datagrams that the daemon accepts now.
+     */
+    void flush() override;
+
+    /**
+     * @brief Reconnects to the socket, e.g. after the daemon was restarted.
+     */
+    void reopen() override;
+
+    /**
+     * @brief Sends the waiting datagrams without waiting for batch_delay, as no more messages are queued.
+     */
+    void onIdle() override;
+
+    /**
+     * @brief Gets the current log pattern.
+     */
+    [[nodiscard]] std::string getPattern() const override;
+
+    /**
+     * @brief Sets a new log pattern for the message text.
+     *
+     * @param pattern The new log pattern.
+     */
+    void setPattern(const std::string& pattern) override;
+
+    /**
+     * @brief Returns a sink with the same options and its own socket.
+     */
+    [[nodiscard]] std::unique_ptr<ILogSink> clone() const override;
+
+    /**
+     * @brief Returns the sink's counters; dropped counts the messages beyond max_pending.
+     */
+    [[nodiscard]] SinkStats getStats() const override;
+
+    /**
+     * @brief Resets the sink's counters.
+     */
+    void resetStats() override;
+
+    /**
+     * @brief Returns the options, with the socket path and identifier filled in.
+     */
+    [[nodiscard]] const SyslogSinkOptions& getOptions() const { return options_; }
+
+    /**
+     * @brief Returns the syslog severity (0..7) of a level.
+     */
+    static int toSeverity(LogLevel level);
+
+   private:
+    /**
+     * @brief Connects the datagram socket to the daemon's path.
+     */
+    bool connectSocket();
+
+    /**
+     * @brief Appends an RFC 5424 message to out.
+     */
+    void formatSyslog(std::string& out,
+                      const std::string& name,
+                      LogLevel level,
+                      const std::string& text,
+                      const std::string& file,
+                      const std::string& function,
+                      uint32_t line) const;
+
+    /**
+     * @brief Appends a journald native-protocol entry to out.
+     */
+    void formatJournal(std::string& out,
+                       const std::string& name,
+                       LogLevel level,
+                       const std::string& text,
+                       const std::string& file,
+                       const std::string& function,
+                       uint32_t line) const;
+
+    /**
+     * @brief Sends the waiting datagrams until the daemon stops accepting them.
+     */
+    void sendPending();
+
+   private:
+    SyslogSinkOptions options_;                          //!< Protocol, identity and batching.
+    std::string pattern_;                                //!< The pattern of the message text.
+    std::string hostname_;                               //!< HOSTNAME field of RFC 5424 messages.
+    std::string pid_;                                    //!< PROCID field of RFC 5424 messages.
+    int fd_ = -1;                                        //!< The datagram socket, or -1.
+    std::vector<std::string> pending_;                   //!< Datagrams waiting to be sent; reused.
+    size_t pending_count_ = 0;                           //!< Datagrams in use at the front of pending_.
+    size_t sent_count_ = 0;                              //!< Of those, already sent.
+    std::chrono::steady_clock::time_point batch_start_;  //!< When the oldest waiting datagram was added.
+    std::atomic<uint64_t> dropped_{0};                   //!< Messages beyond max_pending.
+    SinkCounters counters_;                              //!< Runtime statistics.
+};
+
+}  // namespace vne::log
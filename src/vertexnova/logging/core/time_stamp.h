@@ -10,10 +10,10 @@
  * ----------------------------------------------------------------------
  */
 
+#include <atomic>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
-#include <memory>
+#include <ctime>
+#include <string>
 
 namespace vne::log {
 
@@ -61,6 +61,15 @@ class ITimeProvider {
  */
 class TimeProvider : public ITimeProvider {
    public:
+    /**
+     * @brief Get the shared system clock provider.
+     * @return Reference to the process-wide TimeProvider instance.
+     */
+    static const TimeProvider& instance() {
+        static const TimeProvider s_instance;
+        return s_instance;
+    }
+
     [[nodiscard]] std::time_t now() const override {
         return std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
     }
@@ -86,38 +95,85 @@ class TimeProvider : public ITimeProvider {
     }
 };
 
+/**
+ * @brief Returns the slot holding the process-wide time provider.
+ *
+ * Internal helper; use getTimeProvider() and setTimeProvider() instead.
+ *
+ * @return Reference to the atomic pointer to the installed provider.
+ */
+inline std::atomic<const ITimeProvider*>& timeProviderSlot() {
+    static std::atomic<const ITimeProvider*> s_provider{&TimeProvider::instance()};
+    return s_provider;
+}
+
+/**
+ * @brief Get the process-wide time provider.
+ *
+ * Returns the system clock provider unless another one was installed with
+ * setTimeProvider(). The returned reference is cheap to pass around and does
+ * not allocate or touch any reference count.
+ *
+ * @return The currently installed time provider.
+ */
+inline const ITimeProvider& getTimeProvider() {
+    return *timeProviderSlot().load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Install a process-wide time provider.
+ *
+ * The provider is not owned and must outlive every log call made while it is
+ * installed. Passing nullptr restores the default system clock provider.
+ *
+ * @param provider The provider to install, or nullptr for the default.
+ */
+inline void setTimeProvider(const ITimeProvider* provider) {
+    timeProviderSlot().store(provider ? provider : &TimeProvider::instance(), std::memory_order_release);
+}
+
 /**
  * @class TimeStamp
  * @brief Generates timestamps based on the specified type (local or UTC).
  */
 class TimeStamp {
    public:
+    /// Size of a buffer large enough to hold a formatted timestamp and its terminator.
+    static constexpr size_t kBufferSize = 32;
+
     /**
      * @brief Constructor for TimeStamp.
      * @param type The type of timestamp to generate (local or UTC).
-     * @param provider A shared pointer to a ITimeProvider instance.
+     * @param provider The time provider to read the clock from. Defaults to the process-wide provider.
      */
-    TimeStamp(TimeStampType type = TimeStampType::eLocal,
-              std::shared_ptr<ITimeProvider> provider = std::make_shared<TimeProvider>())
+    explicit TimeStamp(TimeStampType type = TimeStampType::eLocal, const ITimeProvider& provider = getTimeProvider())
         : type_(type)
-        , provider_(std::move(provider)) {}
+        , provider_(provider) {}
 
     /**
      * @brief Get the formatted timestamp as a string.
      * @return The formatted timestamp string.
      */
     [[nodiscard]] std::string getTimeStamp() const {
-        auto now_c = provider_->now();
-        std::tm* ptm = (type_ == TimeStampType::eLocal) ? provider_->localTime(&now_c) : provider_->gmTime(&now_c);
+        char buffer[kBufferSize];
+        return std::string(buffer, formatTo(buffer, sizeof(buffer)));
+    }
 
-        std::ostringstream time_stream;
-        time_stream << std::put_time(ptm, "%Y-%m-%d %H:%M:%S");
-        return time_stream.str();
+    /**
+     * @brief Write the formatted timestamp into a caller-provided buffer.
+     * @param buffer Destination buffer, at least kBufferSize bytes for a full timestamp.
+     * @param size The size of the destination buffer.
+     * @return The number of characters written, excluding the terminator.
+     */
+    size_t formatTo(char* buffer, size_t size) const {
+        auto now_c = provider_.now();
+        std::tm* ptm = (type_ == TimeStampType::eLocal) ? provider_.localTime(&now_c) : provider_.gmTime(&now_c);
+        return std::strftime(buffer, size, "%Y-%m-%d %H:%M:%S", ptm);
     }
 
    private:
-    TimeStampType type_;                       //!< The type of timestamp to generate
-    std::shared_ptr<ITimeProvider> provider_;  //!< The time provider instance
+    TimeStampType type_;             //!< The type of timestamp to generate
+    const ITimeProvider& provider_;  //!< The time provider instance
 };
 
 }  // namespace vne::log
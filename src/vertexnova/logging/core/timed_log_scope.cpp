@@ -0,0 +1,35 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "timed_log_scope.h"
+#include "log_stream.h"
+
+#include <iomanip>
+
+namespace {
+
+double toMilliseconds(std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+void TimedLogScope::report(std::chrono::nanoseconds elapsed) const {
+    LogStream(logger_name_, category_, level_, TimeStampType::eLocal, file_, function_, line_)
+        << "Scope took " << std::fixed << std::setprecision(3) << toMilliseconds(elapsed) << " ms (threshold "
+        << toMilliseconds(threshold_) << " ms)";
+}
+
+}  // namespace log
+}  // namespace vne
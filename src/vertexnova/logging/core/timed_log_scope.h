@@ -0,0 +1,88 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_level.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace vne::log {
+
+/**
+ * @class TimedLogScope
+ * @brief Logs the time spent in a scope, but only when it exceeds a threshold.
+ *
+ * Used by VNE_LOG_TIMED_SCOPE_*. A scope that finishes under the threshold
+ * costs two steady-clock reads and a comparison: the logger is not looked up
+ * and no message is built. Slower scopes are logged through LogStream with
+ * the elapsed time and the threshold, at the call site's file, function and line.
+ */
+class TimedLogScope {
+   public:
+    /**
+     * @brief Starts timing.
+     *
+     * @param logger_name The logger that receives the message.
+     * @param category The category for the message.
+     * @param level The level of the message.
+     * @param threshold Scopes that take longer than this are logged.
+     * @param file The file of the call site.
+     * @param function The function of the call site.
+     * @param line The line of the call site.
+     */
+    TimedLogScope(const char* logger_name,
+                  const char* category,
+                  LogLevel level,
+                  std::chrono::nanoseconds threshold,
+                  const char* file,
+                  const char* function,
+                  uint32_t line)
+        : logger_name_(logger_name)
+        , category_(category)
+        , level_(level)
+        , threshold_(threshold)
+        , file_(file)
+        , function_(function)
+        , line_(line)
+        , start_(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Stops timing and logs the elapsed time if it exceeds the threshold.
+     */
+    ~TimedLogScope() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        if (elapsed > threshold_) {
+            report(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+        }
+    }
+
+    TimedLogScope(const TimedLogScope&) = delete;
+    TimedLogScope& operator=(const TimedLogScope&) = delete;
+
+   private:
+    /**
+     * @brief Logs the elapsed time; kept out of line so the fast path stays small.
+     */
+    void report(std::chrono::nanoseconds elapsed) const;
+
+   private:
+    const char* logger_name_;                      //!< The logger that receives the message.
+    const char* category_;                         //!< Category of the message.
+    LogLevel level_;                               //!< Level of the message.
+    std::chrono::nanoseconds threshold_;           //!< Scopes longer than this are logged.
+    const char* file_;                             //!< File of the call site.
+    const char* function_;                         //!< Function of the call site.
+    uint32_t line_;                                //!< Line of the call site.
+    std::chrono::steady_clock::time_point start_;  //!< When the scope was entered.
+};
+
+}  // namespace vne::log
@@ -0,0 +1,66 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @file trace_event.h
+ *
+ * @brief A timing span event recorded by VNE_TRACE_* and passed to sinks.
+ *
+ * Trace events travel through the same loggers, queue and sinks as log
+ * messages but carry a monotonic timestamp and a thread id instead of text.
+ * Names and categories are pointers to strings with static storage duration
+ * (the macros take string literals), so recording an event copies no text.
+ */
+
+namespace vne::log {
+
+/**
+ * @enum TracePhase
+ * @brief Kind of trace event; the values are the Chrome trace-event "ph" codes.
+ */
+enum class TracePhase : char {
+    eBegin = 'B',    //!< Start of a span (VNE_TRACE_BEGIN).
+    eEnd = 'E',      //!< End of a span (VNE_TRACE_END).
+    eComplete = 'X'  //!< Whole span with a duration (VNE_TRACE_SCOPE).
+};
+
+/**
+ * @struct TraceEvent
+ * @brief One span event.
+ */
+struct TraceEvent {
+    const char* name = "";                     //!< Span name; must have static storage duration.
+    const char* category = "";                 //!< Category name; must have static storage duration.
+    TracePhase phase = TracePhase::eComplete;  //!< Event kind.
+    uint64_t timestamp_ns = 0;                 //!< Start time from traceClockNs().
+    uint64_t duration_ns = 0;                  //!< Span length (eComplete only).
+    uint64_t thread_id = 0;                    //!< Recording thread, from traceThreadId().
+};
+
+/**
+ * @brief Returns the monotonic time used for trace events, in nanoseconds.
+ */
+inline uint64_t traceClockNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+/**
+ * @brief Returns a small id for the calling thread, assigned in order of first use.
+ */
+uint64_t traceThreadId();
+
+}  // namespace vne::log
@@ -0,0 +1,59 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "trace_scope.h"
+#include "logger_controller.h"
+
+#include <atomic>
+
+namespace {
+
+std::atomic<uint64_t> g_next_thread_id{1};
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+uint64_t traceThreadId() {
+    thread_local const uint64_t t_thread_id = g_next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return t_thread_id;
+}
+
+TraceScope::TraceScope(const char* logger_name, const char* category, const char* name)
+    : logger_(LoggerController::getLogger(logger_name))
+    , category_(category)
+    , name_(name) {
+    if (logger_ && !logger_->isTracingEnabled()) {
+        logger_.reset();
+    }
+    if (logger_) {
+        start_ns_ = traceClockNs();
+    }
+}
+
+TraceScope::~TraceScope() {
+    if (logger_) {
+        uint64_t end_ns = traceClockNs();
+        logger_->trace(TraceEvent{name_, category_, TracePhase::eComplete, start_ns_, end_ns - start_ns_,
+                                  traceThreadId()});
+    }
+}
+
+void recordTraceEvent(const char* logger_name, const char* category, const char* name, TracePhase phase) {
+    std::shared_ptr<ILogger> logger = LoggerController::getLogger(logger_name);
+    if (logger && logger->isTracingEnabled()) {
+        logger->trace(TraceEvent{name, category, phase, traceClockNs(), 0, traceThreadId()});
+    }
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,70 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "logger.h"
+#include "trace_event.h"
+
+#include <memory>
+
+/**
+ * @file trace_scope.h
+ *
+ * @brief Front end of the VNE_TRACE_* macros.
+ *
+ * A span is recorded only if the named logger exists and has tracing enabled
+ * (ILogger::setTracingEnabled). Otherwise the cost is one logger lookup, the
+ * same as a log call discarded by the level filter.
+ */
+
+namespace vne::log {
+
+/**
+ * @class TraceScope
+ * @brief Records a complete span covering its own lifetime (VNE_TRACE_SCOPE).
+ */
+class TraceScope {
+   public:
+    /**
+     * @brief Starts the span if tracing is enabled on the logger.
+     *
+     * @param logger_name The logger that receives the span.
+     * @param category The category; must have static storage duration.
+     * @param name The span name; must have static storage duration.
+     */
+    TraceScope(const char* logger_name, const char* category, const char* name);
+
+    /**
+     * @brief Ends the span and hands it to the logger.
+     */
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+   private:
+    std::shared_ptr<ILogger> logger_;  //!< Receiving logger, or null when tracing is disabled.
+    const char* category_;             //!< Category name.
+    const char* name_;                 //!< Span name.
+    uint64_t start_ns_ = 0;            //!< Start time from traceClockNs().
+};
+
+/**
+ * @brief Records a begin or end event on the named logger if it has tracing enabled.
+ *
+ * @param logger_name The logger that receives the event.
+ * @param category The category; must have static storage duration.
+ * @param name The span name; must have static storage duration.
+ * @param phase TracePhase::eBegin or TracePhase::eEnd.
+ */
+void recordTraceEvent(const char* logger_name, const char* category, const char* name, TracePhase phase);
+
+}  // namespace vne::log
@@ -0,0 +1,460 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_control_server.h"
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/logger_controller.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32) || defined(VNE_PLATFORM_WEB)
+#define VNE_LOG_CONTROL_UNSUPPORTED 1
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using vne::log::ILogger;
+using vne::log::LoggerController;
+using vne::log::LogLevel;
+
+constexpr size_t kMaxCommandLength = 4096;  //!< Longer commands are rejected.
+constexpr int kClientTimeoutMs = 2000;      //!< How long a client may take to send its command.
+
+std::vector<std::string> splitWords(std::string_view text) {
+    std::vector<std::string> words;
+    std::istringstream stream{std::string(text)};
+    std::string word;
+    while (stream >> word) {
+        words.push_back(word);
+    }
+    return words;
+}
+
+std::string errorReply(const std::string& reason) {
+    return "error: " + reason + "\n";
+}
+
+/**
+ * @brief Returns the named logger, or every registered logger for "*" or an empty name.
+ */
+std::vector<std::shared_ptr<ILogger>> selectLoggers(const std::string& name) {
+    std::vector<std::shared_ptr<ILogger>> loggers;
+    if (name.empty() || name == "*") {
+        for (const std::string& logger_name : LoggerController::getLoggerNames()) {
+            if (auto logger = LoggerController::getLogger(logger_name)) {
+                loggers.push_back(std::move(logger));
+            }
+        }
+    } else if (auto logger = LoggerController::getLogger(name)) {
+        loggers.push_back(std::move(logger));
+    }
+    return loggers;
+}
+
+std::string helpReply() {
+    return "ok\n"
+           "help                            list the commands\n"
+           "list                            loggers with their level, flush level, sinks and mode\n"
+           "level <logger|*> <level>        set a logger's level\n"
+           "category-level <cat> <level>    log a category at a level on every logger\n"
+           "enable <spec> | disable <spec>  switch statements on or off (<file-glob>[:<line>[-<line>]])\n"
+           "reset                           drop all call-site and category rules\n"
+           "flush [logger]                  flush one or all loggers\n"
+           "stats [logger]                  runtime counters of one or all loggers\n"
+           "rotate [logger]                 reopen file sinks after the files were renamed\n"
+           "profile [n]                     the n noisiest statements (profiling is switched on)\n";
+}
+
+std::string listReply() {
+    std::ostringstream out;
+    out << "ok\n";
+    for (const auto& logger : selectLoggers("*")) {
+        const vne::log::LoggerStats stats = logger->getStats();
+        out << logger->getName() << " level=" << logger->getCurrentLogLevel()
+            << " flush=" << logger->getFlushLevel() << " sinks=" << logger->getLogSinks().size()
+            << " mode=" << (stats.hybrid ? "hybrid" : stats.async ? "async" : "sync")
+            << " tracing=" << (logger->isTracingEnabled() ? "on" : "off") << '\n';
+    }
+    return out.str();
+}
+
+std::string statsReply(const std::vector<std::shared_ptr<ILogger>>& loggers) {
+    std::ostringstream out;
+    out << "ok\n";
+    for (const auto& logger : loggers) {
+        const vne::log::LoggerStats stats = logger->getStats();
+        out << stats.name << " accepted=" << stats.totalAccepted() << " filtered=" << stats.totalFiltered()
+            << " dropped=" << stats.totalDropped() << " write_errors=" << stats.totalWriteErrors()
+            << " flushes=" << stats.flush_count;
+        if (stats.async) {
+            out << " queue_depth=" << stats.queue.current_depth << " queue_high_water=" << stats.queue.high_water_depth;
+        }
+        if (stats.pipelined) {
+            out << " pipeline_stalls=" << stats.queue.pipeline_stalls;
+        }
+        out << '\n';
+    }
+    return out.str();
+}
+
+#ifndef VNE_LOG_CONTROL_UNSUPPORTED
+
+bool fillAddress(const std::string& path, sockaddr_un& address) {
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+void closeFd(int& fd) {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+/**
+ * @brief Writes all of data, without raising SIGPIPE if the peer has gone.
+ */
+bool sendAll(int fd, std::string_view data) {
+#ifdef MSG_NOSIGNAL
+    constexpr int kFlags = MSG_NOSIGNAL;
+#else
+    constexpr int kFlags = 0;
+#endif
+    while (!data.empty()) {
+        ssize_t sent = ::send(fd, data.data(), data.size(), kFlags);
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(sent));
+    }
+    return true;
+}
+
+#endif  // VNE_LOG_CONTROL_UNSUPPORTED
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+LogControlServer::~LogControlServer() {
+    stop();
+}
+
+bool LogControlServer::isSupported() {
+#ifdef VNE_LOG_CONTROL_UNSUPPORTED
+    return false;
+#else
+    return true;
+#endif
+}
+
+std::string LogControlServer::defaultSocketPath(long pid) {
+#ifdef VNE_LOG_CONTROL_UNSUPPORTED
+    (void)pid;
+    return "";
+#else
+    const char* tmp_dir = std::getenv("TMPDIR");
+    std::string path = (tmp_dir && *tmp_dir) ? tmp_dir : "/tmp";
+    if (path.back() != '/') {
+        path += '/';
+    }
+    path += "vnelogging-";
+    path += std::to_string(pid ? pid : static_cast<long>(::getpid()));
+    path += ".sock";
+    return path;
+#endif
+}
+
+std::string LogControlServer::getSocketPath() const {
+    return isRunning() ? socket_path_ : std::string();
+}
+
+std::string LogControlServer::execute(std::string_view command) {
+    const std::vector<std::string> words = splitWords(command);
+    if (words.empty()) {
+        return errorReply("empty command");
+    }
+    const std::string& verb = words[0];
+    const std::string argument = words.size() > 1 ? words[1] : std::string();
+
+    if (verb == "help") {
+        return helpReply();
+    }
+    if (verb == "list") {
+        return listReply();
+    }
+    if (verb == "level" || verb == "category-level") {
+        LogLevel level;
+        if (words.size() != 3) {
+            return errorReply("usage: " + verb + " <name> <level>");
+        }
+        if (!parseLogLevel(words[2], level)) {
+            return errorReply("unknown level '" + words[2] + "'");
+        }
+        if (verb == "category-level") {
+            size_t matched = Logging::setCategoryLevel(argument, level);
+            return "ok\n" + std::to_string(matched) + " statements seen so far\n";
+        }
+        auto loggers = selectLoggers(argument);
+        if (loggers.empty()) {
+            return errorReply("no logger '" + argument + "'");
+        }
+        for (const auto& logger : loggers) {
+            logger->setCurrentLogLevel(level);
+        }
+        return "ok\n";
+    }
+    if (verb == "enable" || verb == "disable") {
+        if (words.size() != 2) {
+            return errorReply("usage: " + verb + " <file-glob>[:<line>[-<line>]]");
+        }
+        size_t matched = verb == "enable" ? Logging::enableCallSites(argument) : Logging::disableCallSites(argument);
+        return "ok\n" + std::to_string(matched) + " statements matched\n";
+    }
+    if (verb == "reset") {
+        Logging::resetCallSites();
+        return "ok\n";
+    }
+    if (verb == "flush" || verb == "stats" || verb == "rotate") {
+        auto loggers = selectLoggers(argument);
+        if (loggers.empty() && !argument.empty()) {
+            return errorReply("no logger '" + argument + "'");
+        }
+        if (verb == "stats") {
+            return statsReply(loggers);
+        }
+        for (const auto& logger : loggers) {
+            if (verb == "flush") {
+                logger->flush();
+            } else {
+                logger->reopenSinks();
+            }
+        }
+        return "ok\n";
+    }
+    if (verb == "profile") {
+        size_t top_n = 10;
+        if (!argument.empty()) {
+            char* end = nullptr;
+            top_n = static_cast<size_t>(std::strtoul(argument.c_str(), &end, 10));
+            if (*end != '\0' || top_n == 0) {
+                return errorReply("usage: profile [n]");
+            }
+        }
+        // Profiling is off by default; the first call switches it on so that later calls have data
+        Logging::setLogProfilingEnabled(true);
+        std::ostringstream out;
+        out << "ok\n";
+        Logging::dumpLogProfile(out, top_n);
+        return out.str();
+    }
+    return errorReply("unknown command '" + verb + "', try 'help'");
+}
+
+#ifdef VNE_LOG_CONTROL_UNSUPPORTED
+
+bool LogControlServer::start(const std::string& /*socket_path*/) {
+    return false;
+}
+
+void LogControlServer::stop() {}
+
+void LogControlServer::run() {}
+
+void LogControlServer::serve(int /*client_fd*/) {}
+
+bool LogControlServer::sendCommand(const std::string& /*socket_path*/,
+                                   std::string_view /*command*/,
+                                   std::string& reply) {
+    reply = "Unix domain sockets are not supported on this platform";
+    return false;
+}
+
+#else
+
+bool LogControlServer::start(const std::string& socket_path) {
+    if (isRunning()) {
+        return false;
+    }
+    // Reaps a server whose loop ended on a poll error, so that thread_ can be reused
+    stop();
+    socket_path_ = socket_path.empty() ? defaultSocketPath() : socket_path;
+    sockaddr_un address;
+    if (!fillAddress(socket_path_, address)) {
+        std::cerr << "[ERROR] : Invalid control socket path " << socket_path_ << std::endl;
+        return false;
+    }
+
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd_ < 0 || ::pipe(wake_fds_) != 0) {
+        std::cerr << "[ERROR] : Couldn't create control socket: " << std::strerror(errno) << std::endl;
+        closeFd(listen_fd_);
+        return false;
+    }
+    ::fcntl(listen_fd_, F_SETFD, FD_CLOEXEC);
+    ::fcntl(wake_fds_[0], F_SETFD, FD_CLOEXEC);
+    ::fcntl(wake_fds_[1], F_SETFD, FD_CLOEXEC);
+
+    // Replaces a socket left behind by an earlier run, but nothing else
+    struct stat existing;
+    if (::lstat(socket_path_.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            std::cerr << "[ERROR] : Won't replace " << socket_path_ << ": it is not a socket" << std::endl;
+            closeFd(listen_fd_);
+            closeFd(wake_fds_[0]);
+            closeFd(wake_fds_[1]);
+            return false;
+        }
+        ::unlink(socket_path_.c_str());
+    }
+    // Owner-only access: the commands change the process's logging. chmod rather than umask, which
+    // would also apply to files other threads create meanwhile
+    if (::bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+        || ::chmod(socket_path_.c_str(), S_IRUSR | S_IWUSR) != 0 || ::listen(listen_fd_, 4) != 0) {
+        std::cerr << "[ERROR] : Couldn't listen on " << socket_path_ << ": " << std::strerror(errno) << std::endl;
+        closeFd(listen_fd_);
+        closeFd(wake_fds_[0]);
+        closeFd(wake_fds_[1]);
+        return false;
+    }
+
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&LogControlServer::run, this);
+    return true;
+}
+
+void LogControlServer::stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    const char wake = 'x';
+    [[maybe_unused]] ssize_t written = ::write(wake_fds_[1], &wake, 1);
+    thread_.join();
+    closeFd(listen_fd_);
+    closeFd(wake_fds_[0]);
+    closeFd(wake_fds_[1]);
+    ::unlink(socket_path_.c_str());
+}
+
+void LogControlServer::run() {
+    pollfd fds[2] = {{listen_fd_, POLLIN, 0}, {wake_fds_[0], POLLIN, 0}};
+    while (true) {
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[1].revents != 0) {
+            break;
+        }
+        if (fds[0].revents & POLLIN) {
+            int client_fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (client_fd >= 0) {
+                serve(client_fd);
+                ::close(client_fd);
+            }
+        }
+    }
+    running_.store(false, std::memory_order_release);
+}
+
+void LogControlServer::serve(int client_fd) {
+    std::string command;
+    char chunk[256];
+    pollfd fds[2] = {{client_fd, POLLIN, 0}, {wake_fds_[0], POLLIN, 0}};
+    while (command.find('\n') == std::string::npos && command.size() <= kMaxCommandLength) {
+        int ready = ::poll(fds, 2, kClientTimeoutMs);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0 || fds[1].revents != 0) {
+            return;
+        }
+        ssize_t received = ::recv(client_fd, chunk, sizeof(chunk), 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            break;
+        }
+        command.append(chunk, static_cast<size_t>(received));
+    }
+    if (command.size() > kMaxCommandLength) {
+        sendAll(client_fd, errorReply("command too long"));
+        return;
+    }
+    command = command.substr(0, command.find('\n'));
+    sendAll(client_fd, execute(command));
+}
+
+bool LogControlServer::sendCommand(const std::string& socket_path, std::string_view command, std::string& reply) {
+    reply.clear();
+    sockaddr_un address;
+    if (!fillAddress(socket_path, address)) {
+        reply = "invalid socket path '" + socket_path + "'";
+        return false;
+    }
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        reply = "couldn't connect to " + socket_path + ": " + std::strerror(errno);
+        closeFd(fd);
+        return false;
+    }
+    std::string line(command);
+    line += '\n';
+    if (!sendAll(fd, line)) {
+        reply = "couldn't send the command: " + std::string(std::strerror(errno));
+        closeFd(fd);
+        return false;
+    }
+    char chunk[4096];
+    ssize_t received = 0;
+    while ((received = ::recv(fd, chunk, sizeof(chunk), 0)) != 0) {
+        if (received < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            reply = "couldn't read the reply: " + std::string(std::strerror(errno));
+            closeFd(fd);
+            return false;
+        }
+        reply.append(chunk, static_cast<size_t>(received));
+    }
+    closeFd(fd);
+    return true;
+}
+
+#endif  // VNE_LOG_CONTROL_UNSUPPORTED
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,133 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace vne::log {
+
+/**
+ * @class LogControlServer
+ * @brief Accepts text commands on a Unix domain socket to reconfigure logging in a live process.
+ *
+ * A background thread accepts one connection at a time, reads a single
+ * command line, runs it and writes the reply before closing the connection.
+ * The reply starts with "ok" or "error: <reason>" on its own line; any
+ * further lines are the command's output. The vnelogctl tool is a client.
+ *
+ * Commands (logger names and specs contain no spaces):
+ *   help                          list the commands
+ *   list                          loggers with their level, flush level, sinks and mode
+ *   level <logger|*> <level>      set a logger's level
+ *   category-level <cat> <level>  log a category at a level (see Logging::setCategoryLevel)
+ *   enable <spec> / disable <spec>  switch log statements on or off (see Logging::enableCallSites)
+ *   reset                         drop all call-site and category rules
+ *   flush [logger]                flush one or all loggers
+ *   stats [logger]                runtime counters of one or all loggers
+ *   rotate [logger]               reopen file sinks, e.g. after logrotate renamed the files
+ *   profile [n]                   the n noisiest statements (see Logging::dumpLogProfile)
+ *
+ * Loggers are found through LoggerController, and levels are atomics, so
+ * commands never block the threads that log. The socket is created with
+ * owner-only permissions. Only POSIX platforms are supported; elsewhere
+ * start() returns false.
+ */
+class LogControlServer {
+   public:
+    LogControlServer() = default;
+
+    /**
+     * @brief Stops the server and removes the socket.
+     */
+    ~LogControlServer();
+
+    LogControlServer(const LogControlServer&) = delete;
+    LogControlServer& operator=(const LogControlServer&) = delete;
+
+    /**
+     * @brief Creates the socket and starts the server thread.
+     *
+     * A socket left at the path (e.g. by a crashed process) is replaced; any other file is left alone and
+     * start() fails.
+     *
+     * @param socket_path The socket path; empty for defaultSocketPath() of this process.
+     * @return True if the server is listening.
+     */
+    bool start(const std::string& socket_path = "");
+
+    /**
+     * @brief Stops the server thread and removes the socket. Safe to call when not running.
+     */
+    void stop();
+
+    /**
+     * @brief Returns whether the server thread is running.
+     */
+    [[nodiscard]] bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Returns the path the server listens on, or an empty string if it is not running.
+     */
+    [[nodiscard]] std::string getSocketPath() const;
+
+    /**
+     * @brief Returns whether this platform has Unix domain sockets.
+     */
+    static bool isSupported();
+
+    /**
+     * @brief Returns the default socket path of a process: `$TMPDIR/vnelogging-<pid>.sock` (or /tmp).
+     *
+     * @param pid The process id; 0 for the calling process.
+     */
+    static std::string defaultSocketPath(long pid = 0);
+
+    /**
+     * @brief Runs one command in this process and returns the reply, as the server would send it.
+     *
+     * @param command The command line (without the trailing newline).
+     * @return The reply, starting with "ok\n" or "error: ...\n".
+     */
+    static std::string execute(std::string_view command);
+
+    /**
+     * @brief Sends one command to a server and reads its reply.
+     *
+     * @param socket_path The server's socket path.
+     * @param command The command line.
+     * @param reply Receives the reply, or a description of the connection error.
+     * @return True if a reply was received.
+     */
+    static bool sendCommand(const std::string& socket_path, std::string_view command, std::string& reply);
+
+   private:
+    /**
+     * @brief Accepts and serves connections until stop() is called.
+     */
+    void run();
+
+    /**
+     * @brief Reads one command from a connection, runs it and writes the reply.
+     */
+    void serve(int client_fd);
+
+   private:
+    std::string socket_path_;           //!< Path of the listening socket.
+    int listen_fd_ = -1;                //!< Listening socket.
+    int wake_fds_[2] = {-1, -1};        //!< Pipe written by stop() to wake the server thread.
+    std::thread thread_;                //!< Server thread.
+    std::atomic<bool> running_{false};  //!< Whether the server thread is running.
+};
+
+}  // namespace vne::log
@@ -14,6 +14,29 @@
 #include "vertexnova/logging/core/async_logger.h"
 #include "vertexnova/logging/core/logger_controller.h"
 
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Returns the sink as a SinkType, looking through isolating and deduplicating wrappers; nullptr if another type.
+ */
+template <typename SinkType>
+SinkType* sinkAs(vne::log::ILogSink* sink) {
+    // The wrappers may be stacked either way round
+    while (true) {
+        if (auto isolated = dynamic_cast<vne::log::IsolatedLogSink*>(sink)) {
+            sink = &isolated->getWrappedSink();
+        } else if (auto deduplicating = dynamic_cast<vne::log::DeduplicatingLogSink*>(sink)) {
+            sink = &deduplicating->getWrappedSink();
+        } else {
+            return dynamic_cast<SinkType*>(sink);
+        }
+    }
+}
+
+}  // namespace
+
 namespace vne {
 namespace log {
 
@@ -36,6 +59,17 @@ std::shared_ptr<ILogger> LogManager::createLogger(const std::string& logger_name
     return logger;
 }
 
+std::shared_ptr<ILogger> LogManager::createLogger(const std::string& logger_name,
+                                                  LoggerMode mode,
+                                                  LogLevel sync_level) {
+    bool created = loggers_.find(logger_name) == loggers_.end();
+    auto logger = createLogger(logger_name, mode != LoggerMode::eSync);
+    if (created && mode == LoggerMode::eHybrid) {
+        setSyncLevel(logger_name, sync_level);
+    }
+    return logger;
+}
+
 bool LogManager::isLoggerAsync(const std::string& logger_name) const {
     auto it = logger_async_state_.find(logger_name);
     if (it != logger_async_state_.end()) {
@@ -44,6 +78,14 @@ bool LogManager::isLoggerAsync(const std::string& logger_name) const {
     return false;  // Default to sync if logger doesn't exist
 }
 
+LoggerMode LogManager::getLoggerMode(const std::string& logger_name) const {
+    auto logger = getLogger(logger_name);
+    if (auto async_logger = dynamic_cast<AsyncLogger*>(logger.get())) {
+        return async_logger->isHybrid() ? LoggerMode::eHybrid : LoggerMode::eAsync;
+    }
+    return LoggerMode::eSync;
+}
+
 std::shared_ptr<ILogger> LogManager::getLogger(const std::string& logger_name) const {
     auto it = loggers_.find(logger_name);
     if (it != loggers_.end()) {
@@ -68,11 +110,42 @@ void LogManager::addFileSink(const std::string& logger_name, const std::string&
     }
 }
 
+void LogManager::addConsoleSink(const std::string& logger_name, const SinkBufferOptions& buffer) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        logger->addLogSink(std::make_unique<IsolatedLogSink>(std::make_unique<ConsoleLogSink>(), buffer));
+    }
+}
+
+void LogManager::addFileSink(const std::string& logger_name,
+                             const std::string& log_file_path,
+                             const SinkBufferOptions& buffer) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        logger->addLogSink(std::make_unique<IsolatedLogSink>(std::make_unique<FileLogSink>(log_file_path), buffer));
+    }
+}
+
+void LogManager::addFileSink(const std::string& logger_name,
+                             const std::string& log_file_path,
+                             std::chrono::milliseconds duplicate_window) {
+    addDeduplicatedSink(logger_name, std::make_unique<FileLogSink>(log_file_path), duplicate_window);
+}
+
+void LogManager::addDeduplicatedSink(const std::string& logger_name,
+                                     std::unique_ptr<ILogSink> sink,
+                                     std::chrono::milliseconds duplicate_window) {
+    auto logger = getLogger(logger_name);
+    if (logger && sink) {
+        logger->addLogSink(std::make_unique<DeduplicatingLogSink>(std::move(sink), duplicate_window));
+    }
+}
+
 void LogManager::setConsolePattern(const std::string& logger_name, const std::string& pattern) {
     auto logger = getLogger(logger_name);
     if (logger) {
         for (auto& sink : logger->getLogSinks()) {
-            auto console_sink = dynamic_cast<ConsoleLogSink*>(sink.get());
+            auto console_sink = sinkAs<ConsoleLogSink>(sink.get());
             if (console_sink) {
                 console_sink->setPattern(pattern);
             }
@@ -84,7 +157,7 @@ void LogManager::setFilePattern(const std::string& logger_name, const std::strin
     auto logger = getLogger(logger_name);
     if (logger) {
         for (auto& sink : logger->getLogSinks()) {
-            auto file_sink = dynamic_cast<FileLogSink*>(sink.get());
+            auto file_sink = sinkAs<FileLogSink>(sink.get());
             if (file_sink) {
                 file_sink->setPattern(pattern);
             }
@@ -106,6 +179,103 @@ void LogManager::setFlushLevel(const std::string& logger_name, LogLevel level) {
     }
 }
 
+void LogManager::addChromeTraceSink(const std::string& logger_name, const std::string& trace_file_path) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        logger->addLogSink(std::make_unique<ChromeTraceSink>(trace_file_path));
+        logger->setTracingEnabled(true);
+    }
+}
+
+void LogManager::addSharedMemorySink(const std::string& logger_name, const std::string& segment_name) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        logger->addLogSink(std::make_unique<SharedMemoryLogSink>(segment_name));
+    }
+}
+
+void LogManager::addSocketSink(const std::string& logger_name,
+                               const std::string& endpoint,
+                               const SocketSinkOptions& options) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        logger->addLogSink(std::make_unique<SocketLogSink>(endpoint, options));
+    }
+}
+
+void LogManager::addSyslogSink(const std::string& logger_name, const SyslogSinkOptions& options) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        logger->addLogSink(std::make_unique<SyslogLogSink>(options));
+    }
+}
+
+void LogManager::addRoutingSink(const std::string& logger_name,
+                                const std::vector<LogRoute>& routes,
+                                size_t max_open_fds) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        auto routing_sink = std::make_unique<RoutingLogSink>(max_open_fds);
+        for (const LogRoute& route : routes) {
+            routing_sink->addRoute(route);
+        }
+        logger->addLogSink(std::move(routing_sink));
+    }
+}
+
+void LogManager::setTracingEnabled(const std::string& logger_name, bool enabled) {
+    auto logger = getLogger(logger_name);
+    if (logger) {
+        logger->setTracingEnabled(enabled);
+    }
+}
+
+void LogManager::setPriorityLane(const std::string& logger_name, LogLevel level, LaneOrder order) {
+    auto logger = getLogger(logger_name);
+    if (auto async_logger = dynamic_cast<AsyncLogger*>(logger.get())) {
+        async_logger->setPriorityLane(level, order);
+    }
+}
+
+void LogManager::disablePriorityLane(const std::string& logger_name) {
+    auto logger = getLogger(logger_name);
+    if (auto async_logger = dynamic_cast<AsyncLogger*>(logger.get())) {
+        async_logger->disablePriorityLane();
+    }
+}
+
+void LogManager::setSyncLevel(const std::string& logger_name, LogLevel level) {
+    auto logger = getLogger(logger_name);
+    if (auto async_logger = dynamic_cast<AsyncLogger*>(logger.get())) {
+        async_logger->setSyncLevel(level);
+    }
+}
+
+void LogManager::setPipelined(const std::string& logger_name, bool enabled, size_t formatter_threads) {
+    auto logger = getLogger(logger_name);
+    if (auto async_logger = dynamic_cast<AsyncLogger*>(logger.get())) {
+        async_logger->setPipelined(enabled, formatter_threads);
+    }
+}
+
+LoggingStats LogManager::getStats() const {
+    LoggingStats stats;
+    stats.loggers.reserve(loggers_.size());
+    for (const auto& logger_pair : loggers_) {
+        stats.loggers.push_back(logger_pair.second->getStats());
+    }
+    std::sort(stats.loggers.begin(), stats.loggers.end(), [](const LoggerStats& lhs, const LoggerStats& rhs) {
+        return lhs.name < rhs.name;
+    });
+    return stats;
+}
+
+void LogManager::resetStats() {
+    for (const auto& logger_pair : loggers_) {
+        logger_pair.second->resetStats();
+    }
+}
+
 void LogManager::finalize() {
     // Unregister all loggers
     for (const auto& logger_pair : loggers_) {
@@ -14,13 +14,35 @@
 #include "vertexnova/logging/core/log_level.h"
 #include "vertexnova/logging/core/console_log_sink.h"
 #include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/chrome_trace_sink.h"
+#include "vertexnova/logging/core/isolated_log_sink.h"
+#include "vertexnova/logging/core/shared_memory_log_sink.h"
+#include "vertexnova/logging/core/socket_log_sink.h"
+#include "vertexnova/logging/core/syslog_log_sink.h"
+#include "vertexnova/logging/core/routing_log_sink.h"
+#include "vertexnova/logging/core/deduplicating_log_sink.h"
+#include "vertexnova/logging/core/log_stats.h"
+#include "vertexnova/logging/core/log_queue.h"
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace vne::log {
 
+/**
+ * @enum LoggerMode
+ * @brief How a logger hands messages to its sinks.
+ */
+enum class LoggerMode : uint8_t {
+    eSync = 0,   //!< Every message is written on the calling thread (SyncLogger).
+    eAsync = 1,  //!< Every message is queued and written by a worker thread (AsyncLogger).
+    eHybrid = 2  //!< Severe messages are written synchronously in queue order, the rest asynchronously.
+};
+
 /**
  * @class LogManager
  * @brief Manages logging configuration and provides logger instances.
@@ -57,6 +79,20 @@ class LogManager final {
      */
     std::shared_ptr<ILogger> createLogger(const std::string& logger_name, bool async = false);
 
+    /**
+     * @brief Creates or retrieves a logger instance with a specified name and mode.
+     *
+     * A hybrid logger is an AsyncLogger with a sync level (see AsyncLogger::setSyncLevel).
+     *
+     * @param logger_name The name of the logger to create or retrieve.
+     * @param mode The mode of a newly created logger.
+     * @param sync_level In hybrid mode, the lowest level written synchronously.
+     * @return A shared pointer to the created or retrieved logger.
+     */
+    std::shared_ptr<ILogger> createLogger(const std::string& logger_name,
+                                          LoggerMode mode,
+                                          LogLevel sync_level = LogLevel::eError);
+
     /**
      * @brief Retrieves a logger instance by name.
      *
@@ -73,6 +109,14 @@ class LogManager final {
      */
     void addConsoleSink(const std::string& logger_name);
 
+    /**
+     * @brief Adds a console sink that writes on its own worker thread (see IsolatedLogSink).
+     *
+     * @param logger_name The name of the logger to which the console sink should be added.
+     * @param buffer The size and overflow policy of the sink's buffer.
+     */
+    void addConsoleSink(const std::string& logger_name, const SinkBufferOptions& buffer);
+
     /**
      * @brief Adds a file sink to a logger.
      *
@@ -81,6 +125,37 @@ class LogManager final {
      */
     void addFileSink(const std::string& logger_name, const std::string& log_file_path);
 
+    /**
+     * @brief Adds a file sink that writes on its own worker thread (see IsolatedLogSink).
+     *
+     * @param logger_name The name of the logger to which the file sink should be added.
+     * @param log_file_path The path where the log file should be created.
+     * @param buffer The size and overflow policy of the sink's buffer.
+     */
+    void addFileSink(const std::string& logger_name, const std::string& log_file_path, const SinkBufferOptions& buffer);
+
+    /**
+     * @brief Adds a file sink that collapses repeated messages (see DeduplicatingLogSink).
+     *
+     * @param logger_name The name of the logger to which the file sink should be added.
+     * @param log_file_path The path of the log file.
+     * @param duplicate_window How long repeats are collected before their count is written.
+     */
+    void addFileSink(const std::string& logger_name,
+                     const std::string& log_file_path,
+                     std::chrono::milliseconds duplicate_window);
+
+    /**
+     * @brief Adds any sink wrapped so that it collapses repeated messages (see DeduplicatingLogSink).
+     *
+     * @param logger_name The name of the logger to which the sink should be added.
+     * @param sink The sink to wrap, such as a console, socket or routing sink.
+     * @param duplicate_window How long repeats are collected before their count is written.
+     */
+    void addDeduplicatedSink(const std::string& logger_name,
+                             std::unique_ptr<ILogSink> sink,
+                             std::chrono::milliseconds duplicate_window);
+
     /**
      * @brief Sets the pattern for the console sink of a logger.
      *
@@ -113,6 +188,89 @@ class LogManager final {
      */
     void setFlushLevel(const std::string& logger_name, LogLevel level);
 
+    /**
+     * @brief Adds a Chrome trace sink to a logger and enables tracing on it.
+     *
+     * @param logger_name The name of the logger to which the trace sink should be added.
+     * @param trace_file_path The path where the trace file should be created.
+     */
+    void addChromeTraceSink(const std::string& logger_name, const std::string& trace_file_path);
+
+    /**
+     * @brief Adds a sink that writes into a shared-memory segment read by a collector process.
+     *
+     * @param logger_name The name of the logger to which the sink should be added.
+     * @param segment_name The POSIX shared-memory name of the segment.
+     */
+    void addSharedMemorySink(const std::string& logger_name, const std::string& segment_name);
+
+    /**
+     * @brief Adds a sink that streams framed batches to a local aggregator (see SocketLogSink).
+     *
+     * @param logger_name The name of the logger to which the sink should be added.
+     * @param endpoint "unix:<path>" or "tcp:<host>:<port>".
+     * @param options Batching, spooling and reconnect settings.
+     */
+    void addSocketSink(const std::string& logger_name, const std::string& endpoint, const SocketSinkOptions& options);
+
+    /**
+     * @brief Adds a sink that writes to the local syslog daemon or journald (see SyslogLogSink).
+     *
+     * @param logger_name The name of the logger to which the sink should be added.
+     * @param options Protocol, identity and batching.
+     */
+    void addSyslogSink(const std::string& logger_name, const SyslogSinkOptions& options);
+
+    /**
+     * @brief Adds a sink that writes to files chosen by category and level (see RoutingLogSink).
+     *
+     * @param logger_name The name of the logger to which the sink should be added.
+     * @param routes File routes, tried in order.
+     * @param max_open_fds Descriptors the open file targets may hold together.
+     */
+    void addRoutingSink(const std::string& logger_name, const std::vector<LogRoute>& routes, size_t max_open_fds);
+
+    /**
+     * @brief Enables or disables recording of trace spans for a logger.
+     *
+     * @param logger_name The name of the logger.
+     * @param enabled True to record spans.
+     */
+    void setTracingEnabled(const std::string& logger_name, bool enabled);
+
+    /**
+     * @brief Queues a logger's messages at or above a level ahead of its backlog (asynchronous loggers only).
+     *
+     * @param logger_name The name of the logger.
+     * @param level The lowest level queued on the priority lane.
+     * @param order How the worker orders priority and normal messages within a batch.
+     */
+    void setPriorityLane(const std::string& logger_name, LogLevel level, LaneOrder order);
+
+    /**
+     * @brief Queues every message of a logger on its normal lane again.
+     *
+     * @param logger_name The name of the logger.
+     */
+    void disablePriorityLane(const std::string& logger_name);
+
+    /**
+     * @brief Sets the lowest level an asynchronous logger writes synchronously, making it hybrid.
+     *
+     * @param logger_name The name of the logger.
+     * @param level The lowest level written synchronously.
+     */
+    void setSyncLevel(const std::string& logger_name, LogLevel level);
+
+    /**
+     * @brief Switches the pipelined backend of an asynchronous logger on or off.
+     *
+     * @param logger_name The name of the logger.
+     * @param enabled True to format on the worker and write on a separate I/O thread.
+     * @param formatter_threads Threads formatting in parallel instead of the worker; 0 for none.
+     */
+    void setPipelined(const std::string& logger_name, bool enabled, size_t formatter_threads = 0);
+
     /**
      * @brief Checks if a specific logger is configured for asynchronous operation.
      *
@@ -121,6 +279,26 @@ class LogManager final {
      */
     [[nodiscard]] bool isLoggerAsync(const std::string& logger_name) const;
 
+    /**
+     * @brief Returns the mode of a logger.
+     *
+     * @param logger_name The name of the logger to check.
+     * @return The logger's mode; LoggerMode::eSync if it doesn't exist.
+     */
+    [[nodiscard]] LoggerMode getLoggerMode(const std::string& logger_name) const;
+
+    /**
+     * @brief Collects the runtime statistics of every managed logger.
+     *
+     * @return A snapshot with one entry per logger, sorted by logger name.
+     */
+    [[nodiscard]] LoggingStats getStats() const;
+
+    /**
+     * @brief Resets the runtime statistics of every managed logger.
+     */
+    void resetStats();
+
     /**
      * @brief Flushes the logs and unregisters all loggers.
      *
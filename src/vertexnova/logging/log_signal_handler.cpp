@@ -0,0 +1,202 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "log_signal_handler.h"
+#include "vertexnova/logging/core/logger_controller.h"
+
+#include <cstring>
+#include <iostream>
+
+#if defined(VNE_PLATFORM_WIN) || defined(_WIN32) || defined(VNE_PLATFORM_WEB)
+#define VNE_LOG_SIGNALS_UNSUPPORTED 1
+#else
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifndef VNE_LOG_SIGNALS_UNSUPPORTED
+
+static_assert(std::atomic<bool>::is_always_lock_free, "signal flags must be lock-free");
+static_assert(std::atomic<int>::is_always_lock_free, "signal flags must be lock-free");
+
+std::atomic<bool> s_installed{false};         //!< Whether a LogSignalHandler owns the signals.
+std::atomic<bool> s_level_requested{false};   //!< Set by SIGUSR1.
+std::atomic<bool> s_reopen_requested{false};  //!< Set by SIGUSR2.
+std::atomic<int> s_wake_fd{-1};               //!< Write end of the installed handler's pipe.
+struct sigaction s_previous_usr1;             //!< SIGUSR1 disposition before install().
+struct sigaction s_previous_usr2;             //!< SIGUSR2 disposition before install().
+
+/**
+ * @brief The signal handler: only async-signal-safe operations.
+ */
+void onSignal(int signal_number) {
+    const int saved_errno = errno;
+    if (signal_number == SIGUSR1) {
+        s_level_requested.store(true, std::memory_order_relaxed);
+    } else {
+        s_reopen_requested.store(true, std::memory_order_relaxed);
+    }
+    const char wake = 's';
+    [[maybe_unused]] ssize_t written = ::write(s_wake_fd.load(std::memory_order_relaxed), &wake, 1);
+    errno = saved_errno;
+}
+
+void closeFd(int& fd) {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+#endif  // VNE_LOG_SIGNALS_UNSUPPORTED
+
+}  // namespace
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+LogSignalHandler::~LogSignalHandler() {
+    uninstall();
+}
+
+bool LogSignalHandler::isSupported() {
+#ifdef VNE_LOG_SIGNALS_UNSUPPORTED
+    return false;
+#else
+    return true;
+#endif
+}
+
+void LogSignalHandler::changeLevels() {
+    for (const std::string& name : LoggerController::getLoggerNames()) {
+        std::shared_ptr<ILogger> logger = LoggerController::getLogger(name);
+        if (!logger) {
+            continue;
+        }
+        const LogLevel level = logger->getCurrentLogLevel();
+        auto saved = saved_levels_.find(name);
+        if (mode_ == SignalLevelMode::eToggleTrace) {
+            if (saved != saved_levels_.end()) {
+                logger->setCurrentLogLevel(saved->second);
+                saved_levels_.erase(saved);
+            } else {
+                saved_levels_.emplace(name, level);
+                logger->setCurrentLogLevel(LogLevel::eTrace);
+            }
+        } else if (level == LogLevel::eTrace && saved != saved_levels_.end()) {
+            logger->setCurrentLogLevel(saved->second);
+            saved_levels_.erase(saved);
+        } else {
+            saved_levels_.emplace(name, level);
+            if (level != LogLevel::eTrace) {
+                logger->setCurrentLogLevel(static_cast<LogLevel>(static_cast<int>(level) - 1));
+            }
+        }
+    }
+}
+
+void LogSignalHandler::reopenSinks() {
+    for (const std::string& name : LoggerController::getLoggerNames()) {
+        if (std::shared_ptr<ILogger> logger = LoggerController::getLogger(name)) {
+            logger->flush();
+            logger->reopenSinks();
+        }
+    }
+}
+
+#ifdef VNE_LOG_SIGNALS_UNSUPPORTED
+
+bool LogSignalHandler::install(SignalLevelMode /*mode*/) {
+    return false;
+}
+
+void LogSignalHandler::uninstall() {}
+
+void LogSignalHandler::run() {}
+
+#else
+
+bool LogSignalHandler::install(SignalLevelMode mode) {
+    if (isInstalled() || s_installed.exchange(true)) {
+        return false;
+    }
+    if (::pipe(wake_fds_) != 0) {
+        std::cerr << "[ERROR] : Couldn't create signal pipe: " << std::strerror(errno) << std::endl;
+        s_installed.store(false);
+        return false;
+    }
+    ::fcntl(wake_fds_[0], F_SETFD, FD_CLOEXEC);
+    ::fcntl(wake_fds_[1], F_SETFD, FD_CLOEXEC);
+    // The handler must never block, even if the thread has fallen behind
+    ::fcntl(wake_fds_[1], F_SETFL, ::fcntl(wake_fds_[1], F_GETFL) | O_NONBLOCK);
+
+    mode_ = mode;
+    saved_levels_.clear();
+    stopping_.store(false);
+    s_level_requested.store(false);
+    s_reopen_requested.store(false);
+    s_wake_fd.store(wake_fds_[1]);
+    thread_ = std::thread(&LogSignalHandler::run, this);
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = &onSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    ::sigaction(SIGUSR1, &action, &s_previous_usr1);
+    ::sigaction(SIGUSR2, &action, &s_previous_usr2);
+    return true;
+}
+
+void LogSignalHandler::uninstall() {
+    if (!isInstalled()) {
+        return;
+    }
+    ::sigaction(SIGUSR1, &s_previous_usr1, nullptr);
+    ::sigaction(SIGUSR2, &s_previous_usr2, nullptr);
+
+    stopping_.store(true);
+    const char wake = 'x';
+    [[maybe_unused]] ssize_t written = ::write(wake_fds_[1], &wake, 1);
+    thread_.join();
+    s_wake_fd.store(-1);
+    closeFd(wake_fds_[0]);
+    closeFd(wake_fds_[1]);
+    s_installed.store(false);
+}
+
+void LogSignalHandler::run() {
+    char buffer[64];
+    while (!stopping_.load()) {
+        ssize_t received = ::read(wake_fds_[0], buffer, sizeof(buffer));
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0 || stopping_.load()) {
+            break;
+        }
+        if (s_level_requested.exchange(false)) {
+            changeLevels();
+        }
+        if (s_reopen_requested.exchange(false)) {
+            reopenSinks();
+        }
+    }
+}
+
+#endif  // VNE_LOG_SIGNALS_UNSUPPORTED
+
+}  // namespace log
+}  // namespace vne
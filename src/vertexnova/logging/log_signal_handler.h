@@ -0,0 +1,110 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/logging/core/log_level.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace vne::log {
+
+/**
+ * @enum SignalLevelMode
+ * @brief What SIGUSR1 does to the level of every registered logger.
+ */
+enum class SignalLevelMode : uint8_t {
+    eToggleTrace = 0,  //!< Switch to eTrace; the next signal restores the previous levels.
+    eCycle = 1         //!< One level more verbose per signal; after eTrace the previous levels return.
+};
+
+/**
+ * @class LogSignalHandler
+ * @brief Lets operators change verbosity and reopen log files with SIGUSR1 and SIGUSR2.
+ *
+ * - SIGUSR1 changes the level of every registered logger (see SignalLevelMode).
+ * - SIGUSR2 flushes every logger and reopens its file sinks, for logrotate's
+ *   `postrotate` (e.g. `kill -USR2 $(cat app.pid)`) instead of copytruncate.
+ *
+ * The signal handler only sets an atomic flag and writes one byte to a pipe,
+ * both async-signal-safe. A handler thread wakes on the pipe and does the
+ * work with the same calls as LogControlServer, so asynchronous loggers
+ * reopen their files on their own worker thread.
+ *
+ * One handler can be installed per process. The previous signal dispositions
+ * are restored by uninstall(). Only POSIX platforms are supported; elsewhere
+ * install() returns false.
+ */
+class LogSignalHandler {
+   public:
+    LogSignalHandler() = default;
+
+    /**
+     * @brief Uninstalls the handler.
+     */
+    ~LogSignalHandler();
+
+    LogSignalHandler(const LogSignalHandler&) = delete;
+    LogSignalHandler& operator=(const LogSignalHandler&) = delete;
+
+    /**
+     * @brief Installs the SIGUSR1 and SIGUSR2 handlers and starts the handler thread.
+     *
+     * @param mode What SIGUSR1 does.
+     * @return True if installed; false if unsupported or another handler is installed.
+     */
+    bool install(SignalLevelMode mode = SignalLevelMode::eToggleTrace);
+
+    /**
+     * @brief Restores the previous signal dispositions and stops the handler thread.
+     *
+     * Levels changed by SIGUSR1 are left as they are. Safe to call when not installed.
+     */
+    void uninstall();
+
+    /**
+     * @brief Returns whether the handlers are installed.
+     */
+    [[nodiscard]] bool isInstalled() const { return thread_.joinable(); }
+
+    /**
+     * @brief Returns whether this platform has SIGUSR1 and SIGUSR2.
+     */
+    static bool isSupported();
+
+   private:
+    /**
+     * @brief Waits for signals and applies them until uninstall() is called.
+     */
+    void run();
+
+    /**
+     * @brief Applies SIGUSR1 to every registered logger.
+     */
+    void changeLevels();
+
+    /**
+     * @brief Applies SIGUSR2: flushes every registered logger and reopens its sinks.
+     */
+    static void reopenSinks();
+
+   private:
+    SignalLevelMode mode_ = SignalLevelMode::eToggleTrace;    //!< What SIGUSR1 does.
+    std::unordered_map<std::string, LogLevel> saved_levels_;  //!< Levels before SIGUSR1; handler thread only.
+    int wake_fds_[2] = {-1, -1};                              //!< Pipe written by the signal handler.
+    std::thread thread_;                                      //!< Handler thread.
+    std::atomic<bool> stopping_{false};                       //!< Set by uninstall() to end the thread.
+};
+
+}  // namespace vne::log
@@ -11,13 +11,16 @@
 
 #include <vertexnova/logging/logging.h>
 
+#include "log_control_server.h"
 #include "core/log_level.h"
 #include "core/time_stamp.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <iomanip>
+#include <iostream>
 #include <sstream>
 #include <string>
 
@@ -111,6 +114,13 @@ bool createDirectories(const std::string& path) {
 #endif
 }
 
+/**
+ * @brief Returns part as a percentage of total, or zero when total is zero.
+ */
+double percentOf(uint64_t part, uint64_t total) {
+    return total ? 100.0 * static_cast<double>(part) / static_cast<double>(total) : 0.0;
+}
+
 }  // namespace
 
 //==============================================================================
@@ -118,6 +128,8 @@ bool createDirectories(const std::string& path) {
 //==============================================================================
 
 std::shared_ptr<LogManager> Logging::s_log_manager = nullptr;
+std::unique_ptr<LogControlServer> Logging::s_control_server;
+std::unique_ptr<LogSignalHandler> Logging::s_signal_handler;
 
 //==============================================================================
 // Core logging functions
@@ -130,7 +142,16 @@ void Logging::initialize(const std::string& name, bool async) {
     s_log_manager->createLogger(name, async);
 }
 
+void Logging::initialize(const std::string& name, LoggerMode mode, LogLevel sync_level) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->createLogger(name, mode, sync_level);
+}
+
 void Logging::shutdown() {
+    stopControlServer();
+    uninstallSignalHandlers();
     if (s_log_manager) {
         s_log_manager->finalize();
         s_log_manager.reset();
@@ -144,6 +165,27 @@ bool Logging::isLoggerAsync(const std::string& logger_name) {
     return s_log_manager->isLoggerAsync(logger_name);
 }
 
+LoggerMode Logging::getLoggerMode(const std::string& logger_name) {
+    if (!s_log_manager) {
+        return LoggerMode::eSync;
+    }
+    return s_log_manager->getLoggerMode(logger_name);
+}
+
+void Logging::setSyncLevel(const std::string& logger_name, LogLevel level) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->setSyncLevel(logger_name, level);
+}
+
+void Logging::setPipelined(const std::string& logger_name, bool enabled, size_t formatter_threads) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->setPipelined(logger_name, enabled, formatter_threads);
+}
+
 void Logging::addConsoleSink(const std::string& logger_name) {
     if (!s_log_manager) {
         s_log_manager = std::make_shared<LogManager>();
@@ -158,6 +200,38 @@ void Logging::addFileSink(const std::string& logger_name, const std::string& fil
     s_log_manager->addFileSink(logger_name, file);
 }
 
+void Logging::addConsoleSink(const std::string& logger_name, const SinkBufferOptions& buffer) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addConsoleSink(logger_name, buffer);
+}
+
+void Logging::addFileSink(const std::string& logger_name, const std::string& file, const SinkBufferOptions& buffer) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addFileSink(logger_name, file, buffer);
+}
+
+void Logging::addFileSink(const std::string& logger_name,
+                          const std::string& file,
+                          std::chrono::milliseconds duplicate_window) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addFileSink(logger_name, file, duplicate_window);
+}
+
+void Logging::addDeduplicatedSink(const std::string& logger_name,
+                                  std::unique_ptr<ILogSink> sink,
+                                  std::chrono::milliseconds duplicate_window) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addDeduplicatedSink(logger_name, std::move(sink), duplicate_window);
+}
+
 void Logging::setConsolePattern(const std::string& logger_name, const std::string& pattern) {
     if (!s_log_manager) {
         s_log_manager = std::make_shared<LogManager>();
@@ -186,6 +260,217 @@ void Logging::setFlushLevel(const std::string& logger_name, LogLevel level) {
     s_log_manager->setFlushLevel(logger_name, level);
 }
 
+void Logging::addChromeTraceSink(const std::string& logger_name, const std::string& file) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addChromeTraceSink(logger_name, file);
+}
+
+void Logging::addSharedMemorySink(const std::string& logger_name, const std::string& segment_name) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addSharedMemorySink(logger_name, segment_name);
+}
+
+void Logging::addSocketSink(const std::string& logger_name,
+                            const std::string& endpoint,
+                            const SocketSinkOptions& options) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addSocketSink(logger_name, endpoint, options);
+}
+
+void Logging::addSyslogSink(const std::string& logger_name, const SyslogSinkOptions& options) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addSyslogSink(logger_name, options);
+}
+
+void Logging::addRoutingSink(const std::string& logger_name,
+                             const std::vector<LogRoute>& routes,
+                             size_t max_open_fds) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->addRoutingSink(logger_name, routes, max_open_fds);
+}
+
+void Logging::setTracingEnabled(const std::string& logger_name, bool enabled) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->setTracingEnabled(logger_name, enabled);
+}
+
+void Logging::setPriorityLane(const std::string& logger_name, LogLevel level, LaneOrder order) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->setPriorityLane(logger_name, level, order);
+}
+
+void Logging::disablePriorityLane(const std::string& logger_name) {
+    if (!s_log_manager) {
+        s_log_manager = std::make_shared<LogManager>();
+    }
+    s_log_manager->disablePriorityLane(logger_name);
+}
+
+//==============================================================================
+// Statistics functions
+//==============================================================================
+
+LoggingStats Logging::getStats() {
+    if (!s_log_manager) {
+        return {};
+    }
+    return s_log_manager->getStats();
+}
+
+LoggerStats Logging::getLoggerStats(const std::string& logger_name) {
+    if (!s_log_manager) {
+        return {};
+    }
+    auto logger = s_log_manager->getLogger(logger_name);
+    if (!logger) {
+        return {};
+    }
+    return logger->getStats();
+}
+
+void Logging::resetStats() {
+    if (s_log_manager) {
+        s_log_manager->resetStats();
+    }
+}
+
+//==============================================================================
+// Call-site functions
+//==============================================================================
+
+void Logging::setLogProfilingEnabled(bool enabled) {
+    LogCallSite::setProfilingEnabled(enabled);
+}
+
+bool Logging::isLogProfilingEnabled() {
+    return LogCallSite::isProfilingEnabled();
+}
+
+std::vector<CallSiteProfile> Logging::getLogProfile() {
+    return LogCallSite::collectProfile();
+}
+
+void Logging::resetLogProfile() {
+    LogCallSite::resetProfile();
+}
+
+void Logging::dumpLogProfile(size_t top_n) {
+    dumpLogProfile(std::cout, top_n);
+}
+
+void Logging::dumpLogProfile(std::ostream& out, size_t top_n) {
+    const std::vector<CallSiteProfile> profile = getLogProfile();
+    uint64_t total_bytes = 0;
+    uint64_t total_messages = 0;
+    for (const CallSiteProfile& site : profile) {
+        total_bytes += site.bytes;
+        total_messages += site.messages;
+    }
+
+    std::ostringstream table;
+    table << "Log profile: " << total_messages << " messages, " << total_bytes << " bytes from " << profile.size()
+          << " statements\n";
+    table << std::right << std::setw(4) << "#" << std::setw(14) << "bytes" << std::setw(8) << "%" << std::setw(8)
+          << "cum%" << std::setw(12) << "messages" << "  " << std::left << std::setw(6) << "level" << std::setw(16)
+          << "category"
+          << "location\n";
+
+    const size_t rows = std::min(top_n, profile.size());
+    uint64_t cumulative_bytes = 0;
+    table << std::fixed << std::setprecision(1);
+    for (size_t i = 0; i < rows; ++i) {
+        const CallSiteProfile& site = profile[i];
+        cumulative_bytes += site.bytes;
+        const double share = percentOf(site.bytes, total_bytes);
+        const double cumulative = percentOf(cumulative_bytes, total_bytes);
+        std::ostringstream level;
+        level << site.level;
+        table << std::right << std::setw(4) << (i + 1) << std::setw(14) << site.bytes << std::setw(8) << share
+              << std::setw(8) << cumulative << std::setw(12) << site.messages << "  " << std::left << std::setw(6)
+              << level.str() << std::setw(16) << site.category << site.file << ':' << site.line << '\n';
+    }
+    out << table.str();
+}
+
+size_t Logging::enableCallSites(const std::string& spec) {
+    return LogCallSite::applySpec(spec, CallSiteState::eEnabled);
+}
+
+size_t Logging::disableCallSites(const std::string& spec) {
+    return LogCallSite::applySpec(spec, CallSiteState::eDisabled);
+}
+
+size_t Logging::setCategoryLevel(const std::string& category, LogLevel level) {
+    return LogCallSite::applyCategoryLevel(category, level);
+}
+
+void Logging::resetCallSites() {
+    LogCallSite::resetStates();
+}
+
+std::vector<CallSiteProfile> Logging::getCallSites() {
+    return LogCallSite::collectCallSites();
+}
+
+//==============================================================================
+// Control endpoint
+//==============================================================================
+
+bool Logging::startControlServer(const std::string& socket_path) {
+    if (!s_control_server) {
+        s_control_server = std::make_unique<LogControlServer>();
+    }
+    s_control_server->stop();
+    return s_control_server->start(socket_path);
+}
+
+void Logging::stopControlServer() {
+    if (s_control_server) {
+        s_control_server->stop();
+    }
+}
+
+std::string Logging::getControlSocketPath() {
+    return s_control_server ? s_control_server->getSocketPath() : std::string();
+}
+
+bool Logging::installSignalHandlers(SignalLevelMode mode) {
+    if (!s_signal_handler) {
+        s_signal_handler = std::make_unique<LogSignalHandler>();
+    }
+    s_signal_handler->uninstall();
+    return s_signal_handler->install(mode);
+}
+
+void Logging::uninstallSignalHandlers() {
+    if (s_signal_handler) {
+        s_signal_handler->uninstall();
+    }
+}
+
+bool Logging::installCrashHandler(const CrashHandlerOptions& options) {
+    LogCrashHandler::uninstall();
+    return LogCrashHandler::install(options);
+}
+
+void Logging::uninstallCrashHandler() {
+    LogCrashHandler::uninstall();
+}
+
 //==============================================================================
 // Configuration functions
 //==============================================================================
@@ -198,6 +483,7 @@ LoggerConfig Logging::defaultLoggerConfig() {
     config.log_level = LogLevel::eInfo;
     config.flush_level = LogLevel::eError;
     config.async = false;
+    config.mode = LoggerMode::eSync;
 
 #ifdef VNE_PLATFORM_WEB
     config.sink = LogSinkType::eConsole;
@@ -215,11 +501,15 @@ LoggerConfig Logging::defaultLoggerConfig() {
 }
 
 void Logging::configureLogger(const LoggerConfig& cfg) {
-    initialize(cfg.name, cfg.async);
+    initialize(cfg.name, cfg.async && cfg.mode == LoggerMode::eSync ? LoggerMode::eAsync : cfg.mode, cfg.sync_level);
 
     // Configure console sink
     if (cfg.sink == LogSinkType::eConsole || cfg.sink == LogSinkType::eBoth) {
-        addConsoleSink(cfg.name);
+        if (cfg.isolate_sinks) {
+            addConsoleSink(cfg.name, cfg.console_buffer);
+        } else {
+            addConsoleSink(cfg.name);
+        }
         if (!cfg.console_pattern.empty()) {
             setConsolePattern(cfg.name, cfg.console_pattern);
         }
@@ -229,7 +519,11 @@ void Logging::configureLogger(const LoggerConfig& cfg) {
 #ifndef VNE_PLATFORM_WEB
     if (cfg.sink == LogSinkType::eFile || cfg.sink == LogSinkType::eBoth) {
         if (!cfg.file_path.empty()) {
-            addFileSink(cfg.name, cfg.file_path);
+            if (cfg.isolate_sinks) {
+                addFileSink(cfg.name, cfg.file_path, cfg.file_buffer);
+            } else {
+                addFileSink(cfg.name, cfg.file_path);
+            }
             if (!cfg.file_pattern.empty()) {
                 setFilePattern(cfg.name, cfg.file_pattern);
             }
@@ -239,6 +533,12 @@ void Logging::configureLogger(const LoggerConfig& cfg) {
 
     setLogLevel(cfg.name, cfg.log_level);
     setFlushLevel(cfg.name, cfg.flush_level);
+    if (cfg.priority_lane) {
+        setPriorityLane(cfg.name, cfg.priority_level, cfg.lane_order);
+    }
+    if (cfg.pipelined) {
+        setPipelined(cfg.name, true, cfg.formatter_threads);
+    }
 }
 
 //==============================================================================
@@ -0,0 +1,179 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "shared_log_collector.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace vne {  // Outer namespace
+namespace log {  // Inner namespace
+
+SharedLogCollector::SharedLogCollector(SharedLogCollectorOptions options)
+    : options_(std::move(options)) {}
+
+SharedLogCollector::~SharedLogCollector() {
+    if (output_.is_open()) {
+        output_.close();
+    }
+}
+
+bool SharedLogCollector::open() {
+    if (!segment_.open(options_.segment_name, options_.segment)) {
+        return false;
+    }
+    read_ends_.assign(segment_.getSlotCount(), 0);
+    records_written_ = 0;
+    rotations_ = 0;
+    return reopen();
+}
+
+bool SharedLogCollector::reopen() {
+    if (output_.is_open()) {
+        output_.close();
+    }
+    std::filesystem::path directory = std::filesystem::path(options_.output_path).parent_path();
+    std::error_code error;
+    if (!directory.empty()) {
+        std::filesystem::create_directories(directory, error);
+    }
+    output_.open(options_.output_path, std::ofstream::out | std::ofstream::app | std::ofstream::binary);
+    auto size = std::filesystem::file_size(options_.output_path, error);
+    file_bytes_ = error ? 0 : static_cast<uint64_t>(size);
+    return output_.is_open();
+}
+
+size_t SharedLogCollector::collect(bool all) {
+    if (!segment_.isOpen() || !output_.is_open()) {
+        return 0;
+    }
+    int64_t cutoff = std::numeric_limits<int64_t>::max();
+    if (!all) {
+        auto now = std::chrono::system_clock::now() - options_.merge_window;
+        cutoff = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+    }
+
+    pending_.clear();
+    const uint32_t slots = segment_.getSlotCount();
+    for (uint32_t slot = 0; slot < slots; ++slot) {
+        uint64_t position = segment_.getReadPosition(slot);
+        read_ends_[slot] = position;
+        SharedLogSegment::Record record;
+        // A ring is in time order, so its first record past the cutoff ends this pass for it
+        while (segment_.read(slot, position, record) && record.time_ns <= cutoff) {
+            pending_.push_back(PendingLine{record.time_ns, slot, record.text});
+            position = record.end;
+        }
+        read_ends_[slot] = position;
+    }
+    if (pending_.empty()) {
+        segment_.reclaimSlots();
+        return 0;
+    }
+
+    std::stable_sort(pending_.begin(), pending_.end(), [](const PendingLine& lhs, const PendingLine& rhs) {
+        return lhs.time_ns < rhs.time_ns;
+    });
+    for (const PendingLine& line : pending_) {
+        writeLine(line.text);
+    }
+    output_.flush();
+    if (!output_.good()) {
+        // Leaves the records in the rings, so the next pass writes them again (disk full, file gone, ...)
+        if (!write_failed_) {
+            std::cerr << "[ERROR] : Couldn't write to " << options_.output_path << "; records stay queued"
+                      << std::endl;
+            write_failed_ = true;
+        }
+        output_.clear();
+        return 0;
+    }
+    write_failed_ = false;
+
+    // Only now may the producers overwrite what was read; a restart before this writes the pass again
+    for (uint32_t slot = 0; slot < slots; ++slot) {
+        if (read_ends_[slot] != segment_.getReadPosition(slot)) {
+            segment_.commitRead(slot, read_ends_[slot]);
+        }
+    }
+    segment_.reclaimSlots();
+    records_written_ += pending_.size();
+    return pending_.size();
+}
+
+void SharedLogCollector::run(const std::atomic<bool>& stop) {
+    while (!stop.load(std::memory_order_relaxed)) {
+        if (reopen_requested_.exchange(false, std::memory_order_relaxed)) {
+            reopen();
+        }
+        if (collect() == 0) {
+            std::this_thread::sleep_for(options_.poll_interval);
+        }
+    }
+    collect(true);
+}
+
+uint64_t SharedLogCollector::getDropped() const {
+    uint64_t dropped = 0;
+    for (uint32_t slot = 0; slot < segment_.getSlotCount(); ++slot) {
+        if (segment_.isClaimed(slot)) {
+            dropped += segment_.getDropped(slot);
+        }
+    }
+    return dropped;
+}
+
+size_t SharedLogCollector::getProducerCount() const {
+    size_t producers = 0;
+    for (uint32_t slot = 0; slot < segment_.getSlotCount(); ++slot) {
+        producers += segment_.isClaimed(slot) ? 1 : 0;
+    }
+    return producers;
+}
+
+void SharedLogCollector::writeLine(std::string_view text) {
+    const uint64_t bytes = text.size() + 1;
+    if (options_.max_file_bytes > 0 && file_bytes_ > 0 && file_bytes_ + bytes > options_.max_file_bytes) {
+        rotate();
+    }
+    output_.write(text.data(), static_cast<std::streamsize>(text.size()));
+    output_.put('\n');
+    file_bytes_ += bytes;
+}
+
+void SharedLogCollector::rotate() {
+    output_.close();
+    const std::string& path = options_.output_path;
+    std::error_code error;
+    if (options_.max_files == 0) {
+        std::filesystem::remove(path, error);
+    } else {
+        std::filesystem::remove(path + "." + std::to_string(options_.max_files), error);
+        for (size_t index = options_.max_files - 1; index > 0; --index) {
+            std::string from = path + "." + std::to_string(index);
+            if (std::filesystem::exists(from, error)) {
+                std::filesystem::rename(from, path + "." + std::to_string(index + 1), error);
+            }
+        }
+        std::filesystem::rename(path, path + ".1", error);
+    }
+    output_.open(path, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+    file_bytes_ = 0;
+    ++rotations_;
+}
+
+}  // namespace log
+}  // namespace vne
@@ -0,0 +1,163 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/logging/core/shared_log_segment.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vne::log {
+
+/**
+ * @struct SharedLogCollectorOptions
+ * @brief Where a SharedLogCollector reads from and writes to.
+ */
+struct SharedLogCollectorOptions {
+    std::string segment_name = SharedLogSegment::kDefaultName;  //!< Segment the producers write into.
+    SharedLogSegmentOptions segment;                             //!< Geometry, if the collector creates the segment.
+    std::string output_path = "vnelog.log";                      //!< The merged log file.
+    uint64_t max_file_bytes = 64 * 1024 * 1024;                  //!< Rotate once the file would exceed this; 0 never.
+    size_t max_files = 5;                                        //!< Rotated files kept (path.1 .. path.N).
+    std::chrono::milliseconds merge_window{50};                  //!< How long a record waits for older ones.
+    std::chrono::milliseconds poll_interval{10};                 //!< Sleep between passes that found nothing.
+};
+
+/**
+ * @class SharedLogCollector
+ * @brief Merges the rings of a shared-memory segment by time stamp into one rotated file.
+ *
+ * Producers (SharedMemoryLogSink) stamp every record with the system clock
+ * and write it to their own ring. Each pass of collect() takes the records
+ * older than the merge window from every ring, sorts them by time stamp (ties
+ * keep ring order) and appends them to the output file. The window gives a
+ * producer that was descheduled between stamping and publishing a record the
+ * chance to publish it before newer records of other rings are written.
+ *
+ * A ring's read position is committed in the segment only after the records
+ * have been written and flushed, so a collector that is killed and restarted
+ * writes at worst the last pass again and never loses a record that reached a
+ * ring. The vnelog-collectord daemon runs this class.
+ */
+class SharedLogCollector {
+   public:
+    /**
+     * @brief Stores the options; nothing is opened until open().
+     */
+    explicit SharedLogCollector(SharedLogCollectorOptions options);
+
+    /**
+     * @brief Closes the output file and unmaps the segment.
+     */
+    ~SharedLogCollector();
+
+    SharedLogCollector(const SharedLogCollector&) = delete;
+    SharedLogCollector& operator=(const SharedLogCollector&) = delete;
+
+    /**
+     * @brief Opens (or creates) the segment and opens the output file for appending.
+     *
+     * @return False if either could not be opened.
+     */
+    bool open();
+
+    /**
+     * @brief Runs one pass: writes the records older than the merge window, or all of them.
+     *
+     * The records are only released to the producers once the output file has
+     * taken them; if writing fails they stay in the rings for the next pass.
+     *
+     * @param all True to ignore the merge window, e.g. on shutdown.
+     * @return The number of records written.
+     */
+    size_t collect(bool all = false);
+
+    /**
+     * @brief Collects until stop is set, then writes what is left.
+     *
+     * @param stop Set (e.g. from a signal handler) to return.
+     */
+    void run(const std::atomic<bool>& stop);
+
+    /**
+     * @brief Asks run() to reopen the output file before its next pass; safe to call from a signal handler.
+     */
+    void requestReopen() { reopen_requested_.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Closes and reopens the output file, e.g. after an external tool renamed it.
+     */
+    bool reopen();
+
+    /**
+     * @brief Returns the options.
+     */
+    [[nodiscard]] const SharedLogCollectorOptions& getOptions() const { return options_; }
+
+    /**
+     * @brief Returns the number of records written since open().
+     */
+    [[nodiscard]] uint64_t getRecordsWritten() const { return records_written_; }
+
+    /**
+     * @brief Returns the number of times the output file was rotated.
+     */
+    [[nodiscard]] uint64_t getRotations() const { return rotations_; }
+
+    /**
+     * @brief Returns the records dropped by producers that are attached now, because their ring was full.
+     */
+    [[nodiscard]] uint64_t getDropped() const;
+
+    /**
+     * @brief Returns the number of slots claimed by producers.
+     */
+    [[nodiscard]] size_t getProducerCount() const;
+
+   private:
+    /**
+     * @brief A record taken from a ring in this pass.
+     */
+    struct PendingLine {
+        int64_t time_ns;        //!< Time stamp, the merge key.
+        uint32_t slot;          //!< Ring it came from.
+        std::string_view text;  //!< The line, still in the ring.
+    };
+
+    /**
+     * @brief Appends a line to the output file, rotating first if it would grow too large.
+     */
+    void writeLine(std::string_view text);
+
+    /**
+     * @brief Renames path to path.1 (and so on) and starts a new file.
+     */
+    void rotate();
+
+   private:
+    SharedLogCollectorOptions options_;          //!< Segment, output file and timing.
+    SharedLogSegment segment_;                   //!< The mapped segment.
+    std::ofstream output_;                       //!< The merged log file.
+    uint64_t file_bytes_ = 0;                    //!< Size of the output file.
+    uint64_t records_written_ = 0;               //!< Records written since open().
+    uint64_t rotations_ = 0;                     //!< Rotations since open().
+    std::vector<PendingLine> pending_;           //!< Records of the current pass, reused.
+    std::vector<uint64_t> read_ends_;            //!< Per slot, the position after the last record of the pass.
+    std::atomic<bool> reopen_requested_{false};  //!< Set by requestReopen().
+    bool write_failed_ = false;                  //!< Whether the last pass failed to write; reported once.
+};
+
+}  // namespace vne::log
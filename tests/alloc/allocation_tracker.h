@@ -0,0 +1,76 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <cstdint>
+
+/**
+ * @file allocation_tracker.h
+ *
+ * @brief Counts heap allocations per thread and process-wide.
+ *
+ * allocation_tracker.cpp replaces the global operator new family, so this
+ * header may only be used by a test executable that links that file. Every
+ * C++ allocation (containers, strings, std::function, streams) goes through
+ * operator new; the library does not call malloc directly.
+ */
+
+namespace vne::log::testing {
+
+/**
+ * @class AllocationTracker
+ * @brief Read access to the allocation counters.
+ */
+class AllocationTracker {
+   public:
+    /**
+     * @brief Returns the number of allocations made by the calling thread.
+     */
+    static uint64_t threadAllocations() noexcept;
+
+    /**
+     * @brief Returns the number of allocations made by all threads.
+     */
+    static uint64_t totalAllocations() noexcept;
+};
+
+/**
+ * @class AllocationScope
+ * @brief Measures allocations made after its construction.
+ */
+class AllocationScope {
+   public:
+    AllocationScope()
+        : thread_start_(AllocationTracker::threadAllocations())
+        , total_start_(AllocationTracker::totalAllocations()) {}
+
+    /**
+     * @brief Returns the allocations made by the constructing thread since construction.
+     *
+     * Must be called on the thread that constructed the scope.
+     */
+    [[nodiscard]] uint64_t threadAllocations() const noexcept {
+        return AllocationTracker::threadAllocations() - thread_start_;
+    }
+
+    /**
+     * @brief Returns the allocations made by all threads since construction.
+     */
+    [[nodiscard]] uint64_t totalAllocations() const noexcept {
+        return AllocationTracker::totalAllocations() - total_start_;
+    }
+
+   private:
+    uint64_t thread_start_;  //!< Thread counter at construction.
+    uint64_t total_start_;   //!< Process counter at construction.
+};
+
+}  // namespace vne::log::testing
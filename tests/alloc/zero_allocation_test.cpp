@@ -0,0 +1,204 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "allocation_tracker.h"
+
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <thread>
+
+using namespace vne;
+using log::testing::AllocationScope;
+
+namespace {
+
+CREATE_VNE_LOGGER_CATEGORY("alloc.test");
+
+constexpr size_t kMessages = 1000;                      //!< Messages in the measured phase.
+constexpr size_t kWarmUpMessages = kMessages + 64;      //!< Leaves spare records for ones still being released.
+constexpr uint64_t kMaxFormattingAllocsPerMessage = 8;  //!< Worker budget when a sink formats the message.
+constexpr std::string_view kPayload = "payload that does not fit in a small string buffer";
+
+/**
+ * @brief Sink that counts messages without formatting them and can hold the worker back.
+ */
+class GatedCountingSink : public log::ILogSink {
+   public:
+    GatedCountingSink(std::atomic<size_t>& received, std::atomic<bool>& open)
+        : received_(received)
+        , open_(open) {}
+
+    void log(const std::string&,
+             log::LogLevel,
+             log::TimeStampType,
+             const std::string&,
+             const std::string&,
+             const std::string&,
+             uint32_t) override {
+        while (!open_.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        received_.fetch_add(1, std::memory_order_release);
+    }
+
+    void flush() override {}
+    std::string getPattern() const override { return ""; }
+    void setPattern(const std::string&) override {}
+    std::unique_ptr<ILogSink> clone() const override { return std::make_unique<GatedCountingSink>(received_, open_); }
+
+   private:
+    std::atomic<size_t>& received_;
+    std::atomic<bool>& open_;
+};
+
+void waitForCount(const std::atomic<size_t>& received, size_t expected) {
+    while (received.load(std::memory_order_acquire) < expected) {
+        std::this_thread::yield();
+    }
+}
+
+void logMessages(size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        VNE_LOG_INFO << static_cast<int>(i) << ' ' << kPayload;
+    }
+}
+
+}  // namespace
+
+class ZeroAllocationTest : public ::testing::Test {
+   protected:
+    void SetUp() override { log::LoggerController::unregisterAllLoggers(); }
+
+    void TearDown() override { log::LoggerController::unregisterAllLoggers(); }
+
+    /**
+     * @brief Registers an async default logger whose worker blocks until the gate opens.
+     *
+     * @param first_sink Optional sink that receives each message before the counting sink.
+     */
+    std::shared_ptr<log::AsyncLogger> makeGatedAsyncLogger(std::unique_ptr<log::ILogSink> first_sink = nullptr) {
+        auto logger = std::make_shared<log::AsyncLogger>(log::kDefaultLoggerName);
+        if (first_sink) {
+            logger->addLogSink(std::move(first_sink));
+        }
+        logger->addLogSink(std::make_unique<GatedCountingSink>(received_, open_));
+        logger->setFlushLevel(log::LogLevel::eFatal);
+        log::LoggerController::registerLogger(logger);
+        return logger;
+    }
+
+    /**
+     * @brief Logs kWarmUpMessages while the worker is held back, so the record pool and
+     *        the queue grow beyond the backlog of the measured phase.
+     */
+    void warmUp() {
+        open_ = false;
+        logMessages(kWarmUpMessages);
+        open_ = true;
+        waitForCount(received_, kWarmUpMessages);
+    }
+
+    /**
+     * @brief Logs kMessages with the worker held back and returns the producer's allocations.
+     */
+    uint64_t produceMeasured() {
+        open_ = false;
+        AllocationScope scope;
+        logMessages(kMessages);
+        uint64_t allocations = scope.threadAllocations();
+        open_ = true;
+        return allocations;
+    }
+
+    std::atomic<size_t> received_{0};
+    std::atomic<bool> open_{true};
+};
+
+TEST_F(ZeroAllocationTest, AsyncProducerDoesNotAllocateAfterWarmUp) {
+    auto logger = makeGatedAsyncLogger();
+    warmUp();
+
+    AllocationScope scope;
+    uint64_t producer_allocations = produceMeasured();
+    waitForCount(received_, kWarmUpMessages + kMessages);
+    uint64_t worker_allocations = scope.totalAllocations() - producer_allocations;
+
+    EXPECT_EQ(producer_allocations, 0u);
+    EXPECT_EQ(worker_allocations, 0u);
+}
+
+TEST_F(ZeroAllocationTest, AsyncWorkerAllocationsAreBoundedWhenFormatting) {
+    const std::string file_path = "alloc_test.log";
+    auto logger = makeGatedAsyncLogger(std::make_unique<log::FileLogSink>(file_path, false));
+    warmUp();
+
+    AllocationScope scope;
+    uint64_t producer_allocations = produceMeasured();
+    waitForCount(received_, kWarmUpMessages + kMessages);
+    uint64_t worker_allocations = scope.totalAllocations() - producer_allocations;
+
+    EXPECT_EQ(producer_allocations, 0u);
+    EXPECT_LE(worker_allocations, kMessages * kMaxFormattingAllocsPerMessage);
+
+    log::LoggerController::unregisterAllLoggers();
+    logger.reset();
+    std::filesystem::remove(file_path);
+}
+
+TEST_F(ZeroAllocationTest, FilteredMessagesDoNotAllocate) {
+    auto logger = makeGatedAsyncLogger();
+    logger->setCurrentLogLevel(log::LogLevel::eWarn);
+    logMessages(1);
+
+    AllocationScope scope;
+    for (size_t i = 0; i < kMessages; ++i) {
+        VNE_LOG_DEBUG << static_cast<int>(i) << ' ' << kPayload;
+    }
+
+    EXPECT_EQ(scope.threadAllocations(), 0u);
+}
+
+TEST_F(ZeroAllocationTest, SyncPathDoesNotAllocateAfterWarmUp) {
+    auto logger = std::make_shared<log::SyncLogger>(log::kDefaultLoggerName);
+    logger->addLogSink(std::make_unique<GatedCountingSink>(received_, open_));
+    log::LoggerController::registerLogger(logger);
+    logMessages(kMessages);
+
+    AllocationScope scope;
+    logMessages(kMessages);
+
+    EXPECT_EQ(scope.threadAllocations(), 0u);
+    EXPECT_EQ(received_.load(), 2 * kMessages);
+}
+
+TEST_F(ZeroAllocationTest, EmergencyLoggingDoesNotAllocate) {
+    const std::string file_path = "alloc_emergency.log";
+    {
+        log::FileLogSink sink(file_path, false);
+
+        AllocationScope scope;
+        for (size_t i = 0; i < kMessages; ++i) {
+            VNE_LOG_EMERGENCY << static_cast<int>(i) << ' ' << kPayload << ' ' << 0.5;
+        }
+        EXPECT_EQ(scope.threadAllocations(), 0u);
+    }
+    std::filesystem::remove(file_path);
+}
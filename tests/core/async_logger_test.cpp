@@ -21,6 +21,7 @@
 #include <sstream>
 #include <thread>
 #include <chrono>
+#include <atomic>
 
 using namespace vne;
 namespace fs = std::filesystem;
@@ -32,6 +33,41 @@ constexpr const char* kLoggerCatName = "TestLogger";
 constexpr const char* kFileName = "TestFile";
 constexpr const char* kFunctionName = "TestFunction";
 constexpr uint32_t kLineNumber = 42;
+
+/**
+ * @brief Sink that takes a millisecond per message and remembers where an error message landed.
+ */
+class SlowRecordingSink : public log::ILogSink {
+   public:
+    SlowRecordingSink(std::atomic<size_t>& written, std::atomic<size_t>& error_position)
+        : written_(written)
+        , error_position_(error_position) {}
+
+    void log(const std::string&,
+             log::LogLevel level,
+             log::TimeStampType,
+             const std::string&,
+             const std::string&,
+             const std::string&,
+             uint32_t) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        size_t position = written_.fetch_add(1) + 1;
+        if (level == log::LogLevel::eError) {
+            error_position_.store(position);
+        }
+    }
+
+    void flush() override {}
+    std::string getPattern() const override { return ""; }
+    void setPattern(const std::string&) override {}
+    std::unique_ptr<ILogSink> clone() const override {
+        return std::make_unique<SlowRecordingSink>(written_, error_position_);
+    }
+
+   private:
+    std::atomic<size_t>& written_;
+    std::atomic<size_t>& error_position_;
+};
 }  // namespace
 
 // Helper function to capture std::cout output
@@ -288,3 +324,114 @@ TEST_F(AsyncLoggerTest, AddMultipleLogSinks) {
 
     EXPECT_TRUE(file_content.find("Test message for multiple sinks") != std::string::npos);
 }
+
+TEST_F(AsyncLoggerTest, PriorityLaneBypassesBacklog) {
+    constexpr size_t kBacklog = 500;
+    std::atomic<size_t> written{0};
+    std::atomic<size_t> error_position{0};
+    auto logger = std::make_shared<log::AsyncLogger>("AsyncTestLogger");
+    logger->addLogSink(std::make_unique<SlowRecordingSink>(written, error_position));
+    EXPECT_FALSE(logger->isPriorityLaneEnabled());
+    logger->setPriorityLane(log::LogLevel::eError);
+    EXPECT_TRUE(logger->isPriorityLaneEnabled());
+    EXPECT_EQ(logger->getPriorityLevel(), log::LogLevel::eError);
+    EXPECT_EQ(logger->getLaneOrder(), log::LaneOrder::ePriorityFirst);
+
+    for (size_t i = 0; i < kBacklog; ++i) {
+        logger->log(kLoggerCatName,
+                    log::LogLevel::eInfo,
+                    log::TimeStampType::eLocal,
+                    "backlog",
+                    kFileName,
+                    kFunctionName,
+                    kLineNumber);
+    }
+    // Reaches the flush level, but the flush waits only for the priority lane
+    logger->log(kLoggerCatName,
+                log::LogLevel::eError,
+                log::TimeStampType::eLocal,
+                "error",
+                kFileName,
+                kFunctionName,
+                kLineNumber);
+    EXPECT_GT(error_position.load(), 0u);
+    EXPECT_LT(written.load(), kBacklog);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (written.load() < kBacklog + 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(written.load(), kBacklog + 1);
+    EXPECT_LT(error_position.load(), kBacklog);
+
+    log::LoggerStats stats = logger->getStats();
+    EXPECT_EQ(stats.queue.priority_enqueued, 1u);  // The error; its flush is not a record
+    EXPECT_EQ(stats.flush_count, 1u);
+}
+
+TEST_F(AsyncLoggerTest, DisabledPriorityLaneUsesNormalLane) {
+    std::atomic<size_t> written{0};
+    std::atomic<size_t> error_position{0};
+    auto logger = std::make_shared<log::AsyncLogger>("AsyncTestLogger");
+    logger->addLogSink(std::make_unique<SlowRecordingSink>(written, error_position));
+    logger->setPriorityLane(log::LogLevel::eWarn, log::LaneOrder::eTimestamp);
+    auto cloned = logger->clone("ClonedLogger");
+    logger->disablePriorityLane();
+    EXPECT_FALSE(logger->isPriorityLaneEnabled());
+
+    logger->log(kLoggerCatName,
+                log::LogLevel::eError,
+                log::TimeStampType::eLocal,
+                "error",
+                kFileName,
+                kFunctionName,
+                kLineNumber);
+    EXPECT_EQ(logger->getStats().queue.priority_enqueued, 0u);
+
+    auto* cloned_async = dynamic_cast<log::AsyncLogger*>(cloned.get());
+    ASSERT_NE(cloned_async, nullptr);
+    EXPECT_TRUE(cloned_async->isPriorityLaneEnabled());
+    EXPECT_EQ(cloned_async->getPriorityLevel(), log::LogLevel::eWarn);
+    EXPECT_EQ(cloned_async->getLaneOrder(), log::LaneOrder::eTimestamp);
+}
+
+TEST_F(AsyncLoggerTest, HybridModeWritesSevereMessagesSynchronously) {
+    constexpr size_t kBacklog = 50;
+    std::atomic<size_t> written{0};
+    std::atomic<size_t> error_position{0};
+    auto logger = std::make_shared<log::AsyncLogger>("AsyncTestLogger");
+    logger->addLogSink(std::make_unique<SlowRecordingSink>(written, error_position));
+    logger->setFlushLevel(log::LogLevel::eFatal);
+    logger->setSyncLevel(log::LogLevel::eError);
+    EXPECT_TRUE(logger->isHybrid());
+    EXPECT_EQ(logger->getSyncLevel(), log::LogLevel::eError);
+
+    for (size_t i = 0; i < kBacklog; ++i) {
+        logger->log(kLoggerCatName,
+                    log::LogLevel::eInfo,
+                    log::TimeStampType::eLocal,
+                    "backlog",
+                    kFileName,
+                    kFunctionName,
+                    kLineNumber);
+    }
+    EXPECT_LT(written.load(), kBacklog);
+
+    // Returns only once the error, and everything queued before it, has been written in order
+    logger->log(kLoggerCatName,
+                log::LogLevel::eError,
+                log::TimeStampType::eLocal,
+                "error",
+                kFileName,
+                kFunctionName,
+                kLineNumber);
+    EXPECT_EQ(written.load(), kBacklog + 1);
+    EXPECT_EQ(error_position.load(), kBacklog + 1);
+
+    log::LoggerStats stats = logger->getStats();
+    EXPECT_TRUE(stats.hybrid);
+    EXPECT_EQ(stats.flush_count, 1u);
+
+    logger->clearSyncLevel();
+    EXPECT_FALSE(logger->isHybrid());
+}
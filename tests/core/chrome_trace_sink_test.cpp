@@ -0,0 +1,127 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "vertexnova/logging/core/chrome_trace_sink.h"
+
+using namespace vne;
+namespace fs = std::filesystem;
+namespace {
+constexpr const char* kTestDir = "trace_test_dir";
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+size_t countOccurrences(const std::string& text, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+}  // namespace
+
+class ChromeTraceSinkTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        fs::remove_all(kTestDir);
+        trace_file_ = std::string(kTestDir) + "/trace.json";
+    }
+
+    void TearDown() override { fs::remove_all(kTestDir); }
+
+   protected:
+    std::string trace_file_;
+};
+
+TEST_F(ChromeTraceSinkTest, ConstructorCreatesDirectoryAndFile) {
+    log::ChromeTraceSink sink(trace_file_);
+    EXPECT_TRUE(fs::exists(trace_file_));
+    EXPECT_EQ(sink.getFileName(), trace_file_);
+}
+
+TEST_F(ChromeTraceSinkTest, WritesCompleteEvent) {
+    {
+        log::ChromeTraceSink sink(trace_file_);
+        sink.logTraceEvent(log::TraceEvent{"frame", "render", log::TracePhase::eComplete, 1500, 2000, 7});
+    }
+
+    std::string content = readFile(trace_file_);
+    EXPECT_EQ(content.front(), '[');
+    EXPECT_NE(content.find("]\n"), std::string::npos);
+    EXPECT_NE(content.find("{\"name\":\"frame\",\"cat\":\"render\",\"ph\":\"X\",\"ts\":1.500,\"dur\":2.000,\"pid\":"),
+              std::string::npos);
+    EXPECT_NE(content.find(",\"tid\":7}"), std::string::npos);
+}
+
+TEST_F(ChromeTraceSinkTest, BeginAndEndEventsHaveNoDuration) {
+    {
+        log::ChromeTraceSink sink(trace_file_);
+        sink.logTraceEvent(log::TraceEvent{"load", "io", log::TracePhase::eBegin, 1000, 0, 1});
+        sink.logTraceEvent(log::TraceEvent{"load", "io", log::TracePhase::eEnd, 4000, 0, 1});
+    }
+
+    std::string content = readFile(trace_file_);
+    EXPECT_NE(content.find("\"ph\":\"B\",\"ts\":1.000,\"pid\""), std::string::npos);
+    EXPECT_NE(content.find("\"ph\":\"E\",\"ts\":4.000,\"pid\""), std::string::npos);
+    EXPECT_EQ(content.find("\"dur\""), std::string::npos);
+    EXPECT_EQ(countOccurrences(content, "},\n{"), 1u);
+}
+
+TEST_F(ChromeTraceSinkTest, EscapesNames) {
+    {
+        log::ChromeTraceSink sink(trace_file_);
+        sink.logTraceEvent(log::TraceEvent{"say \"hi\"\\\n", "c", log::TracePhase::eComplete, 0, 0, 1});
+    }
+
+    std::string content = readFile(trace_file_);
+    EXPECT_NE(content.find("\"name\":\"say \\\"hi\\\"\\\\\\u000a\""), std::string::npos);
+}
+
+TEST_F(ChromeTraceSinkTest, IgnoresPlainLogMessages) {
+    log::SinkStats stats;
+    {
+        log::ChromeTraceSink sink(trace_file_);
+        sink.log("category", log::LogLevel::eInfo, log::TimeStampType::eLocal, "text", "file", "function", 1);
+        stats = sink.getStats();
+    }
+
+    EXPECT_EQ(stats.messages_written, 0u);
+    EXPECT_EQ(readFile(trace_file_), "[\n\n]\n");
+}
+
+TEST_F(ChromeTraceSinkTest, ClonesShareTheOpenFile) {
+    {
+        auto original = std::make_unique<log::ChromeTraceSink>(trace_file_);
+        original->logTraceEvent(log::TraceEvent{"first", "c", log::TracePhase::eComplete, 0, 0, 1});
+        std::unique_ptr<log::ILogSink> clone = original->clone();
+        clone->logTraceEvent(log::TraceEvent{"second", "c", log::TracePhase::eComplete, 0, 0, 2});
+        original.reset();
+        clone->logTraceEvent(log::TraceEvent{"third", "c", log::TracePhase::eComplete, 0, 0, 2});
+    }
+
+    std::string content = readFile(trace_file_);
+    EXPECT_EQ(content.rfind("[\n{\"name\":\"first\"", 0), 0u) << content;
+    EXPECT_NE(content.find("\"name\":\"second\""), std::string::npos) << content;
+    EXPECT_NE(content.find("\"name\":\"third\""), std::string::npos) << content;
+    EXPECT_EQ(countOccurrences(content, "},\n{"), 2u);
+    EXPECT_EQ(countOccurrences(content, "]"), 1u);
+}
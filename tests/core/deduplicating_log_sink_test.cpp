@@ -0,0 +1,163 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/core/deduplicating_log_sink.h"
+#include "vertexnova/logging/log_manager.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vne;
+
+namespace {
+constexpr const char* kLoggerCatName = "TestLogger";
+constexpr const char* kFileName = "TestFile";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+
+/**
+ * @brief Sink that records "<category> <level> <message>" for every message it receives.
+ */
+class RecordingSink : public log::ILogSink {
+   public:
+    explicit RecordingSink(std::vector<std::string>& lines)
+        : lines_(lines) {}
+
+    void log(const std::string& name,
+             log::LogLevel level,
+             log::TimeStampType,
+             const std::string& message,
+             const std::string&,
+             const std::string&,
+             uint32_t) override {
+        lines_.push_back(name + " " + std::to_string(static_cast<int>(level)) + " " + message);
+    }
+
+    void flush() override { ++flushes_; }
+    std::string getPattern() const override { return ""; }
+    void setPattern(const std::string&) override {}
+    std::unique_ptr<ILogSink> clone() const override { return std::make_unique<RecordingSink>(lines_); }
+
+    size_t getFlushCount() const { return flushes_; }
+
+   private:
+    std::vector<std::string>& lines_;
+    size_t flushes_ = 0;
+};
+
+void logMessage(log::ILogSink& sink,
+                const std::string& message,
+                log::LogLevel level = log::LogLevel::eError,
+                const std::string& category = kLoggerCatName) {
+    sink.log(category, level, log::TimeStampType::eLocal, message, kFileName, kFunctionName, kLineNumber);
+}
+}  // namespace
+
+TEST(DeduplicatingLogSinkTest, CollapsesRunIntoCount) {
+    std::vector<std::string> lines;
+    log::DeduplicatingLogSink sink(std::make_unique<RecordingSink>(lines));
+    for (int i = 0; i < 1000; ++i) {
+        logMessage(sink, "connect failed");
+    }
+    logMessage(sink, "giving up");
+
+    EXPECT_EQ(lines,
+              (std::vector<std::string>{"TestLogger 4 connect failed",
+                                        "TestLogger 4 last message repeated 999 times",
+                                        "TestLogger 4 giving up"}));
+    EXPECT_EQ(sink.getSuppressedCount(), 999u);
+}
+
+TEST(DeduplicatingLogSinkTest, CategoryAndLevelArePartOfTheMessage) {
+    std::vector<std::string> lines;
+    log::DeduplicatingLogSink sink(std::make_unique<RecordingSink>(lines));
+    logMessage(sink, "retry");
+    logMessage(sink, "retry", log::LogLevel::eWarn);
+    logMessage(sink, "retry", log::LogLevel::eWarn, "Other");
+    logMessage(sink, "retry", log::LogLevel::eWarn, "Other");
+
+    EXPECT_EQ(lines, (std::vector<std::string>{"TestLogger 4 retry", "TestLogger 3 retry", "Other 3 retry"}));
+    EXPECT_EQ(sink.getSuppressedCount(), 1u);
+}
+
+TEST(DeduplicatingLogSinkTest, ReportsLongRunsEveryWindow) {
+    std::vector<std::string> lines;
+    log::DeduplicatingLogSink sink(std::make_unique<RecordingSink>(lines), std::chrono::milliseconds(50));
+    logMessage(sink, "spinning");
+    logMessage(sink, "spinning");
+    logMessage(sink, "spinning");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // The first repeat after the window reports the repeats so far, itself included
+    logMessage(sink, "spinning");
+    logMessage(sink, "spinning");
+
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[1], "TestLogger 4 last message repeated 3 times");
+    logMessage(sink, "done");
+    ASSERT_EQ(lines.size(), 4u);
+    EXPECT_EQ(lines[2], "TestLogger 4 last message repeated 1 time");
+}
+
+TEST(DeduplicatingLogSinkTest, FlushReportsOnlyAfterTheWindow) {
+    std::vector<std::string> lines;
+    auto recording = std::make_unique<RecordingSink>(lines);
+    RecordingSink& target = *recording;
+    log::DeduplicatingLogSink sink(std::move(recording), std::chrono::milliseconds(50));
+    logMessage(sink, "disk full");
+    logMessage(sink, "disk full");
+
+    // A flush level of error must not end the run on every message
+    sink.flush();
+    EXPECT_EQ(lines.size(), 1u);
+    EXPECT_EQ(target.getFlushCount(), 1u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    sink.flush();
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[1], "TestLogger 4 last message repeated 1 time");
+
+    // The run goes on: the next repeat is still suppressed
+    logMessage(sink, "disk full");
+    EXPECT_EQ(lines.size(), 2u);
+}
+
+TEST(DeduplicatingLogSinkTest, DestructionReportsPendingRepeats) {
+    std::vector<std::string> lines;
+    {
+        log::DeduplicatingLogSink sink(std::make_unique<RecordingSink>(lines));
+        logMessage(sink, "timeout");
+        logMessage(sink, "timeout");
+        logMessage(sink, "timeout");
+    }
+    EXPECT_EQ(lines, (std::vector<std::string>{"TestLogger 4 timeout", "TestLogger 4 last message repeated 2 times"}));
+}
+
+TEST(DeduplicatingLogSinkTest, LogManagerWrapsAnySink) {
+    log::LogManager manager;
+    manager.createLogger("deduplicated", false);
+    manager.addDeduplicatedSink("deduplicated",
+                                std::make_unique<log::IsolatedLogSink>(std::make_unique<log::ConsoleLogSink>()),
+                                std::chrono::seconds(30));
+    manager.setConsolePattern("deduplicated", "%x [%l] %v");
+
+    auto logger = manager.getLogger("deduplicated");
+    ASSERT_EQ(logger->getLogSinks().size(), 1u);
+    auto* deduplicating = dynamic_cast<log::DeduplicatingLogSink*>(logger->getLogSinks().front().get());
+    ASSERT_NE(deduplicating, nullptr);
+    auto* isolated = dynamic_cast<log::IsolatedLogSink*>(&deduplicating->getWrappedSink());
+    ASSERT_NE(isolated, nullptr);
+    EXPECT_EQ(isolated->getWrappedSink().getPattern(), "%x [%l] %v");
+}
@@ -0,0 +1,153 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/emergency_log.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if !defined(_WIN32)
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace vne;
+namespace fs = std::filesystem;
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("emergency.test");
+
+constexpr const char* kTestDir = "emergency_test_dir";
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+}
+}  // namespace
+
+class EmergencyLogTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        fs::remove_all(kTestDir);
+        fs::create_directory(kTestDir);
+        log_file_ = std::string(kTestDir) + "/emergency.log";
+    }
+
+    void TearDown() override { fs::remove_all(kTestDir); }
+
+   protected:
+    std::string log_file_;
+};
+
+TEST_F(EmergencyLogTest, FormatsValuesIntoTheSinkFile) {
+    {
+        log::FileLogSink sink(log_file_, false);
+        VNE_LOG_EMERGENCY << "values " << 42 << ' ' << -7 << ' ' << 3.25 << ' ' << true << ' ' << std::string("str")
+                          << ' ' << static_cast<unsigned long long>(18446744073709551615ULL);
+    }
+    std::string text = readFile(log_file_);
+    EXPECT_NE(text.find(" UTC [FATAL] [emergency.test] values 42 -7 3.250000 true str 18446744073709551615 ("
+                        "emergency_log_test.cpp:"),
+              std::string::npos)
+        << text;
+    EXPECT_EQ(text.back(), '\n');
+    EXPECT_EQ(text.find("1970"), std::string::npos) << text;
+}
+
+TEST_F(EmergencyLogTest, FormatsEdgeValues) {
+    {
+        log::FileLogSink sink(log_file_, false);
+        VNE_LOG_EMERGENCY_C("edge", log::LogLevel::eError)
+            << static_cast<long long>(INT64_MIN) << ' ' << 1e20 << ' ' << -0.5 << ' ' << static_cast<const char*>(nullptr)
+            << ' ' << reinterpret_cast<const void*>(0x1f);
+    }
+    std::string text = readFile(log_file_);
+    EXPECT_NE(text.find("[ERROR] [edge] -9223372036854775808 1.000000e+20 -0.500000 (null) 0x"), std::string::npos)
+        << text;
+    EXPECT_NE(text.find("1f ("), std::string::npos) << text;
+}
+
+TEST_F(EmergencyLogTest, LongMessagesAreCut) {
+    {
+        log::FileLogSink sink(log_file_, false);
+        VNE_LOG_EMERGENCY << std::string(2 * log::kEmergencyBufferSize, 'x');
+    }
+    std::string text = readFile(log_file_);
+    EXPECT_EQ(text.size(), log::kEmergencyBufferSize);
+    EXPECT_EQ(text.back(), '\n');
+}
+
+TEST_F(EmergencyLogTest, StreamWritesAreNotOverwritten) {
+    {
+        log::FileLogSink sink(log_file_, false);
+        sink.log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "first", "file", "fn", 1);
+        sink.flush();
+        VNE_LOG_EMERGENCY << "emergency";
+        sink.log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "second", "file", "fn", 2);
+    }
+    std::string text = readFile(log_file_);
+    EXPECT_NE(text.find("first"), std::string::npos) << text;
+    EXPECT_NE(text.find("emergency"), std::string::npos) << text;
+    EXPECT_NE(text.find("second"), std::string::npos) << text;
+}
+
+TEST_F(EmergencyLogTest, ReopenMovesTheDescriptor) {
+    const std::string rotated = log_file_ + ".1";
+    log::FileLogSink sink(log_file_);
+    fs::rename(log_file_, rotated);
+    sink.reopen();
+    VNE_LOG_EMERGENCY << "after reopen";
+    EXPECT_NE(readFile(log_file_).find("after reopen"), std::string::npos);
+    EXPECT_EQ(readFile(rotated).find("after reopen"), std::string::npos);
+}
+
+#if !defined(_WIN32)
+
+namespace {
+void emergencyFromHandler(int signal_number) {
+    VNE_LOG_EMERGENCY_C("signal", log::LogLevel::eWarn) << "caught signal " << signal_number;
+}
+}  // namespace
+
+TEST_F(EmergencyLogTest, WritesFromSignalHandlerToRegisteredFd) {
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    ASSERT_TRUE(log::EmergencyLog::registerFd(fds[1]));
+
+    struct sigaction action {};
+    struct sigaction previous {};
+    action.sa_handler = &emergencyFromHandler;
+    sigemptyset(&action.sa_mask);
+    ::sigaction(SIGUSR1, &action, &previous);
+    std::raise(SIGUSR1);
+    ::sigaction(SIGUSR1, &previous, nullptr);
+    log::EmergencyLog::unregisterFd(fds[1]);
+
+    char buffer[log::kEmergencyBufferSize + 1] = {};
+    ::fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    ssize_t received = ::read(fds[0], buffer, log::kEmergencyBufferSize);
+    ::close(fds[0]);
+    ::close(fds[1]);
+    ASSERT_GT(received, 0);
+    std::string line(buffer, static_cast<size_t>(received));
+    EXPECT_NE(line.find("[WARN] [signal] caught signal " + std::to_string(SIGUSR1)), std::string::npos) << line;
+}
+
+#endif
@@ -0,0 +1,255 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "mocks/log_sink_mock.h"
+#include "vertexnova/logging/core/isolated_log_sink.h"
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/log_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+using namespace vne;
+using ::testing::_;
+using ::testing::Invoke;
+
+namespace {
+constexpr const char* kLoggerCatName = "TestLogger";
+constexpr const char* kFileName = "TestFile";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+
+/**
+ * @brief Sink that counts messages and, while closed, holds the writing thread until it is opened.
+ */
+class GatedSink : public log::ILogSink {
+   public:
+    GatedSink(std::atomic<size_t>& written, std::shared_future<void> gate)
+        : written_(written)
+        , gate_(std::move(gate)) {}
+
+    void log(const std::string&,
+             log::LogLevel,
+             log::TimeStampType,
+             const std::string&,
+             const std::string&,
+             const std::string&,
+             uint32_t) override {
+        gate_.wait();
+        written_.fetch_add(1);
+    }
+
+    void flush() override {}
+    std::string getPattern() const override { return ""; }
+    void setPattern(const std::string&) override {}
+    std::unique_ptr<ILogSink> clone() const override { return std::make_unique<GatedSink>(written_, gate_); }
+
+   private:
+    std::atomic<size_t>& written_;
+    std::shared_future<void> gate_;
+};
+
+void logMessage(log::ILogSink& sink, log::LogLevel level = log::LogLevel::eInfo) {
+    sink.log(kLoggerCatName, level, log::TimeStampType::eLocal, "message", kFileName, kFunctionName, kLineNumber);
+}
+
+/**
+ * @brief Waits until the sink's worker has written every buffered message; false on timeout.
+ */
+bool waitUntilWritten(const log::IsolatedLogSink& sink) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sink.getBufferedCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return sink.getBufferedCount() == 0;
+}
+}  // namespace
+
+TEST(IsolatedLogSinkTest, SlowSinkDoesNotDelayOtherSinks) {
+    constexpr size_t kMessages = 20;
+    std::atomic<size_t> slow_written{0};
+    std::atomic<size_t> fast_written{0};
+
+    auto slow_sink = std::make_unique<log::LogSinkMock>();
+    EXPECT_CALL(*slow_sink, log(_, _, _, _, _, _, _)).WillRepeatedly(Invoke([&slow_written](auto&&...) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        slow_written.fetch_add(1);
+    }));
+    EXPECT_CALL(*slow_sink, flush()).Times(::testing::AnyNumber());
+
+    std::promise<void> open;
+    open.set_value();
+    {
+        // The default flush level makes every error below flush the sinks
+        log::AsyncLogger logger("IsolatedTestLogger");
+        logger.addLogSink(std::make_unique<log::IsolatedLogSink>(std::move(slow_sink)));
+        logger.addLogSink(std::make_unique<GatedSink>(fast_written, open.get_future().share()));
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kMessages; ++i) {
+            logger.log(kLoggerCatName,
+                       log::LogLevel::eError,
+                       log::TimeStampType::eLocal,
+                       "message",
+                       kFileName,
+                       kFunctionName,
+                       kLineNumber);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        // The slow sink needs a second for all messages; neither the caller nor the fast sink waited for it
+        EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+        EXPECT_EQ(fast_written.load(), kMessages);
+        EXPECT_LT(slow_written.load(), kMessages);
+    }
+    // Destruction waits for the isolated sink's buffer
+    EXPECT_EQ(slow_written.load(), kMessages);
+}
+
+TEST(IsolatedLogSinkTest, FlushDoesNotWaitForTheSink) {
+    std::atomic<size_t> written{0};
+    std::promise<void> open;
+    log::IsolatedLogSink sink(std::make_unique<GatedSink>(written, open.get_future().share()));
+
+    logMessage(sink);
+    auto flushed = std::async(std::launch::async, [&sink] {
+        for (int i = 0; i < 100; ++i) {
+            sink.flush();
+        }
+    });
+    EXPECT_EQ(flushed.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(written.load(), 0u);
+
+    open.set_value();
+    EXPECT_TRUE(waitUntilWritten(sink));
+    EXPECT_EQ(written.load(), 1u);
+}
+
+TEST(IsolatedLogSinkTest, FlushAfterANewMessageIsNotFolded) {
+    auto mock = std::make_unique<log::LogSinkMock>();
+    log::LogSinkMock& wrapped = *mock;
+    std::promise<void> open;
+    std::shared_future<void> gate = open.get_future().share();
+    EXPECT_CALL(*mock, log(_, _, _, _, _, _, _)).WillRepeatedly(Invoke([gate](auto&&...) { gate.wait(); }));
+    // The second request folds into the first; the third follows a message and so needs a flush of its own
+    EXPECT_CALL(*mock, flush()).Times(2);
+
+    log::IsolatedLogSink sink(std::move(mock));
+    logMessage(sink);
+    sink.flush();
+    sink.flush();
+    logMessage(sink);
+    sink.flush();
+
+    open.set_value();
+    // Waits for the worker to run the queued flushes
+    sink.reopen();
+    EXPECT_TRUE(::testing::Mock::VerifyAndClearExpectations(&wrapped));
+    // The destructor flushes once more
+    EXPECT_CALL(wrapped, flush()).Times(::testing::AnyNumber());
+}
+
+TEST(IsolatedLogSinkTest, DropNewestDiscardsWhenFull) {
+    std::atomic<size_t> written{0};
+    std::promise<void> open;
+    log::SinkBufferOptions options;
+    options.capacity = 2;
+    options.overflow = log::OverflowPolicy::eDropNewest;
+    log::IsolatedLogSink sink(std::make_unique<GatedSink>(written, open.get_future().share()), options);
+
+    // The first message holds the worker, the second waits behind it; the rest do not fit
+    for (int i = 0; i < 5; ++i) {
+        logMessage(sink);
+    }
+    EXPECT_EQ(sink.getBufferedCount(), 2u);
+    EXPECT_EQ(sink.getStats().dropped, 3u);
+
+    open.set_value();
+    EXPECT_TRUE(waitUntilWritten(sink));
+    EXPECT_EQ(written.load(), 2u);
+
+    sink.resetStats();
+    EXPECT_EQ(sink.getStats().dropped, 0u);
+}
+
+TEST(IsolatedLogSinkTest, BlockWaitsForRoom) {
+    std::atomic<size_t> written{0};
+    std::promise<void> open;
+    log::SinkBufferOptions options;
+    options.capacity = 1;
+    options.overflow = log::OverflowPolicy::eBlock;
+    log::IsolatedLogSink sink(std::make_unique<GatedSink>(written, open.get_future().share()), options);
+
+    logMessage(sink);
+    auto blocked = std::async(std::launch::async, [&sink] { logMessage(sink); });
+    EXPECT_EQ(blocked.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+
+    open.set_value();
+    EXPECT_EQ(blocked.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(waitUntilWritten(sink));
+    EXPECT_EQ(written.load(), 2u);
+    EXPECT_EQ(sink.getStats().dropped, 0u);
+}
+
+TEST(IsolatedLogSinkTest, FlushAndReopenRunAfterBufferedMessages) {
+    auto mock = std::make_unique<log::LogSinkMock>();
+    std::atomic<size_t> written{0};
+    EXPECT_CALL(*mock, log(_, _, _, _, _, _, _)).WillRepeatedly(Invoke([&written](auto&&...) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        written.fetch_add(1);
+    }));
+    EXPECT_CALL(*mock, flush()).WillRepeatedly(Invoke([&written] { EXPECT_EQ(written.load(), 3u); }));
+
+    log::IsolatedLogSink sink(std::move(mock));
+    for (int i = 0; i < 3; ++i) {
+        logMessage(sink);
+    }
+    sink.flush();
+    sink.reopen();
+    EXPECT_EQ(written.load(), 3u);
+}
+
+TEST(IsolatedLogSinkTest, DefaultsToDroppingWhenFull) {
+    log::SinkBufferOptions options;
+    EXPECT_EQ(options.overflow, log::OverflowPolicy::eDropNewest);
+}
+
+TEST(IsolatedLogSinkTest, CloneKeepsOptions) {
+    log::SinkBufferOptions options;
+    options.capacity = 16;
+    options.overflow = log::OverflowPolicy::eDropNewest;
+    log::IsolatedLogSink sink(std::make_unique<log::ConsoleLogSink>(), options);
+
+    auto cloned = sink.clone();
+    auto* isolated = dynamic_cast<log::IsolatedLogSink*>(cloned.get());
+    ASSERT_NE(isolated, nullptr);
+    EXPECT_EQ(isolated->getOptions().capacity, 16u);
+    EXPECT_EQ(isolated->getOptions().overflow, log::OverflowPolicy::eDropNewest);
+    EXPECT_NE(dynamic_cast<log::ConsoleLogSink*>(&isolated->getWrappedSink()), nullptr);
+}
+
+TEST(IsolatedLogSinkTest, LogManagerPatternsReachWrappedSinks) {
+    log::LogManager manager;
+    manager.createLogger("isolated", true);
+    manager.addConsoleSink("isolated", log::SinkBufferOptions{});
+    manager.setConsolePattern("isolated", "%x [%l] %v");
+
+    auto logger = manager.getLogger("isolated");
+    ASSERT_EQ(logger->getLogSinks().size(), 1u);
+    auto* isolated = dynamic_cast<log::IsolatedLogSink*>(logger->getLogSinks().front().get());
+    ASSERT_NE(isolated, nullptr);
+    EXPECT_EQ(isolated->getWrappedSink().getPattern(), "%x [%l] %v");
+}
@@ -0,0 +1,220 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "mocks/log_sink_mock.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace vne;
+using ::testing::_;
+
+namespace {
+
+CREATE_VNE_LOGGER_CATEGORY("profile.test");
+
+constexpr const char* kLoggerName = "profile_logger";
+
+/**
+ * @brief Returns the profile entries recorded from this file.
+ */
+std::vector<log::CallSiteProfile> profileOfThisFile() {
+    std::vector<log::CallSiteProfile> sites;
+    for (const log::CallSiteProfile& site : log::Logging::getLogProfile()) {
+        if (site.file == __FILE__) {
+            sites.push_back(site);
+        }
+    }
+    return sites;
+}
+
+}  // namespace
+
+class LogCallSiteTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        log::LoggerController::unregisterAllLoggers();
+        auto logger = std::make_shared<log::SyncLogger>(kLoggerName);
+        auto sink = std::make_unique<::testing::NiceMock<log::LogSinkMock>>();
+        sink_ = sink.get();
+        logger->addLogSink(std::move(sink));
+        logger->setCurrentLogLevel(log::LogLevel::eInfo);
+        log::LoggerController::registerLogger(logger);
+        log::Logging::resetLogProfile();
+        log::Logging::setLogProfilingEnabled(true);
+    }
+
+    void TearDown() override {
+        log::Logging::resetCallSites();
+        log::Logging::setLogProfilingEnabled(false);
+        log::Logging::resetLogProfile();
+        log::LoggerController::unregisterAllLoggers();
+    }
+
+    /**
+     * @brief Returns a spec selecting one line of this file.
+     */
+    static std::string specForLine(uint32_t line) { return "core/log_call_site_test.cpp:" + std::to_string(line); }
+
+    log::LogSinkMock* sink_ = nullptr;
+};
+
+TEST_F(LogCallSiteTest, CountsMessagesAndBytesPerStatement) {
+    for (int i = 0; i < 3; ++i) {
+        VNE_LOG_INFO_L(kLoggerName) << "12345";
+    }
+    const uint32_t warn_line = __LINE__ + 1;
+    VNE_LOG_WARN_LC(kLoggerName, "profile.other") << "1234567890";
+
+    std::vector<log::CallSiteProfile> sites = profileOfThisFile();
+    ASSERT_EQ(sites.size(), 2u);
+
+    EXPECT_EQ(sites[0].messages, 3u);
+    EXPECT_EQ(sites[0].bytes, 15u);
+    EXPECT_EQ(sites[0].category, "profile.test");
+    EXPECT_EQ(sites[0].level, log::LogLevel::eInfo);
+
+    EXPECT_EQ(sites[1].messages, 1u);
+    EXPECT_EQ(sites[1].bytes, 10u);
+    EXPECT_EQ(sites[1].category, "profile.other");
+    EXPECT_EQ(sites[1].level, log::LogLevel::eWarn);
+    EXPECT_EQ(sites[1].line, warn_line);
+}
+
+TEST_F(LogCallSiteTest, FilteredAndUnprofiledMessagesAreNotCounted) {
+    VNE_LOG_DEBUG_L(kLoggerName) << "below the logger level";
+
+    log::Logging::setLogProfilingEnabled(false);
+    VNE_LOG_INFO_L(kLoggerName) << "profiling disabled";
+
+    EXPECT_TRUE(profileOfThisFile().empty());
+}
+
+TEST_F(LogCallSiteTest, ResetClearsCounters) {
+    VNE_LOG_INFO_L(kLoggerName) << "counted";
+    ASSERT_EQ(profileOfThisFile().size(), 1u);
+
+    log::Logging::resetLogProfile();
+
+    EXPECT_TRUE(profileOfThisFile().empty());
+}
+
+TEST_F(LogCallSiteTest, DumpPrintsTopStatements) {
+    for (int i = 0; i < 4; ++i) {
+        VNE_LOG_INFO_L(kLoggerName) << "noisy statement";
+    }
+    VNE_LOG_ERROR_LC(kLoggerName, "profile.quiet") << "quiet";
+
+    std::ostringstream out;
+    log::Logging::dumpLogProfile(out, 1);
+    const std::string table = out.str();
+
+    EXPECT_NE(table.find("Log profile: 5 messages, 65 bytes from 2 statements"), std::string::npos);
+    EXPECT_NE(table.find("profile.test"), std::string::npos);
+    EXPECT_NE(table.find("INFO"), std::string::npos);
+    EXPECT_EQ(table.find("profile.quiet"), std::string::npos);
+}
+
+TEST_F(LogCallSiteTest, DisabledCallSiteSkipsMessageAndArguments) {
+    int evaluated = 0;
+    auto logOnce = [&]() {
+        VNE_LOG_INFO_L(kLoggerName) << "value " << ++evaluated;
+    };
+    const uint32_t line = __LINE__ - 2;
+    logOnce();
+    EXPECT_EQ(evaluated, 1);
+
+    EXPECT_EQ(log::Logging::disableCallSites("*log_call_site_test.cpp:" + std::to_string(line)), 1u);
+    EXPECT_CALL(*sink_, log(_, _, _, _, _, _, _)).Times(0);
+    logOnce();
+
+    EXPECT_EQ(evaluated, 1);
+}
+
+TEST_F(LogCallSiteTest, EnabledCallSiteBypassesLoggerLevel) {
+    const uint32_t enabled_line = __LINE__ + 3;
+    log::Logging::enableCallSites(specForLine(enabled_line));
+    EXPECT_CALL(*sink_, log(_, log::LogLevel::eTrace, _, "enabled trace", _, _, enabled_line)).Times(1);
+    VNE_LOG_TRACE_L(kLoggerName) << "enabled trace";
+    VNE_LOG_TRACE_L(kLoggerName) << "other trace";
+}
+
+TEST_F(LogCallSiteTest, RulesApplyToLineRangesAndLaterRulesWin) {
+    const uint32_t first_line = __LINE__ + 4;
+    log::Logging::enableCallSites(specForLine(first_line) + "-" + std::to_string(first_line + 1));
+    log::Logging::disableCallSites(specForLine(first_line + 1));
+    EXPECT_CALL(*sink_, log(_, _, _, "first", _, _, first_line)).Times(1);
+    VNE_LOG_DEBUG_L(kLoggerName) << "first";
+    VNE_LOG_ERROR_L(kLoggerName) << "second";
+
+    std::vector<log::CallSiteProfile> sites = log::Logging::getCallSites();
+    auto second = std::find_if(sites.begin(), sites.end(), [&](const log::CallSiteProfile& site) {
+        return site.file == __FILE__ && site.line == first_line + 1;
+    });
+    ASSERT_NE(second, sites.end());
+    EXPECT_EQ(second->state, log::CallSiteState::eDisabled);
+    EXPECT_EQ(second->function, "TestBody");
+}
+
+TEST_F(LogCallSiteTest, RepeatedRulesReplaceEachOther) {
+    for (int i = 0; i < 100; ++i) {
+        log::LogCallSite::applyCategoryLevel("profile.test", i % 2 ? log::LogLevel::eTrace : log::LogLevel::eWarn);
+        log::Logging::disableCallSites("log_call_site_test.cpp:10-20");
+    }
+    EXPECT_EQ(log::LogCallSite::getRuleCount(), 2u);
+
+    // Re-applying a rule moves it behind the others, so it still wins
+    log::Logging::enableCallSites("log_call_site_test.cpp");
+    log::Logging::disableCallSites("log_call_site_test.cpp:10-20");
+    log::Logging::disableCallSites("log_call_site_test.cpp");
+    EXPECT_EQ(log::LogCallSite::getRuleCount(), 3u);
+    EXPECT_CALL(*sink_, log(_, _, _, _, _, _, _)).Times(0);
+    VNE_LOG_INFO_L(kLoggerName) << "disabled";
+}
+
+TEST_F(LogCallSiteTest, ResetRestoresLoggerLevel) {
+    log::Logging::disableCallSites("log_call_site_test.cpp");
+    log::Logging::resetCallSites();
+    EXPECT_CALL(*sink_, log(_, _, _, "after reset", _, _, _)).Times(1);
+    VNE_LOG_INFO_L(kLoggerName) << "after reset";
+}
+
+TEST_F(LogCallSiteTest, MalformedSpecMatchesNothing) {
+    VNE_LOG_INFO_L(kLoggerName) << "registered";
+    EXPECT_EQ(log::Logging::disableCallSites("log_call_site_test.cpp:20-10"), 0u);
+    EXPECT_EQ(log::Logging::disableCallSites(":10"), 0u);
+    EXPECT_EQ(log::Logging::disableCallSites("other_file.cpp"), 0u);
+    EXPECT_EQ(log::Logging::disableCallSites("site_test.cpp"), 0u);
+}
+
+TEST_F(LogCallSiteTest, TrailingElseBindsToTheCallersIf) {
+    bool else_taken = false;
+    const bool condition = false;
+    if (condition)
+        VNE_LOG_INFO_L(kLoggerName) << "not reached";
+    else
+        else_taken = true;
+
+    EXPECT_TRUE(else_taken);
+
+    // Unbraced, without an else of its own: must not warn under -Wdangling-else (part of -Wall)
+    EXPECT_CALL(*sink_, log(_, _, _, "reached", _, _, _)).Times(1);
+    if (!condition)
+        VNE_LOG_INFO_L(kLoggerName) << "reached";
+}
@@ -0,0 +1,196 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/log_crash_handler.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "mocks/log_sink_mock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace vne;
+namespace fs = std::filesystem;
+
+namespace {
+constexpr const char* kTestDir = "crash_test_dir";
+constexpr int kMessages = 2000;
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+}
+
+size_t countLines(const std::string& text) {
+    return static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+}
+
+/**
+ * @brief Starts crash handling, then logs one message through an async logger.
+ *
+ * Exits with code 0 if the message was counted as dropped, 1 otherwise.
+ */
+void logWhileCrashing(const std::string& log_file) {
+    auto* logger = new log::AsyncLogger("crash.dropped");
+    logger->addLogSink(std::make_unique<log::FileLogSink>(log_file, false));
+    log::LogCrashHandler::handleCrash(SIGSEGV);
+    logger->log("crash", log::LogLevel::eWarn, log::TimeStampType::eLocal, "too late", "file", "fn", 1);
+    const log::LoggerStats stats = logger->getStats();
+    std::_Exit(stats.dropped[static_cast<size_t>(log::LogLevel::eWarn)] == 1 && stats.totalDropped() == 1 ? 0 : 1);
+}
+
+/**
+ * @brief Logs kMessages through an async logger with a file sink, then crashes with the signal.
+ */
+void logAndCrash(const std::string& log_file, const std::string& crash_file, int signal_number) {
+    log::CrashHandlerOptions options;
+    options.crash_file = crash_file;
+    log::LogCrashHandler::install(options);
+
+    // Leaked on purpose: the process dies with the messages still queued
+    auto* logger = new log::AsyncLogger("crash.test");
+    logger->setFlushLevel(log::LogLevel::eFatal);
+    logger->addLogSink(std::make_unique<log::FileLogSink>(log_file, false));
+    for (int i = 0; i < kMessages; ++i) {
+        logger->log("crash", log::LogLevel::eInfo, log::TimeStampType::eLocal, "queued message", "file", "fn", 1);
+    }
+    if (signal_number == 0) {
+        // As for an uncaught exception; a plain throw would be caught by gtest
+        try {
+            throw std::runtime_error("boom");
+        } catch (...) {
+            std::terminate();
+        }
+    }
+    std::raise(signal_number);
+}
+}  // namespace
+
+class LogCrashHandlerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        if (!log::LogCrashHandler::install()) {
+            GTEST_SKIP() << "Crash handling is not supported on this platform";
+        }
+        log::LogCrashHandler::uninstall();
+        ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+        fs::remove_all(kTestDir);
+        fs::create_directory(kTestDir);
+        log_file_ = std::string(kTestDir) + "/crash.log";
+        crash_file_ = std::string(kTestDir) + "/crash.txt";
+    }
+
+    void TearDown() override { fs::remove_all(kTestDir); }
+
+   protected:
+    std::string log_file_;
+    std::string crash_file_;
+};
+
+TEST_F(LogCrashHandlerTest, InstallIsExclusive) {
+    EXPECT_FALSE(log::LogCrashHandler::isInstalled());
+    ASSERT_TRUE(log::LogCrashHandler::install());
+    EXPECT_TRUE(log::LogCrashHandler::isInstalled());
+    EXPECT_FALSE(log::LogCrashHandler::install());
+    log::LogCrashHandler::uninstall();
+    EXPECT_FALSE(log::LogCrashHandler::isInstalled());
+    EXPECT_FALSE(log::LogCrashHandler::isCrashing());
+}
+
+TEST_F(LogCrashHandlerTest, SyncLoggerDrainFlushesSinks) {
+    log::SyncLogger logger("crash.sync");
+    logger.addLogSink(std::make_unique<log::FileLogSink>(log_file_, false));
+    logger.log("crash", log::LogLevel::eInfo, log::TimeStampType::eLocal, "buffered", "file", "fn", 1);
+    EXPECT_TRUE(logger.drainOnCrash(std::chrono::steady_clock::now() + std::chrono::seconds(1)));
+    EXPECT_NE(readFile(log_file_).find("buffered"), std::string::npos);
+}
+
+TEST_F(LogCrashHandlerTest, SyncLoggerDrainSkipsALockHeldByTheCrashingThread) {
+    log::SyncLogger logger("crash.sync.owner");
+    auto sink = std::make_unique<log::LogSinkMock>();
+    bool drained = true;
+    auto started = std::chrono::steady_clock::now();
+    // As if the thread crashed inside a sink write and the handler drained from there
+    using ::testing::_;
+    EXPECT_CALL(*sink, log(_, _, _, _, _, _, _))
+        .WillOnce([&] { drained = logger.drainOnCrash(std::chrono::steady_clock::now() + std::chrono::seconds(10)); });
+    logger.addLogSink(std::move(sink));
+    logger.log("crash", log::LogLevel::eInfo, log::TimeStampType::eLocal, "writing", "file", "fn", 1);
+
+    EXPECT_FALSE(drained);
+    EXPECT_LT(std::chrono::steady_clock::now() - started, std::chrono::seconds(5));
+}
+
+TEST_F(LogCrashHandlerTest, FatalSignalDrainsQueuedMessages) {
+    ASSERT_EXIT(logAndCrash(log_file_, crash_file_, SIGSEGV), ::testing::KilledBySignal(SIGSEGV), "SIGSEGV");
+
+    EXPECT_EQ(countLines(readFile(log_file_)), static_cast<size_t>(kMessages));
+    std::string record = readFile(crash_file_);
+    EXPECT_NE(record.find("fatal signal SIGSEGV (11)"), std::string::npos) << record;
+    EXPECT_NE(record.find("loggers drained: 1, timed out: 0"), std::string::npos) << record;
+    EXPECT_NE(record.find("end of crash record"), std::string::npos) << record;
+    // The backtrace is out before the drain starts
+    EXPECT_LT(record.find("backtrace:"), record.find("loggers drained"));
+}
+
+TEST_F(LogCrashHandlerTest, AbortDrainsQueuedMessages) {
+    ASSERT_EXIT(logAndCrash(log_file_, crash_file_, SIGABRT), ::testing::KilledBySignal(SIGABRT), "SIGABRT");
+
+    EXPECT_EQ(countLines(readFile(log_file_)), static_cast<size_t>(kMessages));
+}
+
+TEST_F(LogCrashHandlerTest, UncaughtExceptionDrainsQueuedMessages) {
+    ASSERT_EXIT(logAndCrash(log_file_, crash_file_, 0), ::testing::KilledBySignal(SIGABRT), "std::terminate");
+
+    EXPECT_EQ(countLines(readFile(log_file_)), static_cast<size_t>(kMessages));
+    std::string record = readFile(crash_file_);
+    EXPECT_NE(record.find("uncaught exception: boom"), std::string::npos) << record;
+    // The abort raised by std::terminate must not produce a second record
+    EXPECT_EQ(record.find("SIGABRT"), std::string::npos) << record;
+}
+
+TEST_F(LogCrashHandlerTest, MessagesLoggedWhileCrashingAreCountedAsDropped) {
+    EXPECT_EXIT(logWhileCrashing(log_file_), ::testing::ExitedWithCode(0), "");
+
+    EXPECT_EQ(readFile(log_file_).find("too late"), std::string::npos);
+}
+
+TEST_F(LogCrashHandlerTest, RegistryOverflowIsReportedOnce) {
+    std::stringstream errors;
+    std::streambuf* old_buffer = std::cerr.rdbuf(errors.rdbuf());
+    {
+        std::vector<std::unique_ptr<log::SyncLogger>> loggers;
+        for (int i = 0; i < 80; ++i) {
+            loggers.push_back(std::make_unique<log::SyncLogger>("crash.registry." + std::to_string(i)));
+        }
+    }
+    std::cerr.rdbuf(old_buffer);
+
+    const std::string text = errors.str();
+    EXPECT_NE(text.find("the crash handler will not drain"), std::string::npos) << text;
+    EXPECT_EQ(text.find("the crash handler will not drain"), text.rfind("the crash handler will not drain"));
+}
@@ -16,7 +16,11 @@
 #include "vertexnova/logging/core/log_formatter.h"
 #include "mocks/log_sink_mock.h"
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 
 using namespace vne;
 class LogDispatcherTest : public ::testing::Test {
@@ -73,3 +77,119 @@ TEST_F(LogDispatcherTest, TestDispatchAndFlush) {
     EXPECT_CALL(*dynamic_cast<log::LogSinkMock*>(log_sinks_[1].get()), flush());
     dispatcher.flush(log_sinks_);
 }
+
+namespace {
+/**
+ * @brief Sink that records the threads it is called from.
+ */
+class ThreadRecordingSink : public log::ILogSink {
+   public:
+    void log(const std::string&,
+             log::LogLevel,
+             log::TimeStampType,
+             const std::string&,
+             const std::string&,
+             const std::string&,
+             uint32_t) override {
+        record();
+    }
+
+    void flush() override { record(); }
+    std::string getPattern() const override { return ""; }
+    void setPattern(const std::string&) override {}
+    std::unique_ptr<ILogSink> clone() const override { return std::make_unique<ThreadRecordingSink>(); }
+
+    size_t getThreadCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return threads_.size();
+    }
+
+   private:
+    void record() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        threads_.insert(std::this_thread::get_id());
+    }
+
+    mutable std::mutex mutex_;
+    std::set<std::thread::id> threads_;
+};
+
+/**
+ * @brief Sink that runs a callback for each message and counts its reopens.
+ */
+class CallbackSink : public log::ILogSink {
+   public:
+    void log(const std::string&,
+             log::LogLevel,
+             log::TimeStampType,
+             const std::string&,
+             const std::string&,
+             const std::string&,
+             uint32_t) override {
+        on_log();
+    }
+
+    void flush() override {}
+    void reopen() override { ++reopens; }
+    std::string getPattern() const override { return ""; }
+    void setPattern(const std::string&) override {}
+    std::unique_ptr<ILogSink> clone() const override { return std::make_unique<CallbackSink>(); }
+
+    std::function<void()> on_log = [] {};
+    int reopens = 0;
+};
+}  // namespace
+
+TEST(LogDispatcherThreadTest, FlushRunsOnTheWorker) {
+    std::vector<std::unique_ptr<log::ILogSink>> sinks;
+    sinks.push_back(std::make_unique<ThreadRecordingSink>());
+    auto& sink = static_cast<ThreadRecordingSink&>(*sinks.front());
+    {
+        log::LogDispatcher dispatcher;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&dispatcher, &sinks] {
+                const log::LogRecord record{"Test Logger",
+                                            log::LogLevel::eInfo,
+                                            log::TimeStampType::eLocal,
+                                            "Test message",
+                                            "TestFile",
+                                            "TestFunction",
+                                            123,
+                                            false};
+                for (int i = 0; i < 200; ++i) {
+                    dispatcher.dispatch(sinks, record);
+                    if (i % 10 == 0) {
+                        dispatcher.flush(sinks);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        dispatcher.flush(sinks);
+    }
+    // A flushing caller never writes queued records itself
+    EXPECT_EQ(sink.getThreadCount(), 1u);
+}
+
+TEST(LogDispatcherThreadTest, ReopenFromTheWorkerRunsAtOnce) {
+    std::vector<std::unique_ptr<log::ILogSink>> sinks;
+    sinks.push_back(std::make_unique<CallbackSink>());
+    auto& sink = static_cast<CallbackSink&>(*sinks.front());
+    log::LogDispatcher dispatcher;
+    sink.on_log = [&dispatcher, &sinks] { dispatcher.reopen(sinks); };
+
+    const log::LogRecord record{"Test Logger",
+                                log::LogLevel::eInfo,
+                                log::TimeStampType::eLocal,
+                                "Test message",
+                                "TestFile",
+                                "TestFunction",
+                                123,
+                                false};
+    dispatcher.dispatch(sinks, record);
+    dispatcher.flush(sinks);
+    EXPECT_EQ(sink.reopens, 1);
+}
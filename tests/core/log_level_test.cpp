@@ -48,3 +48,20 @@ TEST(LogLevelTest, LogLevelStreamOperator) {
     ss << static_cast<log::LogLevel>(-1);
     EXPECT_EQ(ss.str(), "UNKNOWN");
 }
+
+TEST(LogLevelTest, ParseLogLevel) {
+    log::LogLevel level = log::LogLevel::eInfo;
+
+    EXPECT_TRUE(log::parseLogLevel("trace", level));
+    EXPECT_EQ(level, log::LogLevel::eTrace);
+    EXPECT_TRUE(log::parseLogLevel("DEBUG", level));
+    EXPECT_EQ(level, log::LogLevel::eDebug);
+    EXPECT_TRUE(log::parseLogLevel("Warning", level));
+    EXPECT_EQ(level, log::LogLevel::eWarn);
+    EXPECT_TRUE(log::parseLogLevel("fatal", level));
+    EXPECT_EQ(level, log::LogLevel::eFatal);
+
+    EXPECT_FALSE(log::parseLogLevel("verbose", level));
+    EXPECT_FALSE(log::parseLogLevel("", level));
+    EXPECT_EQ(level, log::LogLevel::eFatal);
+}
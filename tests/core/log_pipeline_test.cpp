@@ -0,0 +1,242 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "mocks/log_sink_mock.h"
+#include "vertexnova/logging/core/log_pipeline.h"
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace vne;
+using ::testing::_;
+namespace fs = std::filesystem;
+
+namespace {
+constexpr const char* kLoggerCatName = "TestLogger";
+constexpr const char* kFileName = "TestFile";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+
+/**
+ * @brief Sink that formats a message as its text and records what is written.
+ */
+class RecordingSink : public log::ILogSink {
+   public:
+    void log(const std::string&,
+             log::LogLevel,
+             log::TimeStampType,
+             const std::string& message,
+             const std::string&,
+             const std::string&,
+             uint32_t) override {
+        written_.append(message).push_back('\n');
+        ++messages_;
+    }
+
+    bool formatTo(std::string& out,
+                  const std::string&,
+                  log::LogLevel,
+                  log::TimeStampType,
+                  const std::string& message,
+                  const std::string&,
+                  const std::string&,
+                  uint32_t) override {
+        out.append(message).push_back('\n');
+        return true;
+    }
+
+    bool canFormatTo() const override { return true; }
+
+    void writeFormatted(std::string_view text, size_t messages) override {
+        written_.append(text);
+        messages_ += messages;
+        ++writes_;
+    }
+
+    void flush() override {}
+    std::string getPattern() const override { return ""; }
+    void setPattern(const std::string&) override {}
+    std::unique_ptr<ILogSink> clone() const override { return std::make_unique<RecordingSink>(); }
+
+    const std::string& getWritten() const { return written_; }
+    size_t getMessages() const { return messages_; }
+    size_t getWrites() const { return writes_; }
+
+   private:
+    std::string written_;
+    size_t messages_ = 0;
+    size_t writes_ = 0;
+};
+
+log::LogRecordBuffer makeRecord(const std::string& message) {
+    log::LogRecordBuffer record;
+    record.assign(log::LogRecord{kLoggerCatName,
+                                 log::LogLevel::eInfo,
+                                 log::TimeStampType::eLocal,
+                                 message,
+                                 kFileName,
+                                 kFunctionName,
+                                 kLineNumber});
+    return record;
+}
+}  // namespace
+
+TEST(LogPipelineTest, DrainWritesEverythingInOrder) {
+    std::vector<std::unique_ptr<log::ILogSink>> sinks;
+    sinks.push_back(std::make_unique<RecordingSink>());
+    auto& sink = static_cast<RecordingSink&>(*sinks.front());
+
+    std::string expected;
+    log::LogPipeline pipeline(2);
+    // Enough text for several buffers, so stage 1 hands some over while appending
+    for (int i = 0; i < 20000; ++i) {
+        std::string message = "message " + std::to_string(i);
+        pipeline.append(sinks, makeRecord(message));
+        expected.append(message).push_back('\n');
+    }
+    pipeline.drain();
+
+    EXPECT_EQ(sink.getWritten(), expected);
+    EXPECT_EQ(sink.getMessages(), 20000u);
+    EXPECT_GT(sink.getWrites(), 1u);
+
+    log::QueueStats stats;
+    pipeline.snapshot(stats);
+    EXPECT_EQ(stats.pipeline_buffers, sink.getWrites());
+    EXPECT_EQ(stats.pipeline_bytes, expected.size());
+
+    pipeline.resetStats();
+    pipeline.snapshot(stats);
+    EXPECT_EQ(stats.pipeline_buffers, 0u);
+}
+
+TEST(LogPipelineTest, ParallelFormattingKeepsOrder) {
+    std::vector<std::unique_ptr<log::ILogSink>> sinks;
+    sinks.push_back(std::make_unique<RecordingSink>());
+    sinks.push_back(std::make_unique<RecordingSink>());
+    auto& first = static_cast<RecordingSink&>(*sinks.front());
+    auto& second = static_cast<RecordingSink&>(*sinks.back());
+
+    std::string expected;
+    log::LogPipeline pipeline(log::kDefaultPipelineBuffers, 4);
+    EXPECT_EQ(pipeline.getFormatterThreads(), 4u);
+    for (int i = 0; i < 20000; ++i) {
+        std::string message = "message " + std::to_string(i);
+        pipeline.append(sinks, makeRecord(message));
+        expected.append(message).push_back('\n');
+    }
+    pipeline.drain();
+
+    EXPECT_EQ(first.getWritten(), expected);
+    EXPECT_EQ(second.getWritten(), expected);
+    EXPECT_EQ(first.getMessages(), 20000u);
+
+    log::QueueStats stats;
+    pipeline.snapshot(stats);
+    EXPECT_EQ(stats.pipeline_bytes, 2 * expected.size());
+    EXPECT_GT(stats.pipeline_buffers, 1u);
+}
+
+TEST(LogPipelineTest, SinkWithoutFormatToReceivesLog) {
+    auto mock = std::make_unique<log::LogSinkMock>();
+    EXPECT_CALL(*mock, log(_, _, _, _, _, _, _)).Times(3);
+    EXPECT_CALL(*mock, flush()).Times(::testing::AnyNumber());
+
+    log::AsyncLogger logger("PipelineMockLogger");
+    logger.addLogSink(std::move(mock));
+    logger.setPipelined(true);
+    EXPECT_TRUE(logger.isPipelined());
+    for (int i = 0; i < 3; ++i) {
+        logger.log(kLoggerCatName,
+                   log::LogLevel::eInfo,
+                   log::TimeStampType::eLocal,
+                   "message",
+                   kFileName,
+                   kFunctionName,
+                   kLineNumber);
+    }
+    logger.flush();
+}
+
+namespace {
+/**
+ * @brief Logs through a pipelined file logger, switches back and checks that every line arrived in order.
+ */
+void checkPipelinedFile(size_t formatter_threads) {
+    const std::string dir = "pipeline_test_dir";
+    const std::string path = dir + "/pipelined.log";
+    fs::remove_all(dir);
+    constexpr int kMessages = 5000;
+    {
+        log::AsyncLogger logger("PipelineFileLogger");
+        auto sink = std::make_unique<log::FileLogSink>(path, false);
+        sink->setPattern("%v");
+        logger.addLogSink(std::move(sink));
+        logger.setFlushLevel(log::LogLevel::eFatal);
+        logger.setPipelined(true, formatter_threads);
+        EXPECT_EQ(logger.getFormatterThreads(), formatter_threads);
+
+        for (int i = 0; i < kMessages; ++i) {
+            logger.log(kLoggerCatName,
+                       log::LogLevel::eInfo,
+                       log::TimeStampType::eLocal,
+                       std::to_string(i),
+                       kFileName,
+                       kFunctionName,
+                       kLineNumber);
+        }
+        logger.flush();
+
+        log::LoggerStats stats = logger.getStats();
+        EXPECT_TRUE(stats.pipelined);
+        EXPECT_GT(stats.queue.pipeline_buffers, 0u);
+        ASSERT_EQ(stats.sinks.size(), 1u);
+        EXPECT_EQ(stats.sinks.front().messages_written, static_cast<uint64_t>(kMessages));
+        EXPECT_EQ(stats.sinks.front().bytes_written, stats.queue.pipeline_bytes);
+
+        // Switching back writes directly again
+        logger.setPipelined(false);
+        EXPECT_FALSE(logger.isPipelined());
+        logger.log(kLoggerCatName,
+                   log::LogLevel::eInfo,
+                   log::TimeStampType::eLocal,
+                   std::to_string(kMessages),
+                   kFileName,
+                   kFunctionName,
+                   kLineNumber);
+        logger.flush();
+    }
+
+    std::ifstream in(path);
+    std::string line;
+    int expected = 0;
+    while (std::getline(in, line)) {
+        ASSERT_EQ(line, std::to_string(expected));
+        ++expected;
+    }
+    EXPECT_EQ(expected, kMessages + 1);
+    in.close();
+    fs::remove_all(dir);
+}
+}  // namespace
+
+TEST(LogPipelineTest, PipelinedLoggerWritesFileInOrder) {
+    checkPipelinedFile(0);
+}
+
+TEST(LogPipelineTest, ParallelFormattingLoggerWritesFileInOrder) {
+    checkPipelinedFile(2);
+}
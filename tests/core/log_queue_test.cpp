@@ -109,3 +109,151 @@ TEST_F(LogQueueTest, TestConcurrentPushAndPop) {
     ASSERT_TRUE(log_queue_.empty());
     ASSERT_EQ(counter.load(), 3);
 }
+
+TEST_F(LogQueueTest, TestGrowthPreservesOrder) {
+    const size_t count = log::kInitialQueueCapacity * 2 + 7;
+    std::vector<size_t> order;
+
+    // Pop a few first so that the ring wraps around before it grows
+    for (size_t i = 0; i < 5; ++i) {
+        log_queue_.push([] {});
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        log_queue_.pop();
+    }
+    for (size_t i = 0; i < count; ++i) {
+        log_queue_.push([&order, i] { order.push_back(i); });
+    }
+    EXPECT_GE(log_queue_.capacity(), count);
+
+    while (!log_queue_.empty()) {
+        log_queue_.pop()();
+    }
+    ASSERT_EQ(order.size(), count);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST_F(LogQueueTest, TestDrainIntoReusedBatch) {
+    std::atomic<int> counter(0);
+    for (int i = 1; i <= 10; ++i) {
+        log_queue_.push([&counter, i] { counter += i; });
+    }
+
+    std::vector<std::function<void()>> batch;
+    batch.reserve(4);
+    log_queue_.drain(batch, 4);
+    EXPECT_EQ(batch.size(), 4u);
+    EXPECT_EQ(batch.capacity(), 4u);
+    for (auto& task : batch) {
+        task();
+    }
+    EXPECT_EQ(counter, 1 + 2 + 3 + 4);
+
+    log_queue_.drain(batch, 32);
+    EXPECT_EQ(batch.size(), 6u);
+    EXPECT_TRUE(log_queue_.empty());
+}
+
+TEST_F(LogQueueTest, TestTryPopDoesNotBlockWhenEmpty) {
+    std::function<void()> log_task;
+    EXPECT_FALSE(log_queue_.tryPop(log_task));
+
+    std::atomic<int> counter(0);
+    log_queue_.push([&counter] { counter += 5; });
+    ASSERT_TRUE(log_queue_.tryPop(log_task));
+    log_task();
+    EXPECT_EQ(counter, 5);
+    EXPECT_FALSE(log_queue_.tryPop(log_task));
+}
+
+TEST_F(LogQueueTest, TestPriorityLaneIsTakenFirst) {
+    std::vector<int> order;
+    log_queue_.push([&order] { order.push_back(1); });
+    log_queue_.push([&order] { order.push_back(2); });
+    log_queue_.pushPriority([&order] { order.push_back(3); });
+    log_queue_.push([&order] { order.push_back(4); });
+    log_queue_.pushPriority([&order] { order.push_back(5); });
+
+    log_queue_.pop()();
+    std::vector<std::function<void()>> batch;
+    log_queue_.drain(batch, 32);
+    for (auto& task : batch) {
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{3, 5, 1, 2, 4}));
+
+    log::QueueStats stats;
+    log_queue_.snapshot(stats);
+    EXPECT_EQ(stats.enqueued, 5u);
+    EXPECT_EQ(stats.priority_enqueued, 2u);
+    EXPECT_EQ(stats.dequeued, 5u);
+}
+
+TEST_F(LogQueueTest, TestControlTasksAreNotCounted) {
+    std::vector<int> order;
+    log_queue_.push([&order] { order.push_back(1); });
+    log_queue_.pushControl([&order] { order.push_back(2); });
+    log_queue_.pushControl([&order] { order.push_back(3); }, true);
+
+    log::QueueStats stats;
+    log_queue_.snapshot(stats);
+    EXPECT_EQ(stats.enqueued, 1u);
+    EXPECT_EQ(stats.priority_enqueued, 0u);
+    EXPECT_EQ(stats.current_depth, 1u);
+    EXPECT_EQ(stats.high_water_depth, 1u);
+
+    std::vector<std::function<void()>> batch;
+    log_queue_.drain(batch, 32);
+    for (auto& task : batch) {
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{3, 1, 2}));
+
+    log_queue_.snapshot(stats);
+    EXPECT_EQ(stats.dequeued, 1u);
+    EXPECT_EQ(stats.current_depth, 0u);
+}
+
+TEST_F(LogQueueTest, TestPriorityTasksJoinTheNextBatch) {
+    std::vector<int> order;
+    for (int i = 0; i < 6; ++i) {
+        log_queue_.push([&order, i] { order.push_back(i); });
+    }
+    log_queue_.pushPriority([&order] { order.push_back(100); });
+
+    std::vector<std::function<void()>> batch;
+    log_queue_.drain(batch, 2);
+    for (auto& task : batch) {
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{100, 0}));
+}
+
+TEST_F(LogQueueTest, TestTimestampOrderKeepsBatchChronological) {
+    log_queue_.setLaneOrder(log::LaneOrder::eTimestamp);
+    EXPECT_EQ(log_queue_.getLaneOrder(), log::LaneOrder::eTimestamp);
+
+    std::vector<int> order;
+    for (int i = 0; i < 6; ++i) {
+        log_queue_.push([&order, i] { order.push_back(i); });
+        if (i == 1 || i == 3) {
+            log_queue_.pushPriority([&order, i] { order.push_back(100 + i); });
+        }
+    }
+
+    // Both priority tasks still jump the backlog into the first batch, which is in push order
+    std::vector<std::function<void()>> batch;
+    log_queue_.drain(batch, 4);
+    for (auto& task : batch) {
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 101, 103}));
+
+    log_queue_.drain(batch, 32);
+    for (auto& task : batch) {
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 101, 103, 2, 3, 4, 5}));
+}
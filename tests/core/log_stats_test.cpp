@@ -0,0 +1,190 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/log_stats.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "mocks/log_sink_mock.h"
+
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace vne;
+using ::testing::_;
+
+namespace {
+
+constexpr const char* kCategory = "stats";
+constexpr const char* kFileName = "TestFile";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+
+size_t levelIndex(log::LogLevel level) {
+    return static_cast<size_t>(level);
+}
+
+void logAt(log::ILogger& logger, log::LogLevel level) {
+    logger.log(kCategory, level, log::TimeStampType::eLocal, "m", kFileName, kFunctionName, kLineNumber);
+}
+
+}  // namespace
+
+TEST(LogStatsTest, ShardedCountersSumAcrossThreads) {
+    constexpr size_t kThreads = 12;
+    constexpr size_t kIncrements = 10000;
+    log::ShardedCounters<2> counters;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&counters] {
+            for (size_t n = 0; n < kIncrements; ++n) {
+                counters.add(0);
+                counters.add(1, 3);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counters.load(0), kThreads * kIncrements);
+    EXPECT_EQ(counters.load(1), 3 * kThreads * kIncrements);
+
+    counters.reset();
+    EXPECT_EQ(counters.load(0), 0u);
+    EXPECT_EQ(counters.load(1), 0u);
+}
+
+TEST(LogStatsTest, SyncLoggerCountsAcceptedFilteredAndFlushes) {
+    log::SyncLogger logger("stats_sync");
+    auto sink = std::make_unique<log::LogSinkMock>();
+    EXPECT_CALL(*sink, log(_, _, _, _, _, _, _)).Times(2);
+    EXPECT_CALL(*sink, flush()).Times(2);
+    logger.addLogSink(std::move(sink));
+    logger.setCurrentLogLevel(log::LogLevel::eInfo);
+
+    logAt(logger, log::LogLevel::eDebug);
+    logAt(logger, log::LogLevel::eInfo);
+    logAt(logger, log::LogLevel::eError);
+    logger.countFiltered(log::LogLevel::eTrace);
+    logger.flush();
+
+    log::LoggerStats stats = logger.getStats();
+    EXPECT_EQ(stats.name, "stats_sync");
+    EXPECT_FALSE(stats.async);
+    EXPECT_EQ(stats.accepted[levelIndex(log::LogLevel::eInfo)], 1u);
+    EXPECT_EQ(stats.accepted[levelIndex(log::LogLevel::eError)], 1u);
+    EXPECT_EQ(stats.filtered[levelIndex(log::LogLevel::eDebug)], 1u);
+    EXPECT_EQ(stats.filtered[levelIndex(log::LogLevel::eTrace)], 1u);
+    EXPECT_EQ(stats.totalAccepted(), 2u);
+    EXPECT_EQ(stats.totalFiltered(), 2u);
+    EXPECT_EQ(stats.totalDropped(), 0u);
+    EXPECT_EQ(stats.flush_count, 2u);  // flush level (eError) + explicit flush
+    EXPECT_EQ(stats.queue.enqueued, 0u);
+    ASSERT_EQ(stats.sinks.size(), 1u);
+
+    logger.resetStats();
+    EXPECT_EQ(logger.getStats().totalAccepted(), 0u);
+    EXPECT_EQ(logger.getStats().flush_count, 0u);
+}
+
+TEST(LogStatsTest, AsyncLoggerReportsQueueAndWorker) {
+    constexpr size_t kMessages = 500;
+    log::AsyncLogger logger("stats_async");
+    auto sink = std::make_unique<log::LogSinkMock>();
+    EXPECT_CALL(*sink, log(_, _, _, _, _, _, _)).Times(static_cast<int>(kMessages));
+    EXPECT_CALL(*sink, flush()).Times(::testing::AnyNumber());
+    logger.addLogSink(std::move(sink));
+
+    for (size_t i = 0; i < kMessages; ++i) {
+        logAt(logger, log::LogLevel::eInfo);
+    }
+    logger.flush();
+
+    log::LoggerStats stats = logger.getStats();
+    EXPECT_TRUE(stats.async);
+    EXPECT_EQ(stats.accepted[levelIndex(log::LogLevel::eInfo)], kMessages);
+    EXPECT_EQ(stats.queue.enqueued, kMessages);
+    EXPECT_EQ(stats.queue.dequeued, kMessages);
+    EXPECT_EQ(stats.queue.current_depth, 0u);
+    EXPECT_GE(stats.queue.high_water_depth, 1u);
+    EXPECT_LE(stats.queue.high_water_depth, kMessages);
+    EXPECT_GE(stats.flush_count, 1u);
+}
+
+TEST(LogStatsTest, FileSinkCountsBytesWritten) {
+    const std::string file_path = "stats_sink.log";
+    log::SinkStats stats;
+    {
+        log::FileLogSink sink(file_path, false);
+        sink.setPattern("%v");
+        sink.log(kCategory, log::LogLevel::eInfo, log::TimeStampType::eLocal, "hello", kFileName, kFunctionName, 1);
+        sink.flush();
+        stats = sink.getStats();
+    }
+    std::filesystem::remove(file_path);
+
+    EXPECT_EQ(stats.messages_written, 1u);
+    EXPECT_EQ(stats.bytes_formatted, 6u);  // "hello\n"
+    EXPECT_EQ(stats.bytes_written, 6u);
+    EXPECT_EQ(stats.write_errors, 0u);
+    EXPECT_EQ(stats.flush_count, 1u);
+}
+
+TEST(LogStatsTest, TotalDroppedIncludesSinkDrops) {
+    log::LoggerStats stats;
+    stats.dropped[levelIndex(log::LogLevel::eError)] = 2;
+    stats.sinks.resize(2);
+    stats.sinks[1].dropped = 3;
+    EXPECT_EQ(stats.totalDropped(), 5u);
+
+    log::LoggingStats all;
+    all.loggers = {stats, stats};
+    EXPECT_EQ(all.totalDropped(), 10u);
+}
+
+TEST(LogStatsTest, LoggingFacadeAggregatesStats) {
+    std::stringstream cout_buffer;
+    std::streambuf* old_buffer = std::cout.rdbuf(cout_buffer.rdbuf());
+
+    log::Logging::initialize("stats_facade");
+    log::Logging::addConsoleSink("stats_facade");
+    log::Logging::setLogLevel("stats_facade", log::LogLevel::eWarn);
+
+    VNE_LOG_INFO_LC("stats_facade", kCategory) << "filtered";
+    VNE_LOG_WARN_LC("stats_facade", kCategory) << "accepted";
+
+    log::LoggingStats all = log::Logging::getStats();
+    ASSERT_EQ(all.loggers.size(), 1u);
+    EXPECT_EQ(all.loggers[0].name, "stats_facade");
+    EXPECT_EQ(all.totalDropped(), 0u);
+    EXPECT_EQ(all.totalWriteErrors(), 0u);
+
+    log::LoggerStats stats = log::Logging::getLoggerStats("stats_facade");
+    EXPECT_EQ(stats.filtered[levelIndex(log::LogLevel::eInfo)], 1u);
+    EXPECT_EQ(stats.accepted[levelIndex(log::LogLevel::eWarn)], 1u);
+    ASSERT_EQ(stats.sinks.size(), 1u);
+    EXPECT_EQ(stats.sinks[0].messages_written, 1u);
+    EXPECT_GT(stats.sinks[0].bytes_written, 0u);
+
+    log::Logging::resetStats();
+    EXPECT_EQ(log::Logging::getLoggerStats("stats_facade").totalAccepted(), 0u);
+    EXPECT_EQ(log::Logging::getLoggerStats("missing").name, "");
+
+    log::Logging::shutdown();
+    std::cout.rdbuf(old_buffer);
+}
@@ -15,6 +15,11 @@
 #include "vertexnova/logging/core/logger_controller.h"
 #include "vertexnova/logging/core/sync_logger.h"
 #include "vertexnova/logging/core/console_log_sink.h"
+#include "mocks/log_sink_mock.h"
+
+#include <iomanip>
+#include <string>
+#include <vector>
 
 namespace {
 constexpr const char* kLoggerName = "TestLogger";
@@ -124,3 +129,88 @@ TEST_F(LogStreamTest, LogStreamWithEmptyMessage) {
     ASSERT_NE(retrieved_logger, nullptr);
     ASSERT_EQ(logger, retrieved_logger);
 }
+
+namespace {
+
+/**
+ * @brief Streams as "noisy" and logs a message of its own while doing so.
+ */
+struct SelfLogging {};
+
+std::ostream& operator<<(std::ostream& stream, const SelfLogging&) {
+    log::LogStream(kLoggerName,
+                   kCategoryName,
+                   log::LogLevel::eInfo,
+                   log::TimeStampType::eLocal,
+                   kFileName,
+                   kFunctionName,
+                   kLineNumber)
+        << "inner";
+    return stream << "noisy";
+}
+
+}  // namespace
+
+class LogStreamMessageTest : public LogStreamTest {
+   protected:
+    void SetUp() override {
+        LogStreamTest::SetUp();
+        auto logger = std::make_shared<log::SyncLogger>(kLoggerName);
+        auto sink = std::make_unique<log::LogSinkMock>();
+        using ::testing::_;
+        EXPECT_CALL(*sink, log(_, _, _, _, _, _, _))
+            .WillRepeatedly(::testing::WithArg<3>([this](const std::string& message) { messages_.push_back(message); }));
+        logger->addLogSink(std::move(sink));
+        log::LoggerController::registerLogger(logger);
+    }
+
+    static log::LogStream stream() {
+        return log::LogStream(kLoggerName,
+                              kCategoryName,
+                              log::LogLevel::eInfo,
+                              log::TimeStampType::eLocal,
+                              kFileName,
+                              kFunctionName,
+                              kLineNumber);
+    }
+
+    std::vector<std::string> messages_;
+};
+
+TEST_F(LogStreamMessageTest, FormattingStateDoesNotLeakBetweenMessages) {
+    stream() << std::hex << 255 << ' ' << std::setprecision(2) << 3.14159;
+    stream() << 255 << ' ' << 3.14159;
+
+    ASSERT_EQ(messages_.size(), 2u);
+    EXPECT_EQ(messages_[0], "ff 3.1");
+    EXPECT_EQ(messages_[1], "255 3.14159");
+}
+
+TEST_F(LogStreamMessageTest, NestedStreamsKeepSeparateMessages) {
+    stream() << "outer " << SelfLogging{} << " done";
+
+    ASSERT_EQ(messages_.size(), 2u);
+    EXPECT_EQ(messages_[0], "inner");
+    EXPECT_EQ(messages_[1], "outer noisy done");
+}
+
+TEST_F(LogStreamMessageTest, StreamsBeyondThePerThreadPoolStillWork) {
+    {
+        auto first = stream();
+        auto second = stream();
+        auto third = stream();
+        auto fourth = stream();
+        auto fifth = stream();
+        auto sixth = stream();
+        first << "1";
+        second << "2";
+        third << "3";
+        fourth << "4";
+        fifth << "5";
+        sixth << "6";
+    }
+
+    ASSERT_EQ(messages_.size(), 6u);
+    EXPECT_EQ(messages_[0], "6");
+    EXPECT_EQ(messages_[5], "1");
+}
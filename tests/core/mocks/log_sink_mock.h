@@ -51,6 +51,13 @@ class LogSinkMock : public ILogSink {
                  uint32_t line),
                 (override));
 
+    /**
+     * @brief Mock method to write a trace span event.
+     *
+     * @param event The span event.
+     */
+    MOCK_METHOD(void, logTraceEvent, (const TraceEvent& event), (override));
+
     /**
      * @brief Mock method to flush the log sink.
      */
@@ -0,0 +1,198 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "mocks/log_sink_mock.h"
+#include "vertexnova/logging/core/routing_log_sink.h"
+#include "vertexnova/logging/core/emergency_log.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace vne;
+namespace fs = std::filesystem;
+using ::testing::_;
+
+namespace {
+constexpr const char* kTestDir = "routing_test_dir";
+constexpr const char* kFileName = "TestFile";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+
+void logMessage(log::ILogSink& sink, const std::string& category, log::LogLevel level, const std::string& message) {
+    sink.log(category, level, log::TimeStampType::eLocal, message, kFileName, kFunctionName, kLineNumber);
+}
+
+std::vector<std::string> readLines(const std::string& path) {
+    std::vector<std::string> lines;
+    std::ifstream stream(path);
+    std::string line;
+    while (std::getline(stream, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+log::LogRoute fileRoute(const std::string& category, const std::string& file) {
+    log::LogRoute route;
+    route.category = category;
+    route.file = std::string(kTestDir) + "/" + file;
+    return route;
+}
+}  // namespace
+
+class RoutingLogSinkTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        fs::remove_all(kTestDir);
+        ASSERT_TRUE(fs::create_directory(kTestDir));
+    }
+
+    void TearDown() override { fs::remove_all(kTestDir); }
+
+    static std::string path(const std::string& file) { return std::string(kTestDir) + "/" + file; }
+};
+
+TEST_F(RoutingLogSinkTest, RoutesByCategoryAndLevel) {
+    {
+        log::RoutingLogSink sink;
+        sink.setPattern("%n %v");
+        log::LogRoute errors = fileRoute("*", "errors.log");
+        errors.min_level = log::LogLevel::eError;
+        errors.stop = false;
+        sink.addRoute(errors);
+        sink.addRoute(fileRoute("net.*", "net.log"));
+        sink.addRoute(fileRoute("*", "other.log"));
+
+        logMessage(sink, "net.http", log::LogLevel::eInfo, "request");
+        logMessage(sink, "net.http", log::LogLevel::eError, "timeout");
+        logMessage(sink, "db", log::LogLevel::eDebug, "query");
+        logMessage(sink, "db", log::LogLevel::eFatal, "corrupt");
+    }
+    EXPECT_EQ(readLines(path("errors.log")), (std::vector<std::string>{"net.http timeout", "db corrupt"}));
+    EXPECT_EQ(readLines(path("net.log")), (std::vector<std::string>{"net.http request", "net.http timeout"}));
+    EXPECT_EQ(readLines(path("other.log")), (std::vector<std::string>{"db query", "db corrupt"}));
+}
+
+TEST_F(RoutingLogSinkTest, UnroutedMessagesAreDiscarded) {
+    log::RoutingLogSink sink;
+    log::LogRoute route = fileRoute("audit", "audit.log");
+    route.min_level = log::LogLevel::eWarn;
+    sink.addRoute(route);
+    logMessage(sink, "audit", log::LogLevel::eInfo, "below the route's level");
+    logMessage(sink, "render", log::LogLevel::eError, "no route");
+    sink.flush();
+
+    EXPECT_FALSE(fs::exists(path("audit.log")));
+    EXPECT_EQ(sink.getStats().messages_written, 0u);
+}
+
+TEST_F(RoutingLogSinkTest, CategoryPlaceholderKeepsFewFilesOpen) {
+    {
+        log::RoutingLogSink sink(2);
+        sink.setPattern("%v");
+        sink.addRoute(fileRoute("*", "{category}.log"));
+        for (int round = 0; round < 3; ++round) {
+            for (const char* category : {"physics", "audio", "render", "net/http"}) {
+                logMessage(sink, category, log::LogLevel::eInfo, std::to_string(round));
+                EXPECT_LE(sink.getOpenFileCount(), 2u);
+            }
+        }
+        EXPECT_EQ(sink.getCompiledCategoryCount(), 4u);
+        // Files closed to make room keep their counts
+        EXPECT_EQ(sink.getStats().messages_written, 12u);
+    }
+    // Every reopened file was appended to; "/" does not leave the directory
+    for (const char* file : {"physics.log", "audio.log", "render.log", "net_http.log"}) {
+        EXPECT_EQ(readLines(path(file)), (std::vector<std::string>{"0", "1", "2"})) << file;
+    }
+}
+
+TEST_F(RoutingLogSinkTest, DynamicCategoriesDoNotGrowTheSinkWithoutBound) {
+    constexpr size_t kCategories = log::RoutingLogSink::kMaxCompiledCategories + 16;
+    {
+        log::RoutingLogSink sink(4);
+        sink.setPattern("%v");
+        sink.addRoute(fileRoute("*", "{category}.log"));
+        for (size_t i = 0; i < kCategories; ++i) {
+            logMessage(sink, "c" + std::to_string(i), log::LogLevel::eInfo, "first");
+            EXPECT_LE(sink.getCompiledCategoryCount(), log::RoutingLogSink::kMaxCompiledCategories);
+        }
+        // A category compiled again finds its file and appends to it
+        logMessage(sink, "c0", log::LogLevel::eInfo, "again");
+        EXPECT_EQ(sink.getStats().messages_written, kCategories + 1);
+    }
+    EXPECT_EQ(readLines(path("c0.log")), (std::vector<std::string>{"first", "again"}));
+    EXPECT_EQ(readLines(path("c" + std::to_string(kCategories - 1) + ".log")), (std::vector<std::string>{"first"}));
+}
+
+TEST_F(RoutingLogSinkTest, RoutesToSinks) {
+    auto net_sink = std::make_unique<log::LogSinkMock>();
+    auto rest_sink = std::make_unique<log::LogSinkMock>();
+    EXPECT_CALL(*net_sink, log("net", log::LogLevel::eWarn, _, "slow", _, _, _)).Times(1);
+    EXPECT_CALL(*rest_sink, log("gpu", _, _, _, _, _, _)).Times(2);
+    EXPECT_CALL(*net_sink, flush()).Times(::testing::AtLeast(1));
+    EXPECT_CALL(*rest_sink, flush()).Times(::testing::AtLeast(1));
+
+    log::RoutingLogSink sink;
+    log::LogRoute net_route;
+    net_route.category = "net";
+    sink.addRoute(net_route, std::move(net_sink));
+    sink.addRoute(log::LogRoute{}, std::move(rest_sink));
+
+    logMessage(sink, "net", log::LogLevel::eWarn, "slow");
+    logMessage(sink, "gpu", log::LogLevel::eInfo, "frame");
+    logMessage(sink, "gpu", log::LogLevel::eInfo, "frame");
+    sink.flush();
+    EXPECT_EQ(sink.getCompiledCategoryCount(), 2u);
+    EXPECT_EQ(sink.getOpenFileCount(), 0u);
+}
+
+TEST_F(RoutingLogSinkTest, ReopenClosesFilesUntilTheirNextMessage) {
+    log::RoutingLogSink sink;
+    sink.setPattern("%v");
+    sink.addRoute(fileRoute("*", "app.log"));
+    logMessage(sink, "app", log::LogLevel::eInfo, "before");
+    EXPECT_EQ(sink.getOpenFileCount(), 1u);
+
+    // As after logrotate renamed the file
+    fs::rename(path("app.log"), path("app.log.1"));
+    sink.reopen();
+    EXPECT_EQ(sink.getOpenFileCount(), 0u);
+    logMessage(sink, "app", log::LogLevel::eInfo, "after");
+    sink.flush();
+
+    EXPECT_EQ(readLines(path("app.log.1")), (std::vector<std::string>{"before"}));
+    EXPECT_EQ(readLines(path("app.log")), (std::vector<std::string>{"after"}));
+}
+
+TEST_F(RoutingLogSinkTest, BudgetCountsDescriptorsAndSkipsEmergencyTable) {
+    log::RoutingLogSink sink(log::kMaxEmergencyFds + 8);
+    EXPECT_EQ(sink.getMaxOpenFiles(), log::kMaxEmergencyFds + 8);
+    sink.setPattern("%v");
+    sink.addRoute(fileRoute("*", "{category}.log"));
+    for (size_t i = 0; i < log::kMaxEmergencyFds + 8; ++i) {
+        logMessage(sink, "c" + std::to_string(i), log::LogLevel::eInfo, "routed");
+    }
+    EXPECT_EQ(sink.getOpenFileCount(), log::kMaxEmergencyFds + 8);
+
+    // More files are open than the emergency table has slots, and it still has room for a sink of its own
+    log::FileLogSink own(path("own.log"));
+    EXPECT_TRUE(own.hasEmergencyOutput());
+    log::EmergencyStream("test", log::LogLevel::eError, kFileName, kLineNumber) << "emergency";
+    sink.flush();
+    EXPECT_NE(readLines(path("own.log")).size(), 0u);
+    EXPECT_EQ(readLines(path("c0.log")), (std::vector<std::string>{"routed"}));
+}
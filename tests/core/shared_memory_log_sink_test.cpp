@@ -0,0 +1,233 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/core/shared_memory_log_sink.h"
+#include "vertexnova/logging/shared_log_collector.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace vne;
+namespace fs = std::filesystem;
+
+namespace {
+constexpr const char* kLoggerCatName = "TestLogger";
+constexpr const char* kFileName = "TestFile";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+constexpr const char* kOutputDir = "shared_memory_test_dir";
+
+/**
+ * @brief Segment name unique to this test run, so that parallel runs do not share rings.
+ */
+const std::string& segmentName() {
+    static const std::string name = "/vnelog_test_" + std::to_string(std::random_device{}());
+    return name;
+}
+
+void logMessage(log::ILogSink& sink, const std::string& message) {
+    sink.log(kLoggerCatName,
+             log::LogLevel::eInfo,
+             log::TimeStampType::eLocal,
+             message,
+             kFileName,
+             kFunctionName,
+             kLineNumber);
+}
+
+std::vector<std::string> readLines(const std::string& path) {
+    std::vector<std::string> lines;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+log::SharedLogCollectorOptions collectorOptions(const std::string& output) {
+    log::SharedLogCollectorOptions options;
+    options.segment_name = segmentName();
+    options.output_path = std::string(kOutputDir) + "/" + output;
+    return options;
+}
+
+class SharedMemoryLogSinkTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        if (!log::SharedLogSegment::isSupported()) {
+            GTEST_SKIP() << "POSIX shared memory is not available on this platform";
+        }
+        log::SharedLogSegment::unlink(segmentName());
+        fs::remove_all(kOutputDir);
+    }
+
+    void TearDown() override {
+        log::SharedLogSegment::unlink(segmentName());
+        fs::remove_all(kOutputDir);
+    }
+};
+}  // namespace
+
+TEST_F(SharedMemoryLogSinkTest, CollectorMergesSinksInTimeOrder) {
+    log::SharedMemoryLogSink first(segmentName());
+    log::SharedMemoryLogSink second(segmentName());
+    ASSERT_TRUE(first.isAttached());
+    ASSERT_TRUE(second.isAttached());
+    first.setPattern("%v");
+    second.setPattern("%v");
+
+    // Alternate between the rings; the time stamps interleave the same way
+    for (int i = 0; i < 100; ++i) {
+        logMessage(i % 2 == 0 ? first : second, std::to_string(i));
+    }
+
+    log::SharedLogCollector collector(collectorOptions("merged.log"));
+    ASSERT_TRUE(collector.open());
+    EXPECT_EQ(collector.getProducerCount(), 2u);
+    EXPECT_EQ(collector.collect(true), 100u);
+    EXPECT_EQ(collector.collect(true), 0u);
+
+    std::vector<std::string> lines = readLines(collector.getOptions().output_path);
+    ASSERT_EQ(lines.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(lines[i], std::to_string(i));
+    }
+    EXPECT_EQ(first.getStats().messages_written, 50u);
+    EXPECT_EQ(first.getStats().dropped, 0u);
+}
+
+TEST_F(SharedMemoryLogSinkTest, FullRingDropsAndCounts) {
+    log::SharedLogSegmentOptions options;
+    options.slots = 2;
+    options.ring_bytes = 4096;
+    log::SharedMemoryLogSink sink(segmentName(), options);
+    ASSERT_TRUE(sink.isAttached());
+    sink.setPattern("%v");
+
+    // No collector runs, so the ring fills up
+    const std::string message(100, 'x');
+    for (int i = 0; i < 100; ++i) {
+        logMessage(sink, message);
+    }
+    log::SinkStats stats = sink.getStats();
+    EXPECT_GT(stats.messages_written, 0u);
+    EXPECT_GT(stats.dropped, 0u);
+    EXPECT_EQ(stats.messages_written + stats.dropped, 100u);
+
+    log::SharedLogCollector collector(collectorOptions("full.log"));
+    ASSERT_TRUE(collector.open());
+    EXPECT_EQ(collector.getDropped(), stats.dropped);
+    EXPECT_EQ(collector.collect(true), stats.messages_written);
+
+    // Reading freed the ring, including across the wrap-around
+    for (int i = 0; i < 100; ++i) {
+        logMessage(sink, message);
+        collector.collect(true);
+    }
+    EXPECT_EQ(sink.getStats().dropped, stats.dropped);
+    EXPECT_EQ(readLines(collector.getOptions().output_path).size(), stats.messages_written + 100);
+}
+
+TEST_F(SharedMemoryLogSinkTest, RestartedCollectorContinuesWhereTheLastStopped) {
+    log::SharedMemoryLogSink sink(segmentName());
+    ASSERT_TRUE(sink.isAttached());
+    sink.setPattern("%v");
+
+    logMessage(sink, "before");
+    {
+        log::SharedLogCollector collector(collectorOptions("restart.log"));
+        ASSERT_TRUE(collector.open());
+        EXPECT_EQ(collector.collect(true), 1u);
+    }
+    // Producers keep writing while no collector runs
+    logMessage(sink, "between");
+
+    log::SharedLogCollector collector(collectorOptions("restart.log"));
+    ASSERT_TRUE(collector.open());
+    EXPECT_EQ(collector.collect(true), 1u);
+    EXPECT_EQ(readLines(collector.getOptions().output_path), (std::vector<std::string>{"before", "between"}));
+}
+
+TEST_F(SharedMemoryLogSinkTest, FailedWriteKeepsRecordsQueued) {
+    if (!fs::exists("/dev/full")) {
+        GTEST_SKIP() << "No /dev/full to fail writes with";
+    }
+    log::SharedMemoryLogSink sink(segmentName());
+    ASSERT_TRUE(sink.isAttached());
+    sink.setPattern("%v");
+    logMessage(sink, "kept");
+    {
+        log::SharedLogCollectorOptions options = collectorOptions("unused.log");
+        options.output_path = "/dev/full";
+        log::SharedLogCollector collector(options);
+        ASSERT_TRUE(collector.open());
+        std::stringstream errors;
+        std::streambuf* old_buffer = std::cerr.rdbuf(errors.rdbuf());
+        EXPECT_EQ(collector.collect(true), 0u);
+        std::cerr.rdbuf(old_buffer);
+        EXPECT_NE(errors.str().find("records stay queued"), std::string::npos);
+    }
+
+    log::SharedLogCollector collector(collectorOptions("retry.log"));
+    ASSERT_TRUE(collector.open());
+    EXPECT_EQ(collector.collect(true), 1u);
+    EXPECT_EQ(readLines(collector.getOptions().output_path), (std::vector<std::string>{"kept"}));
+}
+
+TEST_F(SharedMemoryLogSinkTest, ReleasedSlotIsReclaimedOnceRead) {
+    log::SharedLogSegmentOptions options;
+    options.slots = 1;
+    auto sink = std::make_unique<log::SharedMemoryLogSink>(segmentName(), options);
+    ASSERT_TRUE(sink->isAttached());
+    logMessage(*sink, "last words");
+    sink.reset();
+
+    // The only slot is still held until its ring is read
+    EXPECT_FALSE(log::SharedMemoryLogSink(segmentName()).isAttached());
+
+    log::SharedLogCollector collector(collectorOptions("reclaim.log"));
+    ASSERT_TRUE(collector.open());
+    EXPECT_EQ(collector.collect(true), 1u);
+    EXPECT_EQ(collector.getProducerCount(), 0u);
+    EXPECT_TRUE(log::SharedMemoryLogSink(segmentName()).isAttached());
+}
+
+TEST_F(SharedMemoryLogSinkTest, CollectorRotatesOutput) {
+    log::SharedMemoryLogSink sink(segmentName());
+    sink.setPattern("%v");
+    log::SharedLogCollectorOptions options = collectorOptions("rotated.log");
+    options.max_file_bytes = 100;
+    options.max_files = 2;
+    log::SharedLogCollector collector(options);
+    ASSERT_TRUE(collector.open());
+
+    // 10 bytes per line, 10 lines per file
+    for (int i = 0; i < 35; ++i) {
+        logMessage(sink, "line " + std::to_string(1000 + i));
+    }
+    EXPECT_EQ(collector.collect(true), 35u);
+    EXPECT_EQ(collector.getRotations(), 3u);
+
+    const std::string& path = options.output_path;
+    EXPECT_EQ(readLines(path).size(), 5u);
+    EXPECT_EQ(readLines(path + ".1").size(), 10u);
+    EXPECT_EQ(readLines(path + ".1").front(), "line 1020");
+    EXPECT_EQ(readLines(path + ".2").front(), "line 1010");
+    EXPECT_FALSE(fs::exists(path + ".3"));
+}
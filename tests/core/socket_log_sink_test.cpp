@@ -0,0 +1,356 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/core/socket_log_sink.h"
+#include "vertexnova/logging/core/async_logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace vne;
+namespace fs = std::filesystem;
+
+#if !defined(_WIN32)
+
+namespace {
+constexpr const char* kLoggerCatName = "TestLogger";
+constexpr const char* kFileName = "TestFile";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+constexpr auto kDeliveryTimeout = std::chrono::seconds(5);
+
+/**
+ * @brief In-process stand-in for the aggregator: accepts connections and decodes their frames.
+ */
+class LoopbackAggregator {
+   public:
+    ~LoopbackAggregator() { stop(); }
+
+    /**
+     * @brief Listens on a Unix domain socket.
+     */
+    bool listenUnix(const std::string& path) {
+        ::unlink(path.c_str());
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::snprintf(address.sun_path, sizeof(address.sun_path), "%s", path.c_str());
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        return bindAndStart(reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    }
+
+    /**
+     * @brief Listens on 127.0.0.1 at a port chosen by the system.
+     *
+     * @return The port, or 0.
+     */
+    int listenTcp() {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (!bindAndStart(reinterpret_cast<sockaddr*>(&address), sizeof(address))) {
+            return 0;
+        }
+        socklen_t length = sizeof(address);
+        ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&address), &length);
+        return ntohs(address.sin_port);
+    }
+
+    /**
+     * @brief Closes the listening socket and every connection.
+     */
+    void stop() {
+        running_ = false;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        for (int fd : client_fds_) {
+            ::close(fd);
+        }
+        client_fds_.clear();
+        if (listen_fd_ >= 0) {
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+        }
+    }
+
+    std::vector<std::string> getLines() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lines_;
+    }
+
+   private:
+    bool bindAndStart(const sockaddr* address, socklen_t length) {
+        if (listen_fd_ < 0 || ::bind(listen_fd_, address, length) != 0 || ::listen(listen_fd_, 4) != 0) {
+            return false;
+        }
+        running_ = true;
+        thread_ = std::thread([this] { run(); });
+        return true;
+    }
+
+    void run() {
+        std::vector<std::string> buffers;
+        while (running_) {
+            std::vector<pollfd> fds{{listen_fd_, POLLIN, 0}};
+            for (int fd : client_fds_) {
+                fds.push_back({fd, POLLIN, 0});
+            }
+            if (::poll(fds.data(), fds.size(), 10) <= 0) {
+                continue;
+            }
+            if (fds[0].revents & POLLIN) {
+                int client = ::accept(listen_fd_, nullptr, nullptr);
+                if (client >= 0) {
+                    client_fds_.push_back(client);
+                    buffers.emplace_back();
+                }
+            }
+            for (size_t i = 1; i < fds.size(); ++i) {
+                if (fds[i].revents & (POLLIN | POLLHUP)) {
+                    char data[4096];
+                    ssize_t received = ::read(fds[i].fd, data, sizeof(data));
+                    if (received > 0) {
+                        buffers[i - 1].append(data, static_cast<size_t>(received));
+                        decode(buffers[i - 1]);
+                    }
+                }
+            }
+        }
+    }
+
+    void decode(std::string& buffer) {
+        size_t offset = 0;
+        while (buffer.size() - offset >= 4) {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(buffer.data() + offset);
+            const size_t length =
+                (size_t{bytes[0]} << 24) | (size_t{bytes[1]} << 16) | (size_t{bytes[2]} << 8) | size_t{bytes[3]};
+            if (buffer.size() - offset - 4 < length) {
+                break;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            lines_.emplace_back(buffer, offset + 4, length);
+            offset += 4 + length;
+        }
+        buffer.erase(0, offset);
+    }
+
+    int listen_fd_ = -1;
+    std::vector<int> client_fds_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    mutable std::mutex mutex_;
+    std::vector<std::string> lines_;
+};
+
+void logMessage(log::ILogSink& sink, const std::string& message) {
+    sink.log(kLoggerCatName,
+             log::LogLevel::eInfo,
+             log::TimeStampType::eLocal,
+             message,
+             kFileName,
+             kFunctionName,
+             kLineNumber);
+}
+
+/**
+ * @brief Flushes the sink until the aggregator has received count lines or the timeout passes.
+ */
+bool waitForLines(log::ILogSink& sink, const LoopbackAggregator& aggregator, size_t count) {
+    const auto deadline = std::chrono::steady_clock::now() + kDeliveryTimeout;
+    while (aggregator.getLines().size() < count) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        sink.flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return true;
+}
+
+std::string socketPath(const std::string& name) {
+    return (fs::temp_directory_path() / ("vnelogging-" + name + "-" + std::to_string(::getpid()) + ".sock")).string();
+}
+
+log::SocketSinkOptions fastReconnect() {
+    log::SocketSinkOptions options;
+    options.reconnect_min = std::chrono::milliseconds(5);
+    options.reconnect_max = std::chrono::milliseconds(20);
+    options.batch_delay = std::chrono::milliseconds(5);
+    return options;
+}
+}  // namespace
+
+TEST(SocketLogSinkTest, UnixSocketDeliversFramesInOrder) {
+    const std::string path = socketPath("unix");
+    LoopbackAggregator aggregator;
+    ASSERT_TRUE(aggregator.listenUnix(path));
+
+    log::SocketLogSink sink("unix:" + path);
+    sink.setPattern("%v");
+    EXPECT_TRUE(sink.isConnected());
+    for (int i = 0; i < 2000; ++i) {
+        logMessage(sink, "message " + std::to_string(i));
+    }
+    ASSERT_TRUE(waitForLines(sink, aggregator, 2000));
+
+    std::vector<std::string> lines = aggregator.getLines();
+    ASSERT_EQ(lines.size(), 2000u);
+    for (int i = 0; i < 2000; ++i) {
+        EXPECT_EQ(lines[i], "message " + std::to_string(i));
+    }
+    log::SinkStats stats = sink.getStats();
+    EXPECT_EQ(stats.messages_written, 2000u);
+    EXPECT_EQ(stats.dropped, 0u);
+    EXPECT_EQ(sink.getSpooledBytes(), 0u);
+    EXPECT_EQ(sink.getConnectCount(), 1u);
+    ::unlink(path.c_str());
+}
+
+TEST(SocketLogSinkTest, TcpLoopbackDelivers) {
+    LoopbackAggregator aggregator;
+    const int port = aggregator.listenTcp();
+    ASSERT_GT(port, 0);
+
+    log::SocketLogSink sink("tcp:127.0.0.1:" + std::to_string(port));
+    sink.setPattern("%v");
+    for (int i = 0; i < 100; ++i) {
+        logMessage(sink, std::to_string(i));
+    }
+    ASSERT_TRUE(waitForLines(sink, aggregator, 100));
+    EXPECT_EQ(aggregator.getLines().back(), "99");
+    EXPECT_TRUE(sink.isConnected());
+}
+
+TEST(SocketLogSinkTest, SpoolsWhileDisconnectedAndDropsBeyondTheBound) {
+    const std::string path = socketPath("spool");
+    ::unlink(path.c_str());
+    log::SocketSinkOptions options = fastReconnect();
+    options.spool_bytes = 1000;
+    log::SocketLogSink sink("unix:" + path, options);
+    sink.setPattern("%v");
+    EXPECT_FALSE(sink.isConnected());
+
+    // 4 + 16 bytes per frame: 50 fit, the rest is dropped
+    const std::string message(16, 'x');
+    for (int i = 0; i < 80; ++i) {
+        logMessage(sink, message);
+    }
+    EXPECT_EQ(sink.getSpooledBytes(), 1000u);
+    EXPECT_EQ(sink.getStats().dropped, 30u);
+
+    LoopbackAggregator aggregator;
+    ASSERT_TRUE(aggregator.listenUnix(path));
+    ASSERT_TRUE(waitForLines(sink, aggregator, 50));
+    EXPECT_EQ(sink.getStats().messages_written, 50u);
+    EXPECT_EQ(sink.getSpooledBytes(), 0u);
+    ::unlink(path.c_str());
+}
+
+TEST(SocketLogSinkTest, ReconnectsAfterAggregatorRestarts) {
+    const std::string path = socketPath("restart");
+    log::SocketLogSink sink("unix:" + path, fastReconnect());
+    sink.setPattern("%v");
+    {
+        LoopbackAggregator aggregator;
+        ASSERT_TRUE(aggregator.listenUnix(path));
+        sink.reopen();
+        logMessage(sink, "first");
+        ASSERT_TRUE(waitForLines(sink, aggregator, 1));
+    }
+
+    LoopbackAggregator aggregator;
+    ASSERT_TRUE(aggregator.listenUnix(path));
+    for (int i = 0; i < 10; ++i) {
+        logMessage(sink, std::to_string(i));
+    }
+    ASSERT_TRUE(waitForLines(sink, aggregator, 10));
+    EXPECT_EQ(aggregator.getLines().front(), "0");
+    EXPECT_EQ(sink.getConnectCount(), 2u);
+    EXPECT_GT(sink.getStats().write_errors, 0u);
+    ::unlink(path.c_str());
+}
+
+TEST(SocketLogSinkTest, AsyncLoggerStreamsThroughWorker) {
+    const std::string path = socketPath("async");
+    LoopbackAggregator aggregator;
+    ASSERT_TRUE(aggregator.listenUnix(path));
+    {
+        log::AsyncLogger logger("SocketAsyncLogger");
+        auto sink = std::make_unique<log::SocketLogSink>("unix:" + path);
+        sink->setPattern("%v");
+        logger.addLogSink(std::move(sink));
+        for (int i = 0; i < 500; ++i) {
+            logger.log(kLoggerCatName,
+                       log::LogLevel::eInfo,
+                       log::TimeStampType::eLocal,
+                       std::to_string(i),
+                       kFileName,
+                       kFunctionName,
+                       kLineNumber);
+        }
+        logger.flush();
+    }
+    const auto deadline = std::chrono::steady_clock::now() + kDeliveryTimeout;
+    while (aggregator.getLines().size() < 500 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    ASSERT_EQ(aggregator.getLines().size(), 500u);
+    EXPECT_EQ(aggregator.getLines().back(), "499");
+    ::unlink(path.c_str());
+}
+
+TEST(SocketLogSinkTest, AsyncLoggerSendsTheSpoolOnceIdle) {
+    const std::string path = socketPath("idle");
+    LoopbackAggregator aggregator;
+    ASSERT_TRUE(aggregator.listenUnix(path));
+    log::SocketSinkOptions options;
+    options.batch_delay = std::chrono::hours(1);
+    log::AsyncLogger logger("SocketIdleLogger");
+    auto sink = std::make_unique<log::SocketLogSink>("unix:" + path, options);
+    sink->setPattern("%v");
+    logger.addLogSink(std::move(sink));
+    logger.log(kLoggerCatName,
+               log::LogLevel::eInfo,
+               log::TimeStampType::eLocal,
+               "lonely",
+               kFileName,
+               kFunctionName,
+               kLineNumber);
+
+    // Neither a second message nor a flush follows
+    const auto deadline = std::chrono::steady_clock::now() + kDeliveryTimeout;
+    while (aggregator.getLines().empty() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    ASSERT_EQ(aggregator.getLines().size(), 1u);
+    EXPECT_EQ(aggregator.getLines().front(), "lonely");
+    ::unlink(path.c_str());
+}
+
+#endif
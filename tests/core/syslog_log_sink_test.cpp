@@ -0,0 +1,228 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/syslog_log_sink.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace vne;
+namespace fs = std::filesystem;
+
+#if !defined(_WIN32)
+
+namespace {
+constexpr const char* kLoggerCatName = "TestLogger";
+constexpr const char* kFileName = "test_file.cpp";
+constexpr const char* kFunctionName = "TestFunction";
+constexpr uint32_t kLineNumber = 42;
+
+/**
+ * @brief Datagram socket standing in for the syslog daemon or journald.
+ */
+class FakeDaemon {
+   public:
+    explicit FakeDaemon(const std::string& name)
+        : path_((fs::temp_directory_path() / ("vnelogging-" + name + "-" + std::to_string(::getpid()) + ".sock"))
+                    .string()) {
+        bind();
+    }
+
+    ~FakeDaemon() {
+        ::close(fd_);
+        ::unlink(path_.c_str());
+    }
+
+    /**
+     * @brief Closes the socket and binds a new one at the same path, as a restarted daemon would.
+     */
+    void restart() {
+        ::close(fd_);
+        bind();
+    }
+
+    /**
+     * @brief Returns the datagrams received so far, without waiting.
+     */
+    std::vector<std::string> receive() {
+        std::vector<std::string> datagrams;
+        char buffer[65536];
+        ssize_t received = 0;
+        while ((received = ::recv(fd_, buffer, sizeof(buffer), MSG_DONTWAIT)) >= 0) {
+            datagrams.emplace_back(buffer, static_cast<size_t>(received));
+        }
+        return datagrams;
+    }
+
+    const std::string& getPath() const { return path_; }
+
+   private:
+    void bind() {
+        ::unlink(path_.c_str());
+        fd_ = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::snprintf(address.sun_path, sizeof(address.sun_path), "%s", path_.c_str());
+        ::bind(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    }
+
+    std::string path_;
+    int fd_ = -1;
+};
+
+void logMessage(log::ILogSink& sink, log::LogLevel level, const std::string& message) {
+    sink.log(kLoggerCatName, level, log::TimeStampType::eLocal, message, kFileName, kFunctionName, kLineNumber);
+}
+
+log::SyslogSinkOptions daemonOptions(const FakeDaemon& daemon, log::SyslogProtocol protocol) {
+    log::SyslogSinkOptions options;
+    options.protocol = protocol;
+    options.socket_path = daemon.getPath();
+    options.identifier = "vnetest";
+    options.batch_messages = 4;
+    options.batch_delay = std::chrono::hours(1);
+    return options;
+}
+}  // namespace
+
+TEST(SyslogLogSinkTest, SendsRfc5424WithStructuredData) {
+    FakeDaemon daemon("syslog");
+    log::SyslogLogSink sink(daemonOptions(daemon, log::SyslogProtocol::eSyslog));
+    logMessage(sink, log::LogLevel::eError, "disk \"full\"");
+    sink.flush();
+
+    std::vector<std::string> datagrams = daemon.receive();
+    ASSERT_EQ(datagrams.size(), 1u);
+    const std::string& message = datagrams.front();
+    // user facility (1) * 8 + err (3)
+    EXPECT_EQ(message.rfind("<11>1 ", 0), 0u) << message;
+    EXPECT_NE(message.find(" vnetest " + std::to_string(::getpid()) + " - "), std::string::npos) << message;
+    EXPECT_NE(message.find("[vne@32473 category=\"TestLogger\" file=\"test_file.cpp\" line=\"42\" "
+                           "function=\"TestFunction\"]"),
+              std::string::npos)
+        << message;
+    EXPECT_EQ(message.substr(message.size() - 13), "] disk \"full\"");
+    EXPECT_EQ(sink.getStats().messages_written, 1u);
+}
+
+TEST(SyslogLogSinkTest, SendsJournalFields) {
+    FakeDaemon daemon("journal");
+    log::SyslogLogSink sink(daemonOptions(daemon, log::SyslogProtocol::eJournal));
+    logMessage(sink, log::LogLevel::eWarn, "first line\nsecond line");
+    sink.flush();
+
+    std::vector<std::string> datagrams = daemon.receive();
+    ASSERT_EQ(datagrams.size(), 1u);
+    const std::string& entry = datagrams.front();
+    EXPECT_NE(entry.find("PRIORITY=4\n"), std::string::npos);
+    EXPECT_NE(entry.find("SYSLOG_FACILITY=1\n"), std::string::npos);
+    EXPECT_NE(entry.find("SYSLOG_IDENTIFIER=vnetest\n"), std::string::npos);
+    EXPECT_NE(entry.find("CODE_FILE=test_file.cpp\n"), std::string::npos);
+    EXPECT_NE(entry.find("CODE_LINE=42\n"), std::string::npos);
+    EXPECT_NE(entry.find("CODE_FUNC=TestFunction\n"), std::string::npos);
+    EXPECT_NE(entry.find("VNE_CATEGORY=TestLogger\n"), std::string::npos);
+
+    // A multi-line value is sent as "MESSAGE\n", a 64-bit little-endian length and the bytes
+    const std::string text = "first line\nsecond line";
+    std::string binary = "MESSAGE\n";
+    binary.push_back(static_cast<char>(text.size()));
+    binary.append(7, '\0');
+    binary.append(text).push_back('\n');
+    EXPECT_EQ(entry.rfind(binary, 0), 0u);
+}
+
+TEST(SyslogLogSinkTest, BatchesUntilFullOrFlushed) {
+    FakeDaemon daemon("batch");
+    log::SyslogLogSink sink(daemonOptions(daemon, log::SyslogProtocol::eSyslog));
+    for (int i = 0; i < 10; ++i) {
+        logMessage(sink, log::LogLevel::eInfo, std::to_string(i));
+    }
+    // Two full batches of 4 went out on their own; 2 messages wait
+    std::vector<std::string> datagrams = daemon.receive();
+    ASSERT_EQ(datagrams.size(), 8u);
+    EXPECT_EQ(datagrams.back().back(), '7');
+
+    sink.flush();
+    datagrams = daemon.receive();
+    ASSERT_EQ(datagrams.size(), 2u);
+    EXPECT_EQ(datagrams.back().back(), '9');
+    EXPECT_EQ(sink.getStats().messages_written, 10u);
+}
+
+TEST(SyslogLogSinkTest, AsyncLoggerSendsTheBatchOnceIdle) {
+    FakeDaemon daemon("idle");
+    log::AsyncLogger logger("SyslogIdleLogger");
+    logger.addLogSink(std::make_unique<log::SyslogLogSink>(daemonOptions(daemon, log::SyslogProtocol::eSyslog)));
+    logger.log(kLoggerCatName, log::LogLevel::eInfo, log::TimeStampType::eLocal, "lonely", kFileName, kFunctionName, 1);
+
+    // Less than a batch, an hour's batch_delay, and no flush
+    std::vector<std::string> datagrams;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (datagrams.empty() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        datagrams = daemon.receive();
+    }
+    ASSERT_EQ(datagrams.size(), 1u);
+    EXPECT_EQ(datagrams.front().substr(datagrams.front().size() - 6), "lonely");
+}
+
+TEST(SyslogLogSinkTest, ReconnectsAfterDaemonRestart) {
+    FakeDaemon daemon("restart");
+    log::SyslogLogSink sink(daemonOptions(daemon, log::SyslogProtocol::eSyslog));
+    logMessage(sink, log::LogLevel::eInfo, "before");
+    sink.flush();
+    EXPECT_EQ(daemon.receive().size(), 1u);
+
+    daemon.restart();
+    logMessage(sink, log::LogLevel::eInfo, "after");
+    sink.flush();
+    std::vector<std::string> datagrams = daemon.receive();
+    ASSERT_EQ(datagrams.size(), 1u);
+    EXPECT_NE(datagrams.front().find("after"), std::string::npos);
+}
+
+TEST(SyslogLogSinkTest, MissingDaemonCountsWriteErrors) {
+    log::SyslogSinkOptions options;
+    options.socket_path = (fs::temp_directory_path() / "vnelogging-no-daemon.sock").string();
+    ::unlink(options.socket_path.c_str());
+    log::SyslogLogSink sink(options);
+    logMessage(sink, log::LogLevel::eInfo, "lost");
+    sink.flush();
+
+    log::SinkStats stats = sink.getStats();
+    EXPECT_EQ(stats.messages_written, 0u);
+    EXPECT_EQ(stats.write_errors, 1u);
+}
+
+TEST(SyslogLogSinkTest, MapsLevelsToSeverities) {
+    EXPECT_EQ(log::SyslogLogSink::toSeverity(log::LogLevel::eTrace), 7);
+    EXPECT_EQ(log::SyslogLogSink::toSeverity(log::LogLevel::eDebug), 7);
+    EXPECT_EQ(log::SyslogLogSink::toSeverity(log::LogLevel::eInfo), 6);
+    EXPECT_EQ(log::SyslogLogSink::toSeverity(log::LogLevel::eWarn), 4);
+    EXPECT_EQ(log::SyslogLogSink::toSeverity(log::LogLevel::eError), 3);
+    EXPECT_EQ(log::SyslogLogSink::toSeverity(log::LogLevel::eFatal), 2);
+}
+
+#endif
@@ -29,7 +29,7 @@ TEST(TimeStampTest, LocalTimeStamp) {
     EXPECT_CALL(*mock_provider, now()).WillOnce(testing::Return(mock_time));
     EXPECT_CALL(*mock_provider, localTime(testing::_)).WillOnce(testing::Return(&mock_tm));
 
-    TimeStamp timestamp_local(TimeStampType::eLocal, mock_provider);
+    TimeStamp timestamp_local(TimeStampType::eLocal, *mock_provider);
 
     std::string result = timestamp_local.getTimeStamp();
     EXPECT_EQ(result, "2020-06-15 12:34:56");
@@ -49,7 +49,7 @@ TEST(TimeStampTest, UTCTimeStamp) {
     EXPECT_CALL(*mock_provider, now()).WillOnce(testing::Return(mock_time));
     EXPECT_CALL(*mock_provider, gmTime(testing::_)).WillOnce(testing::Return(&mock_tm));
 
-    TimeStamp timestamp_utc(TimeStampType::eUtc, mock_provider);
+    TimeStamp timestamp_utc(TimeStampType::eUtc, *mock_provider);
     std::string result = timestamp_utc.getTimeStamp();
 
     EXPECT_EQ(result, "2020-06-15 12:34:56");
@@ -69,8 +69,53 @@ TEST(TimeStampTest, DefaultTimeStamp) {
     EXPECT_CALL(*mock_provider, now()).WillOnce(testing::Return(mock_time));
     EXPECT_CALL(*mock_provider, localTime(testing::_)).WillOnce(testing::Return(&mock_tm));
 
-    TimeStamp timestamp_default(TimeStampType::eLocal, mock_provider);
+    TimeStamp timestamp_default(TimeStampType::eLocal, *mock_provider);
     std::string result = timestamp_default.getTimeStamp();
 
     EXPECT_EQ(result, "2020-06-15 12:34:56");
 }
+
+TEST(TimeStampTest, ProcessWideProviderIsInjectable) {
+    TimeProviderMock mock_provider;
+    std::time_t mock_time = 1592229296;  // June 15, 2020, 12:34:56 UTC
+    std::tm mock_tm = {};
+    mock_tm.tm_year = 120;  // 2020 - 1900
+    mock_tm.tm_mon = 5;     // June
+    mock_tm.tm_mday = 15;
+    mock_tm.tm_hour = 12;
+    mock_tm.tm_min = 34;
+    mock_tm.tm_sec = 56;
+
+    EXPECT_CALL(mock_provider, now()).WillOnce(testing::Return(mock_time));
+    EXPECT_CALL(mock_provider, gmTime(testing::_)).WillOnce(testing::Return(&mock_tm));
+
+    setTimeProvider(&mock_provider);
+    EXPECT_EQ(&getTimeProvider(), &mock_provider);
+
+    TimeStamp timestamp_utc(TimeStampType::eUtc);
+    std::string result = timestamp_utc.getTimeStamp();
+    setTimeProvider(nullptr);
+
+    EXPECT_EQ(result, "2020-06-15 12:34:56");
+    EXPECT_EQ(&getTimeProvider(), &TimeProvider::instance());
+}
+
+TEST(TimeStampTest, FormatToBuffer) {
+    TimeProviderMock mock_provider;
+    std::time_t mock_time = 1592229296;  // June 15, 2020, 12:34:56 UTC
+    std::tm mock_tm = {};
+    mock_tm.tm_year = 120;  // 2020 - 1900
+    mock_tm.tm_mon = 5;     // June
+    mock_tm.tm_mday = 15;
+    mock_tm.tm_hour = 12;
+    mock_tm.tm_min = 34;
+    mock_tm.tm_sec = 56;
+
+    EXPECT_CALL(mock_provider, now()).WillOnce(testing::Return(mock_time));
+    EXPECT_CALL(mock_provider, localTime(testing::_)).WillOnce(testing::Return(&mock_tm));
+
+    char buffer[TimeStamp::kBufferSize];
+    size_t length = TimeStamp(TimeStampType::eLocal, mock_provider).formatTo(buffer, sizeof(buffer));
+
+    EXPECT_EQ(std::string(buffer, length), "2020-06-15 12:34:56");
+}
@@ -0,0 +1,96 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "mocks/log_sink_mock.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vne;
+using ::testing::_;
+
+namespace {
+
+CREATE_VNE_LOGGER_CATEGORY("timed.test");
+
+constexpr const char* kLoggerName = "timed_logger";
+
+}  // namespace
+
+class TimedLogScopeTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        log::LoggerController::unregisterAllLoggers();
+        auto logger = std::make_shared<log::SyncLogger>(kLoggerName);
+        auto sink = std::make_unique<log::LogSinkMock>();
+        sink_ = sink.get();
+        logger->addLogSink(std::move(sink));
+        logger->setCurrentLogLevel(log::LogLevel::eTrace);
+        log::LoggerController::registerLogger(logger);
+    }
+
+    void TearDown() override { log::LoggerController::unregisterAllLoggers(); }
+
+    log::LogSinkMock* sink_ = nullptr;
+};
+
+TEST_F(TimedLogScopeTest, FastScopeIsNotLogged) {
+    EXPECT_CALL(*sink_, log(_, _, _, _, _, _, _)).Times(0);
+
+    VNE_LOG_TIMED_SCOPE_L(kLoggerName, log::LogLevel::eWarn, std::chrono::seconds(10));
+}
+
+TEST_F(TimedLogScopeTest, SlowScopeIsLoggedWithElapsedTime) {
+    std::string category;
+    log::LogLevel level = log::LogLevel::eTrace;
+    std::string message;
+    std::string function;
+    EXPECT_CALL(*sink_, log(_, _, _, _, _, _, _))
+        .WillOnce([&](const std::string& name,
+                      log::LogLevel record_level,
+                      log::TimeStampType,
+                      const std::string& text,
+                      const std::string&,
+                      const std::string& record_function,
+                      uint32_t) {
+            category = name;
+            level = record_level;
+            message = text;
+            function = record_function;
+        });
+
+    {
+        VNE_LOG_TIMED_SCOPE_LC(kLoggerName, "slow.path", log::LogLevel::eWarn, std::chrono::milliseconds(1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    EXPECT_EQ(category, "slow.path");
+    EXPECT_EQ(level, log::LogLevel::eWarn);
+    EXPECT_EQ(message.rfind("Scope took ", 0), 0u);
+    EXPECT_NE(message.find(" ms (threshold 1.000 ms)"), std::string::npos);
+    EXPECT_EQ(function, "TestBody");
+}
+
+TEST_F(TimedLogScopeTest, SlowScopeRespectsLoggerLevel) {
+    log::LoggerController::getLogger(kLoggerName)->setCurrentLogLevel(log::LogLevel::eError);
+    EXPECT_CALL(*sink_, log(_, _, _, _, _, _, _)).Times(0);
+
+    VNE_LOG_TIMED_SCOPE_L(kLoggerName, log::LogLevel::eInfo, std::chrono::nanoseconds(0));
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+}
@@ -0,0 +1,157 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/logging.h"
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+#include "mocks/log_sink_mock.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vne;
+using ::testing::_;
+
+namespace {
+
+CREATE_VNE_LOGGER_CATEGORY("trace.test");
+
+constexpr const char* kLoggerName = "trace_logger";
+
+}  // namespace
+
+class TraceScopeTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        log::LoggerController::unregisterAllLoggers();
+        logger_ = std::make_shared<log::SyncLogger>(kLoggerName);
+        auto sink = std::make_unique<log::LogSinkMock>();
+        sink_ = sink.get();
+        logger_->addLogSink(std::move(sink));
+        log::LoggerController::registerLogger(logger_);
+    }
+
+    void TearDown() override { log::LoggerController::unregisterAllLoggers(); }
+
+    void captureEvents() {
+        EXPECT_CALL(*sink_, logTraceEvent(_)).WillRepeatedly([this](const log::TraceEvent& event) {
+            events_.push_back(event);
+        });
+    }
+
+    std::shared_ptr<log::SyncLogger> logger_;
+    log::LogSinkMock* sink_ = nullptr;
+    std::vector<log::TraceEvent> events_;
+};
+
+TEST_F(TraceScopeTest, DisabledTracingRecordsNothing) {
+    EXPECT_FALSE(logger_->isTracingEnabled());
+    EXPECT_CALL(*sink_, logTraceEvent(_)).Times(0);
+
+    {
+        VNE_TRACE_SCOPE_L(kLoggerName, "disabled");
+    }
+    VNE_TRACE_BEGIN_L(kLoggerName, "disabled");
+    VNE_TRACE_END_L(kLoggerName, "disabled");
+}
+
+TEST_F(TraceScopeTest, UnknownLoggerRecordsNothing) {
+    EXPECT_CALL(*sink_, logTraceEvent(_)).Times(0);
+    logger_->setTracingEnabled(true);
+
+    VNE_TRACE_SCOPE_L("missing_logger", "nowhere");
+}
+
+TEST_F(TraceScopeTest, ScopeRecordsCompleteEvent) {
+    logger_->setTracingEnabled(true);
+    captureEvents();
+
+    uint64_t before = log::traceClockNs();
+    {
+        VNE_TRACE_SCOPE_L(kLoggerName, "frame");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    ASSERT_EQ(events_.size(), 1u);
+    const log::TraceEvent& event = events_[0];
+    EXPECT_STREQ(event.name, "frame");
+    EXPECT_STREQ(event.category, "trace.test");
+    EXPECT_EQ(event.phase, log::TracePhase::eComplete);
+    EXPECT_GE(event.timestamp_ns, before);
+    EXPECT_GE(event.duration_ns, 2000000u);
+    EXPECT_EQ(event.thread_id, log::traceThreadId());
+}
+
+TEST_F(TraceScopeTest, BeginAndEndRecordSeparateEvents) {
+    logger_->setTracingEnabled(true);
+    captureEvents();
+
+    VNE_TRACE_BEGIN_LC(kLoggerName, "io", "load");
+    VNE_TRACE_END_LC(kLoggerName, "io", "load");
+
+    ASSERT_EQ(events_.size(), 2u);
+    EXPECT_EQ(events_[0].phase, log::TracePhase::eBegin);
+    EXPECT_EQ(events_[1].phase, log::TracePhase::eEnd);
+    EXPECT_STREQ(events_[0].category, "io");
+    EXPECT_LE(events_[0].timestamp_ns, events_[1].timestamp_ns);
+}
+
+TEST_F(TraceScopeTest, ThreadIdsDifferBetweenThreads) {
+    uint64_t main_id = log::traceThreadId();
+    uint64_t other_id = 0;
+    std::thread([&other_id] { other_id = log::traceThreadId(); }).join();
+
+    EXPECT_NE(main_id, 0u);
+    EXPECT_NE(other_id, 0u);
+    EXPECT_NE(main_id, other_id);
+    EXPECT_EQ(main_id, log::traceThreadId());
+}
+
+TEST(TraceLoggingTest, AsyncLoggerWritesChromeTrace) {
+    const std::string trace_file = "trace_async_test.json";
+    log::Logging::initialize("trace_async", true);
+    log::Logging::addChromeTraceSink("trace_async", trace_file);
+    EXPECT_TRUE(log::Logging::getLogger("trace_async")->isTracingEnabled());
+
+    for (int i = 0; i < 10; ++i) {
+        VNE_TRACE_SCOPE_L("trace_async", "frame");
+        VNE_TRACE_BEGIN_L("trace_async", "update");
+        VNE_TRACE_END_L("trace_async", "update");
+    }
+    log::Logging::setTracingEnabled("trace_async", false);
+    VNE_TRACE_SCOPE_L("trace_async", "after_disable");
+    log::Logging::shutdown();
+
+    std::ifstream in(trace_file);
+    std::stringstream content;
+    content << in.rdbuf();
+    std::string text = content.str();
+    in.close();
+    std::filesystem::remove(trace_file);
+
+    size_t events = 0;
+    for (size_t pos = text.find("\"name\""); pos != std::string::npos; pos = text.find("\"name\"", pos + 1)) {
+        ++events;
+    }
+    EXPECT_EQ(events, 30u);
+    EXPECT_EQ(text.find("after_disable"), std::string::npos);
+    EXPECT_NE(text.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(text.rfind("]\n"), std::string::npos);
+}
@@ -0,0 +1,200 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/log_control_server.h"
+#include "vertexnova/logging/core/async_logger.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/log_call_site.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace vne;
+namespace fs = std::filesystem;
+
+namespace {
+constexpr const char* kTestDir = "control_test_dir";
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+}
+}  // namespace
+
+class LogControlServerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        log::LoggerController::unregisterAllLoggers();
+        fs::remove_all(kTestDir);
+        fs::create_directory(kTestDir);
+        logger_ = std::make_shared<log::SyncLogger>("control.test");
+        log::LoggerController::registerLogger(logger_);
+    }
+
+    void TearDown() override {
+        log::LoggerController::unregisterAllLoggers();
+        logger_.reset();
+        fs::remove_all(kTestDir);
+    }
+
+   protected:
+    std::shared_ptr<log::SyncLogger> logger_;
+};
+
+TEST_F(LogControlServerTest, HelpListsCommands) {
+    std::string reply = log::LogControlServer::execute("help");
+    EXPECT_EQ(reply.rfind("ok\n", 0), 0u);
+    EXPECT_NE(reply.find("category-level"), std::string::npos);
+    EXPECT_NE(reply.find("rotate"), std::string::npos);
+}
+
+TEST_F(LogControlServerTest, UnknownCommandIsAnError) {
+    EXPECT_EQ(log::LogControlServer::execute("frobnicate").rfind("error: ", 0), 0u);
+    EXPECT_EQ(log::LogControlServer::execute("   ").rfind("error: ", 0), 0u);
+}
+
+TEST_F(LogControlServerTest, ListShowsRegisteredLoggers) {
+    std::string reply = log::LogControlServer::execute("list");
+    EXPECT_EQ(reply.rfind("ok\n", 0), 0u);
+    EXPECT_NE(reply.find("control.test level=INFO"), std::string::npos) << reply;
+    EXPECT_NE(reply.find("mode=sync"), std::string::npos) << reply;
+}
+
+TEST_F(LogControlServerTest, LevelChangesLogger) {
+    EXPECT_EQ(log::LogControlServer::execute("level control.test debug"), "ok\n");
+    EXPECT_EQ(logger_->getCurrentLogLevel(), log::LogLevel::eDebug);
+
+    EXPECT_EQ(log::LogControlServer::execute("level * ERROR"), "ok\n");
+    EXPECT_EQ(logger_->getCurrentLogLevel(), log::LogLevel::eError);
+}
+
+TEST_F(LogControlServerTest, LevelRejectsBadArguments) {
+    EXPECT_EQ(log::LogControlServer::execute("level control.test loud").rfind("error: ", 0), 0u);
+    EXPECT_EQ(log::LogControlServer::execute("level missing.logger info").rfind("error: ", 0), 0u);
+    EXPECT_EQ(log::LogControlServer::execute("level control.test").rfind("error: ", 0), 0u);
+    EXPECT_EQ(logger_->getCurrentLogLevel(), log::LogLevel::eInfo);
+}
+
+TEST_F(LogControlServerTest, CategoryLevelIsAccepted) {
+    std::string reply = log::LogControlServer::execute("category-level control.nothing warn");
+    EXPECT_EQ(reply, "ok\n0 statements seen so far\n");
+    log::LogCallSite::resetStates();
+}
+
+TEST_F(LogControlServerTest, StatsReportsCounters) {
+    logger_->log("cat", log::LogLevel::eError, log::TimeStampType::eLocal, "message", "file", "function", 1);
+    std::string reply = log::LogControlServer::execute("stats control.test");
+    EXPECT_EQ(reply.rfind("ok\n", 0), 0u);
+    EXPECT_NE(reply.find("control.test accepted=1"), std::string::npos) << reply;
+    EXPECT_EQ(log::LogControlServer::execute("stats missing.logger").rfind("error: ", 0), 0u);
+}
+
+TEST_F(LogControlServerTest, RotateReopensFileSinks) {
+    const std::string path = std::string(kTestDir) + "/rotate.log";
+    const std::string rotated = std::string(kTestDir) + "/rotate.log.1";
+    logger_->setFlushLevel(log::LogLevel::eTrace);
+    logger_->addLogSink(std::make_unique<log::FileLogSink>(path));
+
+    logger_->log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "before", "file", "function", 1);
+    fs::rename(path, rotated);
+    EXPECT_EQ(log::LogControlServer::execute("rotate control.test"), "ok\n");
+    logger_->log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "after", "file", "function", 2);
+
+    EXPECT_NE(readFile(rotated).find("before"), std::string::npos);
+    EXPECT_EQ(readFile(rotated).find("after"), std::string::npos);
+    EXPECT_NE(readFile(path).find("after"), std::string::npos);
+}
+
+TEST_F(LogControlServerTest, AsyncRotateReopensOnTheWorker) {
+    const std::string path = std::string(kTestDir) + "/async_rotate.log";
+    const std::string rotated = std::string(kTestDir) + "/async_rotate.log.1";
+    auto async_logger = std::make_shared<log::AsyncLogger>("control.async");
+    async_logger->addLogSink(std::make_unique<log::FileLogSink>(path));
+    log::LoggerController::registerLogger(async_logger);
+
+    async_logger->log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "before", "file", "function", 1);
+    async_logger->flush();
+    fs::rename(path, rotated);
+    EXPECT_EQ(log::LogControlServer::execute("rotate control.async"), "ok\n");
+    async_logger->log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "after", "file", "function", 2);
+    async_logger->flush();
+
+    EXPECT_NE(readFile(rotated).find("before"), std::string::npos);
+    EXPECT_NE(readFile(path).find("after"), std::string::npos);
+}
+
+TEST_F(LogControlServerTest, DefaultSocketPathContainsPid) {
+    if (!log::LogControlServer::isSupported()) {
+        GTEST_SKIP() << "Unix domain sockets are not supported on this platform";
+    }
+    EXPECT_NE(log::LogControlServer::defaultSocketPath(1234).find("vnelogging-1234.sock"), std::string::npos);
+}
+
+TEST_F(LogControlServerTest, SocketRoundTrip) {
+    if (!log::LogControlServer::isSupported()) {
+        GTEST_SKIP() << "Unix domain sockets are not supported on this platform";
+    }
+    const std::string socket_path = (fs::temp_directory_path() / "vnelogging-control-test.sock").string();
+    log::LogControlServer server;
+    ASSERT_TRUE(server.start(socket_path));
+    EXPECT_TRUE(server.isRunning());
+    EXPECT_EQ(server.getSocketPath(), socket_path);
+
+    std::string reply;
+    ASSERT_TRUE(log::LogControlServer::sendCommand(socket_path, "level control.test warn", reply)) << reply;
+    EXPECT_EQ(reply, "ok\n");
+    EXPECT_EQ(logger_->getCurrentLogLevel(), log::LogLevel::eWarn);
+
+    ASSERT_TRUE(log::LogControlServer::sendCommand(socket_path, "list", reply)) << reply;
+    EXPECT_NE(reply.find("control.test level=WARN"), std::string::npos) << reply;
+
+    server.stop();
+    EXPECT_FALSE(server.isRunning());
+    EXPECT_FALSE(fs::exists(socket_path));
+    EXPECT_FALSE(log::LogControlServer::sendCommand(socket_path, "list", reply));
+}
+
+TEST_F(LogControlServerTest, SocketIsOwnerOnlyAndServerRestarts) {
+    if (!log::LogControlServer::isSupported()) {
+        GTEST_SKIP() << "Unix domain sockets are not supported on this platform";
+    }
+    const std::string socket_path = (fs::temp_directory_path() / "vnelogging-control-restart.sock").string();
+    log::LogControlServer server;
+    ASSERT_TRUE(server.start(socket_path));
+    EXPECT_EQ(fs::status(socket_path).permissions() & fs::perms::all, fs::perms::owner_read | fs::perms::owner_write);
+    server.stop();
+
+    ASSERT_TRUE(server.start(socket_path));
+    std::string reply;
+    EXPECT_TRUE(log::LogControlServer::sendCommand(socket_path, "help", reply)) << reply;
+    server.stop();
+}
+
+TEST_F(LogControlServerTest, StartLeavesOtherFilesAlone) {
+    if (!log::LogControlServer::isSupported()) {
+        GTEST_SKIP() << "Unix domain sockets are not supported on this platform";
+    }
+    const std::string path = std::string(kTestDir) + "/not-a-socket";
+    std::ofstream(path) << "keep me";
+    log::LogControlServer server;
+    EXPECT_FALSE(server.start(path));
+    EXPECT_FALSE(server.isRunning());
+    EXPECT_EQ(readFile(path), "keep me");
+}
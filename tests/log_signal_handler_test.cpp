@@ -0,0 +1,135 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "vertexnova/logging/log_signal_handler.h"
+#include "vertexnova/logging/core/file_log_sink.h"
+#include "vertexnova/logging/core/logger_controller.h"
+#include "vertexnova/logging/core/sync_logger.h"
+
+#include <chrono>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace vne;
+namespace fs = std::filesystem;
+
+namespace {
+constexpr const char* kTestDir = "signal_test_dir";
+
+/**
+ * @brief Waits up to two seconds for the handler thread to apply a signal.
+ */
+bool waitFor(const std::function<bool()>& condition) {
+    for (int i = 0; i < 200; ++i) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return condition();
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+}
+}  // namespace
+
+class LogSignalHandlerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        if (!log::LogSignalHandler::isSupported()) {
+            GTEST_SKIP() << "SIGUSR1/SIGUSR2 are not available on this platform";
+        }
+        log::LoggerController::unregisterAllLoggers();
+        fs::remove_all(kTestDir);
+        fs::create_directory(kTestDir);
+        logger_ = std::make_shared<log::SyncLogger>("signal.test");
+        log::LoggerController::registerLogger(logger_);
+    }
+
+    void TearDown() override {
+        handler_.uninstall();
+        log::LoggerController::unregisterAllLoggers();
+        logger_.reset();
+        fs::remove_all(kTestDir);
+    }
+
+    log::LogLevel level() const { return logger_->getCurrentLogLevel(); }
+
+   protected:
+    std::shared_ptr<log::SyncLogger> logger_;
+    log::LogSignalHandler handler_;
+};
+
+TEST_F(LogSignalHandlerTest, InstallAndUninstall) {
+    ASSERT_TRUE(handler_.install());
+    EXPECT_TRUE(handler_.isInstalled());
+
+    log::LogSignalHandler second;
+    EXPECT_FALSE(second.install());
+
+    handler_.uninstall();
+    EXPECT_FALSE(handler_.isInstalled());
+    EXPECT_TRUE(second.install());
+    second.uninstall();
+}
+
+TEST_F(LogSignalHandlerTest, Usr1TogglesTrace) {
+    logger_->setCurrentLogLevel(log::LogLevel::eWarn);
+    ASSERT_TRUE(handler_.install(log::SignalLevelMode::eToggleTrace));
+
+    std::raise(SIGUSR1);
+    EXPECT_TRUE(waitFor([&] { return level() == log::LogLevel::eTrace; }));
+
+    std::raise(SIGUSR1);
+    EXPECT_TRUE(waitFor([&] { return level() == log::LogLevel::eWarn; }));
+}
+
+TEST_F(LogSignalHandlerTest, Usr1CyclesLevels) {
+    logger_->setCurrentLogLevel(log::LogLevel::eInfo);
+    ASSERT_TRUE(handler_.install(log::SignalLevelMode::eCycle));
+
+    std::raise(SIGUSR1);
+    EXPECT_TRUE(waitFor([&] { return level() == log::LogLevel::eDebug; }));
+    std::raise(SIGUSR1);
+    EXPECT_TRUE(waitFor([&] { return level() == log::LogLevel::eTrace; }));
+    std::raise(SIGUSR1);
+    EXPECT_TRUE(waitFor([&] { return level() == log::LogLevel::eInfo; }));
+}
+
+TEST_F(LogSignalHandlerTest, Usr2ReopensFiles) {
+    const std::string path = std::string(kTestDir) + "/signal.log";
+    const std::string rotated = std::string(kTestDir) + "/signal.log.1";
+    logger_->addLogSink(std::make_unique<log::FileLogSink>(path));
+    ASSERT_TRUE(handler_.install());
+
+    logger_->log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "before", "file", "function", 1);
+    fs::rename(path, rotated);
+    std::raise(SIGUSR2);
+    ASSERT_TRUE(waitFor([&] { return fs::exists(path); }));
+    logger_->log("cat", log::LogLevel::eInfo, log::TimeStampType::eLocal, "after", "file", "function", 2);
+    logger_->flush();
+
+    EXPECT_NE(readFile(rotated).find("before"), std::string::npos);
+    EXPECT_EQ(readFile(rotated).find("after"), std::string::npos);
+    EXPECT_NE(readFile(path).find("after"), std::string::npos);
+}
@@ -132,6 +132,33 @@ TEST_F(LoggingSystemTest, MixedSyncAndAsyncLoggers) {
     log::Logging::shutdown();
 }
 
+TEST_F(LoggingSystemTest, HybridLoggerMode) {
+    log::LoggerConfig hybrid_cfg;
+    hybrid_cfg.name = "hybrid.logger";
+    hybrid_cfg.sink = log::LogSinkType::eConsole;
+    hybrid_cfg.mode = log::LoggerMode::eHybrid;
+    hybrid_cfg.sync_level = log::LogLevel::eWarn;
+    log::Logging::configureLogger(hybrid_cfg);
+
+    log::LoggerConfig async_cfg;
+    async_cfg.name = "async.logger";
+    async_cfg.sink = log::LogSinkType::eConsole;
+    async_cfg.async = true;
+    log::Logging::configureLogger(async_cfg);
+
+    EXPECT_EQ(log::Logging::getLoggerMode("hybrid.logger"), log::LoggerMode::eHybrid);
+    EXPECT_TRUE(log::Logging::isLoggerAsync("hybrid.logger"));
+    EXPECT_TRUE(log::Logging::getLoggerStats("hybrid.logger").hybrid);
+    EXPECT_EQ(log::Logging::getLoggerMode("async.logger"), log::LoggerMode::eAsync);
+    EXPECT_EQ(log::Logging::getLoggerMode("nonexistent.logger"), log::LoggerMode::eSync);
+
+    // An async logger becomes hybrid once it has a sync level
+    log::Logging::setSyncLevel("async.logger", log::LogLevel::eError);
+    EXPECT_EQ(log::Logging::getLoggerMode("async.logger"), log::LoggerMode::eHybrid);
+
+    log::Logging::shutdown();
+}
+
 TEST_F(LoggingSystemTest, LoggerSpecificMacros) {
     // Create two loggers with different settings
     std::string logger1_name = "test_logger1";
@@ -0,0 +1,124 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/logging/shared_log_collector.h"
+
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+/**
+ * @file vnelog_collectord.cpp
+ *
+ * @brief Daemon that merges the shared-memory rings of SharedMemoryLogSink producers into one rotated file.
+ *
+ * Usage: vnelog-collectord [-n <segment>] [-o <file>] [--max-size <bytes>] [--max-files <n>]
+ *                          [--window-ms <ms>] [--unlink]
+ *
+ * SIGINT and SIGTERM write what is left and exit; SIGHUP reopens the output
+ * file (after logrotate, for example). The daemon can be restarted at any
+ * time: producers keep writing into their rings meanwhile, and the new
+ * instance continues at the committed read positions. --unlink removes the
+ * segment on exit, so the next producer or collector creates a fresh one.
+ * Exit status: 0 on a clean shutdown, 1 if the segment or file cannot be
+ * opened, 2 for usage errors.
+ */
+
+namespace {
+
+using vne::log::SharedLogCollector;
+using vne::log::SharedLogCollectorOptions;
+using vne::log::SharedLogSegment;
+
+constexpr int kExitOk = 0;
+constexpr int kExitOpenFailed = 1;
+constexpr int kExitUsage = 2;
+
+std::atomic<bool> s_stop{false};
+SharedLogCollector* s_collector = nullptr;
+
+void onStop(int) {
+    s_stop.store(true, std::memory_order_relaxed);
+}
+
+void onHangup(int) {
+    if (s_collector) {
+        s_collector->requestReopen();
+    }
+}
+
+void printUsage(const char* program) {
+    std::cerr << "usage: " << program << " [-n <segment>] [-o <file>] [--max-size <bytes>] [--max-files <n>]\n"
+              << "       " << std::string(std::strlen(program), ' ') << " [--window-ms <ms>] [--unlink]\n"
+              << "Defaults: -n " << SharedLogSegment::kDefaultName << " -o vnelog.log --max-size 67108864"
+              << " --max-files 5 --window-ms 50\n";
+}
+
+bool parseNumber(const char* text, unsigned long long& value) {
+    char* end = nullptr;
+    value = std::strtoull(text, &end, 10);
+    return *text != '\0' && *end == '\0';
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    SharedLogCollectorOptions options;
+    bool unlink_on_exit = false;
+
+    for (int arg = 1; arg < argc; ++arg) {
+        const bool has_value = arg + 1 < argc;
+        unsigned long long number = 0;
+        if (std::strcmp(argv[arg], "-n") == 0 && has_value) {
+            options.segment_name = argv[++arg];
+        } else if (std::strcmp(argv[arg], "-o") == 0 && has_value) {
+            options.output_path = argv[++arg];
+        } else if (std::strcmp(argv[arg], "--max-size") == 0 && has_value && parseNumber(argv[++arg], number)) {
+            options.max_file_bytes = number;
+        } else if (std::strcmp(argv[arg], "--max-files") == 0 && has_value && parseNumber(argv[++arg], number)) {
+            options.max_files = static_cast<size_t>(number);
+        } else if (std::strcmp(argv[arg], "--window-ms") == 0 && has_value && parseNumber(argv[++arg], number)) {
+            options.merge_window = std::chrono::milliseconds(number);
+        } else if (std::strcmp(argv[arg], "--unlink") == 0) {
+            unlink_on_exit = true;
+        } else if (std::strcmp(argv[arg], "-h") == 0 || std::strcmp(argv[arg], "--help") == 0) {
+            printUsage(argv[0]);
+            return kExitOk;
+        } else {
+            printUsage(argv[0]);
+            return kExitUsage;
+        }
+    }
+
+    SharedLogCollector collector(options);
+    if (!collector.open()) {
+        std::cerr << "couldn't open segment " << options.segment_name << " or file " << options.output_path << '\n';
+        return kExitOpenFailed;
+    }
+    s_collector = &collector;
+    std::signal(SIGINT, onStop);
+    std::signal(SIGTERM, onStop);
+    std::signal(SIGHUP, onHangup);
+
+    collector.run(s_stop);
+
+    s_collector = nullptr;
+    if (collector.getDropped() > 0) {
+        std::cerr << collector.getDropped() << " records were dropped by producers whose ring was full\n";
+    }
+    if (unlink_on_exit) {
+        SharedLogSegment::unlink(options.segment_name);
+    }
+    return kExitOk;
+}
@@ -0,0 +1,103 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2024 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/logging/log_control_server.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+/**
+ * @file vnelogctl.cpp
+ *
+ * @brief Command-line client of the logging control endpoint (Logging::startControlServer).
+ *
+ * Usage: vnelogctl (-p <pid> | -s <socket>) <command> [arguments...]
+ *
+ * The socket can also be given in the VNELOGCTL_SOCKET environment variable.
+ * Exit status: 0 if the process replied "ok", 1 if it replied with an error,
+ * 2 for usage or connection errors.
+ */
+
+namespace {
+
+using vne::log::LogControlServer;
+
+constexpr int kExitOk = 0;
+constexpr int kExitCommandFailed = 1;
+constexpr int kExitUsage = 2;
+
+void printUsage(const char* program) {
+    std::cerr << "usage: " << program << " (-p <pid> | -s <socket>) <command> [arguments...]\n"
+              << "       " << program << " -p <pid> help   lists the commands\n"
+              << "The socket may also be set in VNELOGCTL_SOCKET.\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string socket_path;
+    if (const char* env = std::getenv("VNELOGCTL_SOCKET")) {
+        socket_path = env;
+    }
+
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-'; ++arg) {
+        const bool has_value = arg + 1 < argc;
+        if (std::strcmp(argv[arg], "-s") == 0 && has_value) {
+            socket_path = argv[++arg];
+        } else if (std::strcmp(argv[arg], "-p") == 0 && has_value) {
+            char* end = nullptr;
+            long pid = std::strtol(argv[++arg], &end, 10);
+            if (*end != '\0' || pid <= 0) {
+                std::cerr << "invalid pid '" << argv[arg] << "'\n";
+                return kExitUsage;
+            }
+            socket_path = LogControlServer::defaultSocketPath(pid);
+        } else if (std::strcmp(argv[arg], "-h") == 0 || std::strcmp(argv[arg], "--help") == 0) {
+            printUsage(argv[0]);
+            return kExitOk;
+        } else {
+            printUsage(argv[0]);
+            return kExitUsage;
+        }
+    }
+    if (socket_path.empty() || arg == argc) {
+        printUsage(argv[0]);
+        return kExitUsage;
+    }
+
+    std::string command;
+    for (; arg < argc; ++arg) {
+        if (!command.empty()) {
+            command += ' ';
+        }
+        command += argv[arg];
+    }
+
+    std::string reply;
+    if (!LogControlServer::sendCommand(socket_path, command, reply)) {
+        std::cerr << reply << '\n';
+        return kExitUsage;
+    }
+
+    // The first line is the status; print the rest as is
+    const size_t status_end = reply.find('\n');
+    const std::string status = reply.substr(0, status_end);
+    const std::string body = status_end == std::string::npos ? std::string() : reply.substr(status_end + 1);
+    std::cout << body;
+    if (status != "ok") {
+        std::cerr << status << '\n';
+        return kExitCommandFailed;
+    }
+    return kExitOk;
+}